@@ -0,0 +1,298 @@
+/**
+  ******************************************************************************
+  * @file	: LimbsSftyLnFSwtch_Bench_01.cpp
+  * @brief  : Poll cycle cost benchmark for the LimbsSftyLnFSwtch class
+  *
+  * Benchmark for the LimbsSftySw_ESP32 library LimbsSftyLnFSwtch class.
+  *
+  * This sketch measures the execution cost of the LimbsSftyLnFSwtch polling
+  * hot path, so regressions can be detected before flashing the production
+  * controllers. The measured stages are:
+  * - The complete lsSwtchPollCb() timer callback
+  * - The _getUndrlSwtchStts() underlying switches status recovery
+  * - The _updFdaState() state machine update
+  *
+  * For each stage the following values are reported through the serial port:
+  * - Mean execution time in nanoseconds per poll (ns/poll)
+  * - 50th percentile (p50) and 99th percentile (p99) latency
+  * - Maximum latency observed
+  * - Heap allocations per poll cycle
+  *
+  * The object's own polling timer is stopped after begin(), so every poll is
+  * executed synchronously from the benchmark task and no timer callback runs
+  * concurrently with the measurements. The underlying MPBttns keep their own
+  * timers running, so the input pins can be operated while the benchmark runs
+  * to measure the cost of the different FDA states.
+  *
+  * The allocations count is obtained by overriding the global operator new,
+  * and by comparing the heap allocated blocks quantity before and after each
+  * run. The latter catches C allocations (malloc, String, FreeRTOS objects) as
+  * long as they are not released inside the same run.
+  *
+  * The same measurements are available on a Linux host, with no board, by the
+  * LsSwtchPollBnch target of the extras/LsSwtchHost CMake project.
+  *
+  * Framework: Arduino
+  * Platform: ESP32
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 15/10/2026
+  *       Last update:   15/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+#include <algorithm>
+#include <new>
+
+//==============================================>> General use definitions BEGIN
+//* This definitions are placed here for easier testing of important implementation parameters, checking the change of behavior when playing around with different values, etc.
+#define BnchTskPrrtyLvl 5
+#define UndrlyngMPBttnPollTm 20
+#define LsSwtchPollTm 20
+#define BnchSmplsQty 2000  // Quantity of samples taken for each measured stage
+#define BnchRptDlyTm 5000  // Time between benchmark runs
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+//========================================>> General use function prototypes END
+
+//======================================>> Task Callback function prototypes BEGIN
+void bnchTsk(void *pvParameters);
+//========================================>> Task Callback function prototypes END
+
+//===========================>> Tasks Handles declarations BEGIN
+TaskHandle_t bnchTskHndl {NULL};
+//===========================>> Tasks Handles declarations END
+
+//===============================>> Global variables (strictly sanctioned) BEGIN
+volatile uint32_t newOprtrCnt{0};   // operator new invocations counter
+uint32_t smplsCycls[BnchSmplsQty]{0};
+//=================================>> Global variables (strictly sanctioned) END
+
+limbSftyFwConf_t bnchTskConf{
+   .lsSwExecTskCore = xPortGetCoreID(),
+   .lsSwExecTskPrrtyCnfg = BnchTskPrrtyLvl, //! Arbitrary Task priority selected, chosen to be lower than the software timer update.
+};
+
+//===============================>> Allocations counting BEGIN
+void* operator new(size_t size){
+   ++newOprtrCnt;
+   void* ptr = malloc(size);
+   if(ptr == nullptr)
+      Error_Handler();
+
+   return ptr;
+}
+
+void* operator new[](size_t size){
+   ++newOprtrCnt;
+   void* ptr = malloc(size);
+   if(ptr == nullptr)
+      Error_Handler();
+
+   return ptr;
+}
+
+void operator delete(void* ptr) noexcept{
+   free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept{
+   free(ptr);
+}
+//=================================>> Allocations counting END
+
+/**
+ * @brief LimbsSftyLnFSwtch subclass giving the benchmark access to the polling hot path stages
+ */
+class LsSwtchBnch: public LimbsSftyLnFSwtch{
+public:
+   using LimbsSftyLnFSwtch::LimbsSftyLnFSwtch;
+
+   bool stopPollTmr(){
+      return (xTimerStop(_lsSwtchPollTmrHndl, portMAX_DELAY) == pdPASS);
+   }
+   void pollCb(){
+      lsSwtchPollCb(_lsSwtchPollTmrHndl);
+   }
+   void getUndrlSwtchStts(){
+      _getUndrlSwtchStts();
+   }
+   void updFdaState(){
+      _updCurTimeMs();
+      _updFdaState();
+   }
+};
+
+/**
+ * @brief Benchmark run results for one measured stage
+ */
+struct bnchRslt_t{
+   uint32_t nsPerPoll;
+   uint32_t p50Ns;
+   uint32_t p99Ns;
+   uint32_t maxNs;
+   float allocsPerPoll;
+   int32_t heapBlcksDlt;
+};
+
+uint32_t cyclsToNs(const uint32_t &cycls);
+void prntRslt(const char* stgName, const bnchRslt_t &rslt);
+template <typename F> bnchRslt_t runBnch(F stgFn);
+
+void setup() {
+   Serial.begin(115200);
+   // Create the Benchmark task for setup and execution of the main code
+   xReturned = xTaskCreatePinnedToCore(
+      bnchTsk,  // Callback function/task to be called
+      "BenchmarkTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      bnchTskConf.lsSwExecTskPrrtyCnfg, // Priority level given to the task
+      &bnchTskHndl, // Task handle
+      bnchTskConf.lsSwExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void bnchTsk(void *pvParameters){
+   TickType_t loopTmrStrtTm{0};
+   TickType_t* loopTmrStrtTmPtr{&loopTmrStrtTm};
+   TickType_t totalDelay {BnchRptDlyTm};
+
+   //=============================>> Underlying switches configuration parameters values BEGIN
+   swtchInptHwCfg_t lftHndHwAttrbts{   // Left hand switch hardware attributes
+      .inptPin = GPIO_NUM_4,
+      .typeNO = true,
+      .pulledUp = true,
+      .dbncTime = 0UL,
+   };
+   swtchInptHwCfg_t rghtHndHwAttrbts{  // Right hand switch hardware attributes
+      .inptPin = GPIO_NUM_2,
+      .typeNO = true,
+      .pulledUp = true,
+      .dbncTime = 0UL,
+   };
+   swtchInptHwCfg_t ftHwAttrbts{ // Foot switch hardware attributes
+      .inptPin = GPIO_NUM_5,
+      .typeNO = true,
+      .pulledUp = true,
+      .dbncTime = 0UL
+   };
+   swtchBhvrCfg_t lftHndBhvrSUp{ // Left hand switch behavior configuration properties
+      .swtchStrtDlyTm = 100,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t rghtHndBhvrSUp{   // Right hand switch behavior configuration properties
+      .swtchStrtDlyTm = 100,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t ftBhvrSUp{  // Foot switch behavior configuration properties
+      .swtchStrtDlyTm = 200,
+      .swtchIsEnbld = false,
+   };
+   lsSwtchSwCfg_t lsssSwtchWrkngPrm{
+      .ltchRlsActvTm = 1500,
+      .prdCyclActvTm = 6000,
+   };
+   //===============================>> Underlying switches configuration parameters values END
+
+   LsSwtchBnch bnchSftySwtch (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+   bnchSftySwtch.setUndrlSwtchsPollDelay(UndrlyngMPBttnPollTm);
+   if(!bnchSftySwtch.begin(LsSwtchPollTm))
+      Error_Handler();
+   if(!bnchSftySwtch.stopPollTmr())
+      Error_Handler();
+
+   Serial.printf("LimbsSftyLnFSwtch poll cycle benchmark, %u samples per stage, CPU @ %u MHz\n", BnchSmplsQty, ESP.getCpuFreqMHz());
+
+   for(;;){
+      *loopTmrStrtTmPtr = xTaskGetTickCount() / portTICK_RATE_MS;
+
+      prntRslt("lsSwtchPollCb", runBnch([&](){bnchSftySwtch.pollCb();}));
+      prntRslt("_getUndrlSwtchStts", runBnch([&](){bnchSftySwtch.getUndrlSwtchStts();}));
+      prntRslt("_updFdaState", runBnch([&](){bnchSftySwtch.updFdaState();}));
+      Serial.println();
+
+      vTaskDelayUntil(loopTmrStrtTmPtr, totalDelay);
+   }
+}
+//===============================>> User Tasks Implementations END
+
+//===============================>> User Functions Implementations BEGIN
+uint32_t cyclsToNs(const uint32_t &cycls){
+
+   return static_cast<uint32_t>((static_cast<uint64_t>(cycls) * 1000UL) / ESP.getCpuFreqMHz());
+}
+
+void prntRslt(const char* stgName, const bnchRslt_t &rslt){
+   Serial.printf("%-20s %8u ns/poll | p50 %8u ns | p99 %8u ns | max %8u ns | %.3f allocs/poll | heap blocks delta %d\n",
+      stgName, rslt.nsPerPoll, rslt.p50Ns, rslt.p99Ns, rslt.maxNs, rslt.allocsPerPoll, rslt.heapBlcksDlt);
+
+   return;
+}
+
+/**
+ * @brief Runs BnchSmplsQty executions of the stage function, measuring each one with the CPU cycle counter
+ */
+template <typename F> bnchRslt_t runBnch(F stgFn){
+   bnchRslt_t rslt{};
+   multi_heap_info_t heapInfoBfr{};
+   multi_heap_info_t heapInfoAftr{};
+   uint32_t newOprtrCntBfr{0};
+   uint32_t cyclsStrt{0};
+   uint64_t cyclsTtl{0};
+
+   heap_caps_get_info(&heapInfoBfr, MALLOC_CAP_DEFAULT);
+   newOprtrCntBfr = newOprtrCnt;
+   for(int smplNum{0}; smplNum < BnchSmplsQty; ++smplNum){
+      cyclsStrt = ESP.getCycleCount();
+      stgFn();
+      smplsCycls[smplNum] = ESP.getCycleCount() - cyclsStrt;
+      cyclsTtl += smplsCycls[smplNum];
+   }
+   rslt.allocsPerPoll = static_cast<float>(newOprtrCnt - newOprtrCntBfr) / BnchSmplsQty;
+   heap_caps_get_info(&heapInfoAftr, MALLOC_CAP_DEFAULT);
+   rslt.heapBlcksDlt = static_cast<int32_t>(heapInfoAftr.allocated_blocks) - static_cast<int32_t>(heapInfoBfr.allocated_blocks);
+
+   std::sort(smplsCycls, smplsCycls + BnchSmplsQty);
+   rslt.nsPerPoll = cyclsToNs(static_cast<uint32_t>(cyclsTtl / BnchSmplsQty));
+   rslt.p50Ns = cyclsToNs(smplsCycls[(BnchSmplsQty * 50) / 100]);
+   rslt.p99Ns = cyclsToNs(smplsCycls[(BnchSmplsQty * 99) / 100]);
+   rslt.maxNs = cyclsToNs(smplsCycls[BnchSmplsQty - 1]);
+
+   return rslt;
+}
+
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+  for(;;)
+  {
+  }
+
+  return;
+}
+//===============================>> User Functions Implementations END
@@ -0,0 +1,223 @@
+/**
+  ******************************************************************************
+  * @file	: LimbsSftyLnFSwtch_Bench_02.cpp
+  * @brief  : Event driven input path and phase deadline timers benchmark for the LimbsSftyLnFSwtch class
+  *
+  * Benchmark for the LimbsSftySw_ESP32 library LimbsSftyLnFSwtch class.
+  *
+  * This sketch measures the latency between the foot switch press edge and the
+  * latch release activation when the object is set to the event driven mode.
+  * The input edges are produced by the injctInptEvnt() method, that enters the
+  * same deferred handler the GPIO edge Interrupt Service Routines use, so no
+  * switch needs to be operated while the benchmark runs.
+  *
+  * For each run the following values are reported through the serial port:
+  * - Mean, 50th percentile (p50), 99th percentile (p99) and maximum latency
+  * measured, in microseconds, from the foot press edge injection to the
+  * benchmark task being unblocked by the latch release turn on notification
+  * - The worst case latency for the same configuration in the fixed period
+  * polling mode: underlying switch poll period + debounce time + object poll
+  * period, not including the notification delivery time
+  * - Mean and maximum latch release phase length error, in microseconds,
+  * measured between the latch release turn on and turn off notifications. With
+  * the phase deadline timers mode set the phase ends on the microseconds resolution
+  * deadline -on the deadline tick for the _lsSwtchStcAlloc build-, with the
+  * periodic updates mode the error grows up to one poll period.
+  *
+  * The foot switch start delay is set to 0 to measure only the input path,
+  * the foot switch debounce time is kept, as it's part of the input path.
+  *
+  * Framework: Arduino
+  * Platform: ESP32
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 15/10/2026
+  *       Last update:   15/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+#include <algorithm>
+
+//==============================================>> General use definitions BEGIN
+//* This definitions are placed here for easier testing of important implementation parameters, checking the change of behavior when playing around with different values, etc.
+#define BnchTskPrrtyLvl 5
+#define UndrlyngMPBttnPollTm 20
+#define LsSwtchPollTm 20
+#define FtDbncTm 20   // Foot switch debounce time
+#define PhsTmrDrvn true   // Latch release and production cycle phases ended by one-shot deadline timers
+#define BnchSmplsQty 200  // Quantity of production cycles measured for each run
+#define BnchRptDlyTm 5000  // Time between benchmark runs
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+//========================================>> General use function prototypes END
+
+//======================================>> Task Callback function prototypes BEGIN
+void bnchTsk(void *pvParameters);
+//========================================>> Task Callback function prototypes END
+
+//===========================>> Tasks Handles declarations BEGIN
+TaskHandle_t bnchTskHndl {NULL};
+//===========================>> Tasks Handles declarations END
+
+//===============================>> Global variables (strictly sanctioned) BEGIN
+uint32_t smplsUs[BnchSmplsQty]{0};
+//=================================>> Global variables (strictly sanctioned) END
+
+limbSftyFwConf_t bnchTskConf{
+   .lsSwExecTskCore = xPortGetCoreID(),
+   .lsSwExecTskPrrtyCnfg = BnchTskPrrtyLvl, //! Arbitrary Task priority selected, chosen to be lower than the software timer update.
+};
+
+void setup() {
+   Serial.begin(115200);
+   // Create the Benchmark task for setup and execution of the main code
+   xReturned = xTaskCreatePinnedToCore(
+      bnchTsk,  // Callback function/task to be called
+      "BenchmarkTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      bnchTskConf.lsSwExecTskPrrtyCnfg, // Priority level given to the task
+      &bnchTskHndl, // Task handle
+      bnchTskConf.lsSwExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void bnchTsk(void *pvParameters){
+   TickType_t loopTmrStrtTm{0};
+   TickType_t* loopTmrStrtTmPtr{&loopTmrStrtTm};
+   TickType_t totalDelay {BnchRptDlyTm};
+   int64_t ftPrssTm{0};
+   int64_t ltchRlsOnTm{0};
+   uint64_t ttlUs{0};
+   int smplsQty{0};
+   int64_t ltchRlsErrUs{0};
+   int64_t ttlLtchRlsErrUs{0};
+   int64_t maxLtchRlsErrUs{0};
+
+   //=============================>> Underlying switches configuration parameters values BEGIN
+   swtchInptHwCfg_t lftHndHwAttrbts{.inptPin = GPIO_NUM_4};
+   swtchInptHwCfg_t rghtHndHwAttrbts{.inptPin = GPIO_NUM_2};
+   swtchInptHwCfg_t ftHwAttrbts{
+      .inptPin = GPIO_NUM_5,
+      .typeNO = true,
+      .pulledUp = true,
+      .dbncTime = FtDbncTm
+   };
+   swtchBhvrCfg_t lftHndBhvrSUp{
+      .swtchStrtDlyTm = 50,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t rghtHndBhvrSUp{
+      .swtchStrtDlyTm = 50,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t ftBhvrSUp{
+      .swtchStrtDlyTm = 0,
+      .swtchIsEnbld = false,
+   };
+   lsSwtchSwCfg_t lsssSwtchWrkngPrm{
+      .ltchRlsActvTm = 100,
+      .prdCyclActvTm = 200,
+   };
+   //===============================>> Underlying switches configuration parameters values END
+
+   LimbsSftyLnFSwtch bnchSftySwtch (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+   bnchSftySwtch.setUndrlSwtchsPollDelay(UndrlyngMPBttnPollTm);
+   if(!bnchSftySwtch.setEvntDrvn(true))
+      Error_Handler();
+   if(!bnchSftySwtch.setPhsTmrDrvn(PhsTmrDrvn))
+      Error_Handler();
+   if(!bnchSftySwtch.begin(LsSwtchPollTm))
+      Error_Handler();
+   bnchSftySwtch.setTskToNtfyTrnOnLtchRls(bnchTskHndl);
+   bnchSftySwtch.setTskToNtfyTrnOffLtchRls(bnchTskHndl);
+   bnchSftySwtch.setTskToNtfyTrnOffPrdCycl(bnchTskHndl);
+
+   Serial.printf("LimbsSftyLnFSwtch event driven latency benchmark, %u cycles per run, CPU @ %u MHz\n", BnchSmplsQty, ESP.getCpuFreqMHz());
+
+   for(;;){
+      *loopTmrStrtTmPtr = xTaskGetTickCount() / portTICK_RATE_MS;
+      ttlUs = 0;
+      smplsQty = 0;
+      ttlLtchRlsErrUs = 0;
+      maxLtchRlsErrUs = 0;
+
+      for(int smplNum{0}; smplNum < BnchSmplsQty; ++smplNum){
+         xTaskNotifyWait(0x00, 0xFFFFFFFF, NULL, 0);  // Discard any pending notification
+         bnchSftySwtch.injctInptEvnt(lftHndInptId, true);
+         bnchSftySwtch.injctInptEvnt(rghtHndInptId, true);
+         vTaskDelay(pdMS_TO_TICKS(_HwMinDbncTime + lftHndBhvrSUp.swtchStrtDlyTm + 2 * LsSwtchPollTm)); // Both hands debounced and out of the start delay, foot switch enabled
+
+         ftPrssTm = esp_timer_get_time();
+         bnchSftySwtch.injctInptEvnt(ftInptId, true);
+         if(xTaskNotifyWait(0x00, 0xFFFFFFFF, NULL, pdMS_TO_TICKS(1000)) == pdPASS){
+            ltchRlsOnTm = esp_timer_get_time();
+            smplsUs[smplsQty] = static_cast<uint32_t>(ltchRlsOnTm - ftPrssTm);
+            ttlUs += smplsUs[smplsQty];
+            if(xTaskNotifyWait(0x00, 0xFFFFFFFF, NULL, pdMS_TO_TICKS(lsssSwtchWrkngPrm.ltchRlsActvTm + 1000)) == pdPASS){
+               ltchRlsErrUs = esp_timer_get_time() - ltchRlsOnTm - static_cast<int64_t>(lsssSwtchWrkngPrm.ltchRlsActvTm * 1000UL);
+               ttlLtchRlsErrUs += ltchRlsErrUs;
+               if(maxLtchRlsErrUs < ltchRlsErrUs)
+                  maxLtchRlsErrUs = ltchRlsErrUs;
+            }
+            ++smplsQty;
+         }
+
+         bnchSftySwtch.injctInptEvnt(ftInptId, false);
+         bnchSftySwtch.injctInptEvnt(lftHndInptId, false);
+         bnchSftySwtch.injctInptEvnt(rghtHndInptId, false);
+         xTaskNotifyWait(0x00, 0xFFFFFFFF, NULL, pdMS_TO_TICKS(lsssSwtchWrkngPrm.prdCyclActvTm + 1000)); // Production cycle end
+      }
+
+      if(smplsQty > 0){
+         std::sort(smplsUs, smplsUs + smplsQty);
+         Serial.printf("Foot press to latch release: mean %6llu us | p50 %6u us | p99 %6u us | max %6u us | %d/%d cycles completed\n",
+            ttlUs / smplsQty, smplsUs[(smplsQty * 50) / 100], smplsUs[(smplsQty * 99) / 100], smplsUs[smplsQty - 1], smplsQty, BnchSmplsQty);
+         Serial.printf("Latch release phase length error (%s): mean %6lld us | max %6lld us\n",
+            PhsTmrDrvn?"phase deadline timers":"periodic updates", ttlLtchRlsErrUs / smplsQty, maxLtchRlsErrUs);
+      }
+      else{
+         Serial.println("No production cycle completed, check the configuration parameters");
+      }
+      Serial.printf("Fixed period polling mode worst case for the same configuration: %6lu us\n\n", (UndrlyngMPBttnPollTm + FtDbncTm + LsSwtchPollTm) * 1000UL);
+
+      vTaskDelayUntil(loopTmrStrtTmPtr, totalDelay);
+   }
+}
+//===============================>> User Tasks Implementations END
+
+//===============================>> User Functions Implementations BEGIN
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+  for(;;)
+  {
+  }
+
+  return;
+}
+//===============================>> User Functions Implementations END
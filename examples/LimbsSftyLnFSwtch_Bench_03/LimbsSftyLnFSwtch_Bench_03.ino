@@ -0,0 +1,193 @@
+/**
+  ******************************************************************************
+  * @file	: LimbsSftyLnFSwtch_Bench_03.cpp
+  * @brief  : Object lock contention and hold time benchmark for the LimbsSftyLnFSwtch class
+  *
+  * Benchmark for the LimbsSftySw_ESP32 library LimbsSftyLnFSwtch class.
+  *
+  * Each LimbsSftyLnFSwtch object owns a single spinlock protecting its
+  * internal state. This sketch measures the cost of the critical sections
+  * protected by that lock, using the setLsSwtchOtptsChng() method -a short
+  * critical section that increments or decrements the outputs change counter-
+  * as the load:
+  * - Uncontended: a single task, pinned to core 0, executes the increment and
+  * decrement pairs
+  * - Contended: two tasks, one pinned to each core, execute the same pairs on
+  * the same object at the same time
+  *
+  * For each run the following values are reported through the serial port:
+  * - Mean and maximum CPU cycles for each increment/decrement pair, the
+  * maximum includes the time spent spinning while the other core held the lock
+  * - The outputs change flag value after both tasks finished, as the increments
+  * and decrements are balanced a true value means the lock failed to provide
+  * mutual exclusion between the cores.
+  *
+  * The same load, extended to 4 threads and to the poll update against the
+  * status reads, runs on a Linux host by the LsSwtchCntntnBnch target of the
+  * extras/LsSwtchHost CMake project.
+  *
+  * Framework: Arduino
+  * Platform: ESP32, dual core models for the contended run
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 15/10/2026
+  *       Last update:   15/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+
+//==============================================>> General use definitions BEGIN
+//* This definitions are placed here for easier testing of important implementation parameters, checking the change of behavior when playing around with different values, etc.
+#define BnchTskPrrtyLvl 5
+#define BnchLoadTskPrrtyLvl 4
+#define BnchItrtnsQty 100000UL  // Increment/decrement pairs executed by each load task for each run
+#define BnchRptDlyTm 5000  // Time between benchmark runs
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+//========================================>> General use function prototypes END
+
+//======================================>> Task Callback function prototypes BEGIN
+void bnchTsk(void *pvParameters);
+void bnchLoadTsk(void *pvParameters);
+//========================================>> Task Callback function prototypes END
+
+//===========================>> Tasks Handles declarations BEGIN
+TaskHandle_t bnchTskHndl {NULL};
+//===========================>> Tasks Handles declarations END
+
+//===============================>> Global variables (strictly sanctioned) BEGIN
+struct bnchLoadRslt_t{
+   LimbsSftyLnFSwtch* lsSwtchPtr;
+   uint64_t ttlCycls;
+   uint32_t maxCycls;
+};
+bnchLoadRslt_t loadRslt[2]{};
+//=================================>> Global variables (strictly sanctioned) END
+
+limbSftyFwConf_t bnchTskConf{
+   .lsSwExecTskCore = xPortGetCoreID(),
+   .lsSwExecTskPrrtyCnfg = BnchTskPrrtyLvl,
+};
+
+void setup() {
+   Serial.begin(115200);
+   // Create the Benchmark task for setup and execution of the main code
+   xReturned = xTaskCreatePinnedToCore(
+      bnchTsk,  // Callback function/task to be called
+      "BenchmarkTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      bnchTskConf.lsSwExecTskPrrtyCnfg, // Priority level given to the task
+      &bnchTskHndl, // Task handle
+      bnchTskConf.lsSwExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void bnchTsk(void *pvParameters){
+   TickType_t loopTmrStrtTm{0};
+   TickType_t* loopTmrStrtTmPtr{&loopTmrStrtTm};
+   TickType_t totalDelay {BnchRptDlyTm};
+   uint8_t loadTsksQty{0};
+
+   swtchInptHwCfg_t lftHndHwAttrbts{.inptPin = GPIO_NUM_4};
+   swtchInptHwCfg_t rghtHndHwAttrbts{.inptPin = GPIO_NUM_2};
+   swtchInptHwCfg_t ftHwAttrbts{.inptPin = GPIO_NUM_5};
+   swtchBhvrCfg_t lftHndBhvrSUp{};
+   swtchBhvrCfg_t rghtHndBhvrSUp{};
+   swtchBhvrCfg_t ftBhvrSUp{};
+   lsSwtchSwCfg_t lsssSwtchWrkngPrm{
+      .ltchRlsActvTm = 1500,
+      .prdCyclActvTm = 6000,
+   };
+
+   // The object is not started, only its lock protected methods are exercised
+   LimbsSftyLnFSwtch bnchSftySwtch (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+   Serial.printf("LimbsSftyLnFSwtch object lock benchmark, %lu pairs per task, CPU @ %u MHz\n", BnchItrtnsQty, ESP.getCpuFreqMHz());
+
+   for(;;){
+      *loopTmrStrtTmPtr = xTaskGetTickCount() / portTICK_RATE_MS;
+
+      for(loadTsksQty = 1; loadTsksQty <= 2; ++loadTsksQty){
+         xTaskNotifyWait(0x00, 0xFFFFFFFF, NULL, 0);  // Discard any pending notification
+         for(uint8_t tskNum{0}; tskNum < loadTsksQty; ++tskNum){
+            loadRslt[tskNum] = {&bnchSftySwtch, 0, 0};
+            xReturned = xTaskCreatePinnedToCore(
+               bnchLoadTsk,
+               "BenchLoadTask",
+               2048,
+               &loadRslt[tskNum],
+               BnchLoadTskPrrtyLvl,
+               NULL,
+               tskNum   // One load task per core
+            );
+            if(xReturned != pdPASS)
+               Error_Handler();
+         }
+         for(uint8_t tskNum{0}; tskNum < loadTsksQty; ++tskNum)
+            ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+
+         for(uint8_t tskNum{0}; tskNum < loadTsksQty; ++tskNum){
+            Serial.printf("%s core %u: mean %4llu cycles | max %6lu cycles per pair\n",
+               (loadTsksQty == 1)?"Uncontended":"Contended  ", tskNum, loadRslt[tskNum].ttlCycls / BnchItrtnsQty, (unsigned long)loadRslt[tskNum].maxCycls);
+         }
+         Serial.printf("Outputs change flag after the run: %s\n", bnchSftySwtch.getLsSwtchOtptsChng()?"true -> mutual exclusion FAILED":"false -> Ok");
+      }
+      Serial.println();
+
+      vTaskDelayUntil(loopTmrStrtTmPtr, totalDelay);
+   }
+}
+
+void bnchLoadTsk(void *pvParameters){
+   bnchLoadRslt_t* rsltPtr{static_cast<bnchLoadRslt_t*>(pvParameters)};
+   uint32_t strtCycl{0};
+   uint32_t pairCycls{0};
+
+   for(unsigned long int itrtn{0}; itrtn < BnchItrtnsQty; ++itrtn){
+      strtCycl = ESP.getCycleCount();
+      rsltPtr->lsSwtchPtr->setLsSwtchOtptsChng(true);
+      rsltPtr->lsSwtchPtr->setLsSwtchOtptsChng(false);
+      pairCycls = ESP.getCycleCount() - strtCycl;
+      rsltPtr->ttlCycls += pairCycls;
+      if(rsltPtr->maxCycls < pairCycls)
+         rsltPtr->maxCycls = pairCycls;
+   }
+   xTaskNotifyGive(bnchTskHndl);
+
+   vTaskDelete(NULL);
+}
+//===============================>> User Tasks Implementations END
+
+//===============================>> User Functions Implementations BEGIN
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+  for(;;)
+  {
+  }
+
+  return;
+}
+//===============================>> User Functions Implementations END
@@ -0,0 +1,214 @@
+/**
+  ******************************************************************************
+  * @file	: LimbsSftyLnFSwtch_Bench_04.cpp
+  * @brief  : Callback dispatch task benchmark for the LimbsSftyLnFSwtch class
+  *
+  * Benchmark for the LimbsSftySw_ESP32 library LimbsSftyLnFSwtch class.
+  *
+  * This sketch sets a deliberately slow function -a busy wait- to be executed
+  * when the latch release is turned on and off, and measures the effect it has
+  * on the rest of the software timers of the system: an auxiliary 1 tick
+  * period timer registers the maximum time between two consecutive executions
+  * of its callback function. The production cycles are started by the
+  * injctInptEvnt() method, so no switch needs to be operated while the
+  * benchmark runs.
+  *
+  * For each run the following values are reported through the serial port:
+  * - Maximum auxiliary timer period measured, in microseconds. With the
+  * callback dispatch mode set the slow function is executed by the dispatch
+  * task and the timer period is kept close to the tick period, without it the
+  * timer service task is kept busy by the slow function
+  * - The callback dispatch statistics: functions dispatched, queue overflows
+  * -each one forces an emergency stop, so a non zero value stalls the next
+  * runs-, maximum queue depth, maximum queue waiting time and mean and maximum
+  * function execution time.
+  *
+  * Framework: Arduino
+  * Platform: ESP32
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 15/10/2026
+  *       Last update:   15/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+
+//==============================================>> General use definitions BEGIN
+//* This definitions are placed here for easier testing of important implementation parameters, checking the change of behavior when playing around with different values, etc.
+#define BnchTskPrrtyLvl 5
+#define CbDsptchTskPrrtyLvl 1 // Run in the benchmark task core, the slow function must not starve the benchmark task
+#define LsSwtchPollTm 20
+#define CbDsptchd true  // User functions executed by the callback dispatch task
+#define SlwFnTmUs 5000  // Time the slow function keeps the CPU busy
+#define BnchCyclsQty 20  // Quantity of production cycles executed for each run
+#define BnchRptDlyTm 5000  // Time between benchmark runs
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+void slwFn(void* argPtr);
+void auxTmrCb(TimerHandle_t auxTmrCbArg);
+//========================================>> General use function prototypes END
+
+//======================================>> Task Callback function prototypes BEGIN
+void bnchTsk(void *pvParameters);
+//========================================>> Task Callback function prototypes END
+
+//===========================>> Tasks Handles declarations BEGIN
+TaskHandle_t bnchTskHndl {NULL};
+TimerHandle_t auxTmrHndl {NULL};
+//===========================>> Tasks Handles declarations END
+
+//===============================>> Global variables (strictly sanctioned) BEGIN
+volatile int64_t auxTmrLstTmUs{0};
+volatile int64_t auxTmrMaxPrdUs{0};
+//=================================>> Global variables (strictly sanctioned) END
+
+limbSftyFwConf_t bnchTskConf{
+   .lsSwExecTskCore = xPortGetCoreID(),
+   .lsSwExecTskPrrtyCnfg = BnchTskPrrtyLvl,
+};
+
+void setup() {
+   Serial.begin(115200);
+   // Create the Benchmark task for setup and execution of the main code
+   xReturned = xTaskCreatePinnedToCore(
+      bnchTsk,  // Callback function/task to be called
+      "BenchmarkTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      bnchTskConf.lsSwExecTskPrrtyCnfg, // Priority level given to the task
+      &bnchTskHndl, // Task handle
+      bnchTskConf.lsSwExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void bnchTsk(void *pvParameters){
+   TickType_t loopTmrStrtTm{0};
+   TickType_t* loopTmrStrtTmPtr{&loopTmrStrtTm};
+   TickType_t totalDelay {BnchRptDlyTm};
+   fncVdPtrPrmPtrType slwFnPtr{slwFn};
+   lsSwtchCbDsptchStts_t cbDsptchStts{};
+   limbSftyFwConf_t cbDsptchTskConf{
+      .lsSwExecTskCore = xPortGetCoreID(),
+      .lsSwExecTskPrrtyCnfg = CbDsptchTskPrrtyLvl,
+   };
+
+   swtchInptHwCfg_t lftHndHwAttrbts{.inptPin = GPIO_NUM_4};
+   swtchInptHwCfg_t rghtHndHwAttrbts{.inptPin = GPIO_NUM_2};
+   swtchInptHwCfg_t ftHwAttrbts{.inptPin = GPIO_NUM_5};
+   swtchBhvrCfg_t lftHndBhvrSUp{
+      .swtchStrtDlyTm = 50,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t rghtHndBhvrSUp{
+      .swtchStrtDlyTm = 50,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t ftBhvrSUp{
+      .swtchStrtDlyTm = 0,
+      .swtchIsEnbld = false,
+   };
+   lsSwtchSwCfg_t lsssSwtchWrkngPrm{
+      .ltchRlsActvTm = 100,
+      .prdCyclActvTm = 200,
+   };
+
+   LimbsSftyLnFSwtch bnchSftySwtch (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+   bnchSftySwtch.setFnWhnTrnOnLtchRlsPtr(slwFnPtr);
+   bnchSftySwtch.setFnWhnTrnOffLtchRlsPtr(slwFnPtr);
+   if(!bnchSftySwtch.setEvntDrvn(true))
+      Error_Handler();
+   if(!bnchSftySwtch.setCbDsptchd(CbDsptchd, cbDsptchTskConf))
+      Error_Handler();
+   if(!bnchSftySwtch.begin(LsSwtchPollTm))
+      Error_Handler();
+   bnchSftySwtch.setTskToNtfyTrnOffPrdCycl(bnchTskHndl);
+
+   auxTmrHndl = xTimerCreate("AuxTimer", 1, pdTRUE, NULL, auxTmrCb);
+   if((auxTmrHndl == NULL) || (xTimerStart(auxTmrHndl, portMAX_DELAY) != pdPASS))
+      Error_Handler();
+
+   Serial.printf("LimbsSftyLnFSwtch callback dispatch benchmark, %u cycles per run, slow function %u us, dispatch %s\n", BnchCyclsQty, SlwFnTmUs, CbDsptchd?"ON":"OFF");
+
+   for(;;){
+      *loopTmrStrtTmPtr = xTaskGetTickCount() / portTICK_RATE_MS;
+      bnchSftySwtch.rstCbDsptchStts();
+      auxTmrMaxPrdUs = 0;
+
+      for(int cyclNum{0}; cyclNum < BnchCyclsQty; ++cyclNum){
+         xTaskNotifyWait(0x00, 0xFFFFFFFF, NULL, 0);  // Discard any pending notification
+         bnchSftySwtch.injctInptEvnt(lftHndInptId, true);
+         bnchSftySwtch.injctInptEvnt(rghtHndInptId, true);
+         vTaskDelay(pdMS_TO_TICKS(_HwMinDbncTime + lftHndBhvrSUp.swtchStrtDlyTm + 2 * LsSwtchPollTm)); // Both hands debounced and out of the start delay, foot switch enabled
+         bnchSftySwtch.injctInptEvnt(ftInptId, true);
+         vTaskDelay(pdMS_TO_TICKS(_HwMinDbncTime + LsSwtchPollTm));
+         bnchSftySwtch.injctInptEvnt(ftInptId, false);
+         bnchSftySwtch.injctInptEvnt(lftHndInptId, false);
+         bnchSftySwtch.injctInptEvnt(rghtHndInptId, false);
+         xTaskNotifyWait(0x00, 0xFFFFFFFF, NULL, pdMS_TO_TICKS(lsssSwtchWrkngPrm.prdCyclActvTm + 1000)); // Production cycle end
+      }
+
+      bnchSftySwtch.getCbDsptchStts(cbDsptchStts);
+      Serial.printf("Auxiliary 1 tick timer maximum period: %6lld us (tick period %u us)\n", auxTmrMaxPrdUs, portTICK_PERIOD_MS * 1000);
+      Serial.printf("Dispatched %lu | overflows %lu | max queue depth %lu | max queue wait %lu us | exec mean %llu us max %lu us\n\n",
+         (unsigned long)cbDsptchStts.dsptchdQty, (unsigned long)cbDsptchStts.ovrflwQty, (unsigned long)cbDsptchStts.maxQueDpth, (unsigned long)cbDsptchStts.maxQueWtTmUs,
+         cbDsptchStts.dsptchdQty?(cbDsptchStts.ttlExctTmUs / cbDsptchStts.dsptchdQty):0ULL, (unsigned long)cbDsptchStts.maxExctTmUs);
+
+      vTaskDelayUntil(loopTmrStrtTmPtr, totalDelay);
+   }
+}
+//===============================>> User Tasks Implementations END
+
+//===============================>> User Functions Implementations BEGIN
+void slwFn(void* argPtr){
+   int64_t strtTm{esp_timer_get_time()};
+
+   while((esp_timer_get_time() - strtTm) < SlwFnTmUs){
+   }
+
+   return;
+}
+
+void auxTmrCb(TimerHandle_t auxTmrCbArg){
+   int64_t curTm{esp_timer_get_time()};
+
+   if((auxTmrLstTmUs != 0) && ((curTm - auxTmrLstTmUs) > auxTmrMaxPrdUs))
+      auxTmrMaxPrdUs = curTm - auxTmrLstTmUs;
+   auxTmrLstTmUs = curTm;
+
+   return;
+}
+
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+  for(;;)
+  {
+  }
+
+  return;
+}
+//===============================>> User Functions Implementations END
@@ -0,0 +1,186 @@
+/**
+  ******************************************************************************
+  * @file	: LimbsSftyLnFSwtch_Bench_05.cpp
+  * @brief  : Per station update cost benchmark for the LsSwtchGrp class
+  *
+  * Benchmark for the LimbsSftySw_ESP32 library LsSwtchGrp class.
+  *
+  * This sketch measures the CPU cost of the single update pass a LsSwtchGrp
+  * object executes at each of its timer expirations -one GPIO input registers
+  * sample, then one FDA step for each grouped station- for groups of 1, 2, 4,
+  * 8 and 16 LimbsSftyLnFSwtch objects. With the VrtclDbnc definition set the
+  * inputs are debounced by the group's bit-parallel vertical counters, whose
+  * cost is the same for any quantity of inputs, instead of by each object.
+  *
+  * For each group size the following values are reported through the serial
+  * port:
+  * - Mean and maximum CPU cycles of the whole update pass
+  * - Mean CPU cycles per station
+  * - Software timers used by the group, compared to the timers used by the same
+  * quantity of independently started LimbsSftyLnFSwtch objects (four each).
+  *
+  * The update pass is executed directly by the benchmark task -through a
+  * LsSwtchGrp subclass exposing it- instead of by the group's timer, so the
+  * measurement doesn't include the timer service task overhead, that is
+  * proportional to the quantity of timers.
+  *
+  * Framework: Arduino
+  * Platform: ESP32
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 15/10/2026
+  *       Last update:   15/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+
+//==============================================>> General use definitions BEGIN
+//* This definitions are placed here for easier testing of important implementation parameters, checking the change of behavior when playing around with different values, etc.
+#define BnchTskPrrtyLvl 5
+#define LsSwtchGrpPollTm 20
+#define VrtclDbnc true   // Inputs debounced by the group's vertical counters
+#define BnchItrtnsQty 1000UL  // Update passes measured for each group size
+#define BnchRptDlyTm 5000  // Time between benchmark runs
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+//========================================>> General use function prototypes END
+
+//======================================>> Task Callback function prototypes BEGIN
+void bnchTsk(void *pvParameters);
+//========================================>> Task Callback function prototypes END
+
+//===========================>> Tasks Handles declarations BEGIN
+TaskHandle_t bnchTskHndl {NULL};
+//===========================>> Tasks Handles declarations END
+
+//===============================>> Classes declarations BEGIN
+/**
+ * @brief LsSwtchGrp subclass exposing the update pass executed at each timer expiration
+ */
+class BnchLsSwtchGrp: public LsSwtchGrp{
+public:
+   bool cnfgDbnc(){
+      bool result{setVrtclDbnc(VrtclDbnc)};
+
+      if(result && VrtclDbnc)
+         result = _cnfgVrtclDbnc(LsSwtchGrpPollTm);
+
+      return result;
+   }
+   void updGrp(){
+      _updLsSwtchGrp();
+
+      return;
+   }
+};
+//=================================>> Classes declarations END
+
+limbSftyFwConf_t bnchTskConf{
+   .lsSwExecTskCore = xPortGetCoreID(),
+   .lsSwExecTskPrrtyCnfg = BnchTskPrrtyLvl,
+};
+
+void setup() {
+   Serial.begin(115200);
+   // Create the Benchmark task for setup and execution of the main code
+   xReturned = xTaskCreatePinnedToCore(
+      bnchTsk,  // Callback function/task to be called
+      "BenchmarkTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      bnchTskConf.lsSwExecTskPrrtyCnfg, // Priority level given to the task
+      &bnchTskHndl, // Task handle
+      bnchTskConf.lsSwExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void bnchTsk(void *pvParameters){
+   TickType_t loopTmrStrtTm{0};
+   TickType_t* loopTmrStrtTmPtr{&loopTmrStrtTm};
+   TickType_t totalDelay {BnchRptDlyTm};
+   LimbsSftyLnFSwtch* sttnsPtrs[_maxLsSwtchGrpSz]{};
+   BnchLsSwtchGrp* bnchGrpPtr{nullptr};
+   uint32_t strtCycl{0};
+   uint32_t passCycls{0};
+   uint64_t ttlCycls{0};
+   uint32_t maxCycls{0};
+
+   // All the stations share the same pins, only the update cost is measured
+   swtchInptHwCfg_t lftHndHwAttrbts{.inptPin = GPIO_NUM_4};
+   swtchInptHwCfg_t rghtHndHwAttrbts{.inptPin = GPIO_NUM_2};
+   swtchInptHwCfg_t ftHwAttrbts{.inptPin = GPIO_NUM_5};
+   swtchBhvrCfg_t lftHndBhvrSUp{};
+   swtchBhvrCfg_t rghtHndBhvrSUp{};
+   swtchBhvrCfg_t ftBhvrSUp{};
+   lsSwtchSwCfg_t lsssSwtchWrkngPrm{};
+
+   for(uint8_t sttnIdx{0}; sttnIdx < _maxLsSwtchGrpSz; ++sttnIdx)
+      sttnsPtrs[sttnIdx] = new LimbsSftyLnFSwtch(lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+   Serial.printf("LsSwtchGrp update pass benchmark, %lu passes per group size, %s debouncing, CPU @ %u MHz\n", BnchItrtnsQty, VrtclDbnc?"vertical counters":"per input", ESP.getCpuFreqMHz());
+
+   for(;;){
+      *loopTmrStrtTmPtr = xTaskGetTickCount() / portTICK_RATE_MS;
+
+      for(uint8_t sttnsQty{1}; sttnsQty <= _maxLsSwtchGrpSz; sttnsQty *= 2){
+         bnchGrpPtr = new BnchLsSwtchGrp();
+         for(uint8_t sttnIdx{0}; sttnIdx < sttnsQty; ++sttnIdx){
+            if(!bnchGrpPtr->addLsSwtch(sttnsPtrs[sttnIdx]))
+               Error_Handler();
+         }
+         if(!bnchGrpPtr->cnfgDbnc())
+            Error_Handler();
+         ttlCycls = 0;
+         maxCycls = 0;
+         for(unsigned long int itrtn{0}; itrtn < BnchItrtnsQty; ++itrtn){
+            strtCycl = ESP.getCycleCount();
+            bnchGrpPtr->updGrp();
+            passCycls = ESP.getCycleCount() - strtCycl;
+            ttlCycls += passCycls;
+            if(maxCycls < passCycls)
+               maxCycls = passCycls;
+         }
+         Serial.printf("%2u stations: pass mean %7llu cycles | max %7lu cycles | per station %6llu cycles | timers %u (%2u independent)\n",
+            sttnsQty, ttlCycls / BnchItrtnsQty, (unsigned long)maxCycls, (ttlCycls / BnchItrtnsQty) / sttnsQty, 1, 4 * sttnsQty);
+
+         delete bnchGrpPtr;   // The stations are released, to be added to the next group
+      }
+      Serial.println();
+
+      vTaskDelayUntil(loopTmrStrtTmPtr, totalDelay);
+   }
+}
+//===============================>> User Tasks Implementations END
+
+//===============================>> User Functions Implementations BEGIN
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+  for(;;)
+  {
+  }
+
+  return;
+}
+//===============================>> User Functions Implementations END
@@ -0,0 +1,201 @@
+/**
+  ******************************************************************************
+  * @file	: LimbsSftyLnFSwtch_Bench_06.cpp
+  * @brief  : Heap use benchmark for the LimbsSftyLnFSwtch class static allocation build
+  *
+  * Benchmark for the LimbsSftySw_ESP32 library LimbsSftyLnFSwtch class.
+  *
+  * This sketch reports the heap memory used by a LimbsSftyLnFSwtch object along
+  * its life: construction, begin() and a long sequence of production cycles.
+  * The object is declared as a static local variable, so it's placed in the
+  * .bss section and the heap use measured is the one produced by the object
+  * code alone.
+  *
+  * The library must be built with the _lsSwtchStcAlloc flag set to 1 as a
+  * project wide build flag (i.e. PlatformIO "build_flags = -D_lsSwtchStcAlloc=1")
+  * for the zero heap construction, as the flag changes the class layout it can't
+  * be set by a #define in the sketch. Building without it shows the heap use of
+  * the standard build for comparison.
+  *
+  * The object is set to the event driven mode and the inputs are produced by the
+  * injctInptEvnt() method, so the underlying DbncdMPBttn subclasses objects
+  * -whose timers belong to the ButtonToSwitch_ESP32 library- are not started.
+  *
+  * For each run the following values are reported through the serial port:
+  * - The compile time reported RAM footprint of the object, lsSwtchRamFtprnt
+  * - Free heap and allocated heap blocks after the construction, the begin()
+  * and each run of production cycles, with the difference to the values
+  * measured before the construction.
+  *
+  * Framework: Arduino
+  * Platform: ESP32
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 15/10/2026
+  *       Last update:   15/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+
+//==============================================>> General use definitions BEGIN
+//* This definitions are placed here for easier testing of important implementation parameters, checking the change of behavior when playing around with different values, etc.
+#define BnchTskPrrtyLvl 5
+#define LsSwtchPollTm 20
+#define CbDsptchd true  // Callback dispatch task created by begin()
+#define BnchCyclsQty 20  // Production cycles executed for each run
+#define BnchRptDlyTm 5000  // Time between benchmark runs
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+void prntHeapUse(const char* stgName, const multi_heap_info_t &refHeapInfo);
+void trnOnLtchRls(void* argPtr);
+//========================================>> General use function prototypes END
+
+//======================================>> Task Callback function prototypes BEGIN
+void bnchTsk(void *pvParameters);
+//========================================>> Task Callback function prototypes END
+
+//===========================>> Tasks Handles declarations BEGIN
+TaskHandle_t bnchTskHndl {NULL};
+//===========================>> Tasks Handles declarations END
+
+limbSftyFwConf_t bnchTskConf{
+   .lsSwExecTskCore = xPortGetCoreID(),
+   .lsSwExecTskPrrtyCnfg = BnchTskPrrtyLvl,
+};
+
+void setup() {
+   Serial.begin(115200);
+   xReturned = xTaskCreatePinnedToCore(
+      bnchTsk,  // Callback function/task to be called
+      "BenchmarkTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      bnchTskConf.lsSwExecTskPrrtyCnfg, // Priority level given to the task
+      &bnchTskHndl, // Task handle
+      bnchTskConf.lsSwExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void bnchTsk(void *pvParameters){
+   TickType_t loopTmrStrtTm{0};
+   TickType_t* loopTmrStrtTmPtr{&loopTmrStrtTm};
+   TickType_t totalDelay {BnchRptDlyTm};
+   multi_heap_info_t refHeapInfo{};
+   unsigned long int runNum{0};
+   char stgName[24]{};
+   fncVdPtrPrmPtrType trnOnLtchRlsPtr{trnOnLtchRls};
+
+   swtchInptHwCfg_t lftHndHwAttrbts{.inptPin = GPIO_NUM_4};
+   swtchInptHwCfg_t rghtHndHwAttrbts{.inptPin = GPIO_NUM_2};
+   swtchInptHwCfg_t ftHwAttrbts{.inptPin = GPIO_NUM_5};
+   swtchBhvrCfg_t lftHndBhvrSUp{
+      .swtchStrtDlyTm = 50,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t rghtHndBhvrSUp{
+      .swtchStrtDlyTm = 50,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t ftBhvrSUp{
+      .swtchStrtDlyTm = 0,
+      .swtchIsEnbld = false,
+   };
+   lsSwtchSwCfg_t lsssSwtchWrkngPrm{
+      .ltchRlsActvTm = 50,
+      .prdCyclActvTm = 100,
+   };
+
+   Serial.printf("LimbsSftyLnFSwtch heap use benchmark, %s build, lsSwtchRamFtprnt: %u bytes\n", _lsSwtchStcAlloc?"static allocation":"standard", lsSwtchRamFtprnt);
+   heap_caps_get_info(&refHeapInfo, MALLOC_CAP_8BIT);
+   prntHeapUse("Before construction", refHeapInfo);
+
+   static LimbsSftyLnFSwtch bnchSftySwtch (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+   prntHeapUse("After construction", refHeapInfo);
+
+   if(!bnchSftySwtch.setEvntDrvn(true))
+      Error_Handler();
+   if(!bnchSftySwtch.setPhsTmrDrvn(true))
+      Error_Handler();
+   if(!bnchSftySwtch.setCbDsptchd(CbDsptchd))
+      Error_Handler();
+   if(!bnchSftySwtch.begin(LsSwtchPollTm))
+      Error_Handler();
+   bnchSftySwtch.setFnWhnTrnOnLtchRlsPtr(trnOnLtchRlsPtr);
+   bnchSftySwtch.setTskToNtfyTrnOffPrdCycl(bnchTskHndl);
+   prntHeapUse("After begin()", refHeapInfo);
+
+   for(;;){
+      *loopTmrStrtTmPtr = xTaskGetTickCount() / portTICK_RATE_MS;
+
+      for(int cyclNum{0}; cyclNum < BnchCyclsQty; ++cyclNum){
+         xTaskNotifyWait(0x00, 0xFFFFFFFF, NULL, 0);  // Discard any pending notification
+         bnchSftySwtch.injctInptEvnt(lftHndInptId, true);
+         bnchSftySwtch.injctInptEvnt(rghtHndInptId, true);
+         vTaskDelay(pdMS_TO_TICKS(_HwMinDbncTime + lftHndBhvrSUp.swtchStrtDlyTm + 2 * LsSwtchPollTm));
+         bnchSftySwtch.injctInptEvnt(ftInptId, true);
+         vTaskDelay(pdMS_TO_TICKS(_HwMinDbncTime + 2 * LsSwtchPollTm));
+         bnchSftySwtch.injctInptEvnt(ftInptId, false);
+         bnchSftySwtch.injctInptEvnt(lftHndInptId, false);
+         bnchSftySwtch.injctInptEvnt(rghtHndInptId, false);
+         xTaskNotifyWait(0x00, 0xFFFFFFFF, NULL, pdMS_TO_TICKS(lsssSwtchWrkngPrm.ltchRlsActvTm + lsssSwtchWrkngPrm.prdCyclActvTm + 1000)); // Production cycle end
+      }
+      ++runNum;
+      snprintf(stgName, sizeof(stgName), "After %lu cycles", runNum * BnchCyclsQty);
+      prntHeapUse(stgName, refHeapInfo);
+
+      vTaskDelayUntil(loopTmrStrtTmPtr, totalDelay);
+   }
+}
+//===============================>> User Tasks Implementations END
+
+//===============================>> User Functions Implementations BEGIN
+void prntHeapUse(const char* stgName, const multi_heap_info_t &refHeapInfo){
+   multi_heap_info_t curHeapInfo{};
+
+   heap_caps_get_info(&curHeapInfo, MALLOC_CAP_8BIT);
+   Serial.printf("%-20s: free heap %7u bytes (%+6d) | allocated blocks %5u (%+4d)\n",
+      stgName, curHeapInfo.total_free_bytes, static_cast<int>(curHeapInfo.total_free_bytes) - static_cast<int>(refHeapInfo.total_free_bytes),
+      curHeapInfo.allocated_blocks, static_cast<int>(curHeapInfo.allocated_blocks) - static_cast<int>(refHeapInfo.allocated_blocks));
+
+   return;
+}
+
+void trnOnLtchRls(void* argPtr){
+   // Executed by the callback dispatch task, any heap use by the dispatch path would show in the report
+
+   return;
+}
+
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+  for(;;)
+  {
+  }
+
+  return;
+}
+//===============================>> User Functions Implementations END
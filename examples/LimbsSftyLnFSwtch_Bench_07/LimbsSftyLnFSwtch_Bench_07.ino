@@ -0,0 +1,186 @@
+/**
+  ******************************************************************************
+  * @file	: LimbsSftyLnFSwtch_Bench_07.cpp
+  * @brief  : Update stages timing benchmark for the LimbsSftyLnFSwtch class
+  *
+  * Benchmark for the LimbsSftySw_ESP32 library LimbsSftyLnFSwtch class.
+  *
+  * This sketch reports how much of the poll period budget each stage of the
+  * object update takes, and how long the interrupts stay masked by the update,
+  * from the timing histograms kept by the object.
+  *
+  * The library must be built with the _lsSwtchPrfInstr flag set to 1 as a
+  * project wide build flag (i.e. PlatformIO "build_flags = -D_lsSwtchPrfInstr=1"),
+  * as the flag changes the class layout it can't be set by a #define in the
+  * sketch. Without it the instrumentation is compiled out and the sketch only
+  * reports it's not available.
+  *
+  * The object runs in the fixed period polling mode, the switches connected
+  * to the configured pins might be operated while the benchmark runs to time
+  * the updates that produce state changes.
+  *
+  * For each run and each update stage the following values are reported
+  * through the serial port:
+  * - Quantity of updates timed
+  * - Minimum, mean and maximum duration, in microseconds
+  * - 99th percentile duration upper bound, in microseconds, from the logarithmic
+  * histogram: the upper limit of the bucket holding the 99th percentile
+  * - Mean duration as a percentage of the poll period
+  *
+  * Framework: Arduino
+  * Platform: ESP32
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 15/10/2026
+  *       Last update:   15/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+
+//==============================================>> General use definitions BEGIN
+//* This definitions are placed here for easier testing of important implementation parameters, checking the change of behavior when playing around with different values, etc.
+#define BnchTskPrrtyLvl 5
+#define UndrlyngMPBttnPollTm 20
+#define LsSwtchPollTm 20
+#define BnchRptDlyTm 10000  // Time between benchmark reports, the histograms are reset after each report
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+void prntPrfHstgrm(const char* stgName, const lsSwtchPrfHstgrm_t &hstgrm, const uint32_t &tcksPerUs);
+//========================================>> General use function prototypes END
+
+//======================================>> Task Callback function prototypes BEGIN
+void bnchTsk(void *pvParameters);
+//========================================>> Task Callback function prototypes END
+
+//===========================>> Tasks Handles declarations BEGIN
+TaskHandle_t bnchTskHndl {NULL};
+//===========================>> Tasks Handles declarations END
+
+limbSftyFwConf_t bnchTskConf{
+   .lsSwExecTskCore = xPortGetCoreID(),
+   .lsSwExecTskPrrtyCnfg = BnchTskPrrtyLvl,
+};
+
+void setup() {
+   Serial.begin(115200);
+   xReturned = xTaskCreatePinnedToCore(
+      bnchTsk,  // Callback function/task to be called
+      "BenchmarkTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      bnchTskConf.lsSwExecTskPrrtyCnfg, // Priority level given to the task
+      &bnchTskHndl, // Task handle
+      bnchTskConf.lsSwExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void bnchTsk(void *pvParameters){
+   TickType_t loopTmrStrtTm{0};
+   TickType_t* loopTmrStrtTmPtr{&loopTmrStrtTm};
+   TickType_t totalDelay {BnchRptDlyTm};
+   const char* prfStgNames[_prfStgsQty]{"Underlying switches", "Time base", "FDA", "Status publication", "Notifications", "Lock held", "Whole update"};
+   lsSwtchPrfHstgrm_t prfHstgrm{};
+   const uint32_t tcksPerUs{LimbsSftyLnFSwtch::getPrfTcksPerUs()};
+
+   swtchInptHwCfg_t lftHndHwAttrbts{.inptPin = GPIO_NUM_4};
+   swtchInptHwCfg_t rghtHndHwAttrbts{.inptPin = GPIO_NUM_2};
+   swtchInptHwCfg_t ftHwAttrbts{.inptPin = GPIO_NUM_5};
+   swtchBhvrCfg_t lftHndBhvrSUp{
+      .swtchStrtDlyTm = 50,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t rghtHndBhvrSUp{
+      .swtchStrtDlyTm = 50,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t ftBhvrSUp{
+      .swtchStrtDlyTm = 0,
+      .swtchIsEnbld = false,
+   };
+   lsSwtchSwCfg_t lsssSwtchWrkngPrm{
+      .ltchRlsActvTm = 1500,
+      .prdCyclActvTm = 6000,
+   };
+
+   LimbsSftyLnFSwtch bnchSftySwtch (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+   bnchSftySwtch.setUndrlSwtchsPollDelay(UndrlyngMPBttnPollTm);
+   if(!bnchSftySwtch.begin(LsSwtchPollTm))
+      Error_Handler();
+
+   Serial.printf("LimbsSftyLnFSwtch update stages timing benchmark, poll period %u ms, CPU @ %u MHz\n", LsSwtchPollTm, ESP.getCpuFreqMHz());
+   if(!bnchSftySwtch.getPrfHstgrm(updTtlPrfStgId, prfHstgrm)){
+      Serial.println("Update stages timing not available, build the library with the _lsSwtchPrfInstr flag set to 1");
+      vTaskDelete(NULL);
+   }
+
+   for(;;){
+      *loopTmrStrtTmPtr = xTaskGetTickCount() / portTICK_RATE_MS;
+      bnchSftySwtch.rstPrfHstgrms();
+      vTaskDelayUntil(loopTmrStrtTmPtr, totalDelay);
+
+      for(uint8_t prfStgId{0}; prfStgId < _prfStgsQty; ++prfStgId){
+         if(bnchSftySwtch.getPrfHstgrm(prfStgId, prfHstgrm))
+            prntPrfHstgrm(prfStgNames[prfStgId], prfHstgrm, tcksPerUs);
+      }
+      Serial.println();
+   }
+}
+//===============================>> User Tasks Implementations END
+
+//===============================>> User Functions Implementations BEGIN
+void prntPrfHstgrm(const char* stgName, const lsSwtchPrfHstgrm_t &hstgrm, const uint32_t &tcksPerUs){
+   uint32_t bcktsSmplsQty{0};
+   uint8_t p99BcktIdx{0};
+   float meanUs{0.0};
+
+   if(hstgrm.smplsQty > 0){
+      // The 99th percentile lays in the first bucket reaching the 99% of the samples
+      for(p99BcktIdx = 0; p99BcktIdx < _prfHstgrmBcktsQty - 1; ++p99BcktIdx){
+         bcktsSmplsQty += hstgrm.bckts[p99BcktIdx];
+         if(bcktsSmplsQty * 100ULL >= hstgrm.smplsQty * 99ULL)
+            break;
+      }
+      meanUs = static_cast<float>(hstgrm.ttlTcks) / hstgrm.smplsQty / tcksPerUs;
+      Serial.printf("%-20s: %6lu updates | min %8.2f us | mean %8.2f us | p99 < %8.2f us | max %8.2f us | %5.2f%% of the poll period\n",
+         stgName, (unsigned long)hstgrm.smplsQty, static_cast<float>(hstgrm.minTcks) / tcksPerUs, meanUs,
+         static_cast<float>(2ULL << p99BcktIdx) / tcksPerUs, static_cast<float>(hstgrm.maxTcks) / tcksPerUs,
+         meanUs * 100.0 / (LsSwtchPollTm * 1000.0));
+   }
+
+   return;
+}
+
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+  for(;;)
+  {
+  }
+
+  return;
+}
+//===============================>> User Functions Implementations END
@@ -0,0 +1,234 @@
+/**
+  ******************************************************************************
+  * @file	: LimbsSftyLnFSwtch_Bench_08.cpp
+  * @brief  : Output stage latency benchmark for the LimbsSftyLnFSwtch class
+  *
+  * Benchmark for the LimbsSftySw_ESP32 library LimbsSftyLnFSwtch class.
+  *
+  * This sketch compares the latency between the foot switch press edge and the
+  * latch release output pin activation for the two ways of driving the output:
+  * - The object's output stage, set by the setOtptPins() method, writing the
+  * pin from the object's update code right after the FDA step
+  * - A user task unblocked by the latch release turn on notification, writing
+  * the pin afterwards, as done by the examples without an output stage
+  *
+  * The output stage writes are passed through a writer function set by the
+  * setOtptPinsWrtr() method, that time stamps them before writing the GPIO
+  * registers, the same mechanism a host test harness uses to attach a GPIO
+  * mock. The input edges are produced by the injctInptEvnt() method, so no
+  * switch needs to be operated while the benchmark runs.
+  *
+  * For each run the following values are reported through the serial port:
+  * - Mean and maximum latency, in microseconds, from the foot press edge
+  * injection to the output stage latch release pin write
+  * - Mean and maximum latency, in microseconds, from the foot press edge
+  * injection to the benchmark task being unblocked by the latch release turn on
+  * notification, the earliest a task could write the pin
+  *
+  * Framework: Arduino
+  * Platform: ESP32
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 15/10/2026
+  *       Last update:   15/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+
+//==============================================>> General use definitions BEGIN
+//* This definitions are placed here for easier testing of important implementation parameters, checking the change of behavior when playing around with different values, etc.
+#define BnchTskPrrtyLvl 5
+#define LsSwtchPollTm 20
+#define LtchRlsOtptPin GPIO_NUM_23
+#define PrdCyclOtptPin GPIO_NUM_22
+#define BnchSmplsQty 200  // Quantity of production cycles measured for each run
+#define BnchRptDlyTm 5000  // Time between benchmark runs
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+void wrtOtptPins(uint64_t stPinsMsk, uint64_t clrPinsMsk, void* argPtr);
+//========================================>> General use function prototypes END
+
+//======================================>> Task Callback function prototypes BEGIN
+void bnchTsk(void *pvParameters);
+//========================================>> Task Callback function prototypes END
+
+//===========================>> Tasks Handles declarations BEGIN
+TaskHandle_t bnchTskHndl {NULL};
+//===========================>> Tasks Handles declarations END
+
+//===============================>> Global variables (strictly sanctioned) BEGIN
+volatile int64_t ltchRlsPinStTm{0};   // Time of the last output stage write setting the latch release pin
+//=================================>> Global variables (strictly sanctioned) END
+
+limbSftyFwConf_t bnchTskConf{
+   .lsSwExecTskCore = xPortGetCoreID(),
+   .lsSwExecTskPrrtyCnfg = BnchTskPrrtyLvl,
+};
+
+void setup() {
+   Serial.begin(115200);
+   xReturned = xTaskCreatePinnedToCore(
+      bnchTsk,  // Callback function/task to be called
+      "BenchmarkTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      bnchTskConf.lsSwExecTskPrrtyCnfg, // Priority level given to the task
+      &bnchTskHndl, // Task handle
+      bnchTskConf.lsSwExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void bnchTsk(void *pvParameters){
+   TickType_t loopTmrStrtTm{0};
+   TickType_t* loopTmrStrtTmPtr{&loopTmrStrtTm};
+   TickType_t totalDelay {BnchRptDlyTm};
+   int64_t ftPrssTm{0};
+   int64_t otptStgLtncy{0};
+   int64_t ttlOtptStgLtncy{0};
+   int64_t maxOtptStgLtncy{0};
+   int64_t ntfctnLtncy{0};
+   int64_t ttlNtfctnLtncy{0};
+   int64_t maxNtfctnLtncy{0};
+   int smplsQty{0};
+
+   swtchInptHwCfg_t lftHndHwAttrbts{.inptPin = GPIO_NUM_4};
+   swtchInptHwCfg_t rghtHndHwAttrbts{.inptPin = GPIO_NUM_2};
+   swtchInptHwCfg_t ftHwAttrbts{.inptPin = GPIO_NUM_5};
+   swtchBhvrCfg_t lftHndBhvrSUp{
+      .swtchStrtDlyTm = 50,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t rghtHndBhvrSUp{
+      .swtchStrtDlyTm = 50,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t ftBhvrSUp{
+      .swtchStrtDlyTm = 0,
+      .swtchIsEnbld = false,
+   };
+   lsSwtchSwCfg_t lsssSwtchWrkngPrm{
+      .ltchRlsActvTm = 100,
+      .prdCyclActvTm = 200,
+   };
+   gpioPinOtptHwCfg_t ltchRlsIsOnOtpt{
+      .gpioOtptPin = LtchRlsOtptPin,
+      .gpioOtptActHgh = true,
+   };
+   gpioPinOtptHwCfg_t prdCyclIsOnOtpt{
+      .gpioOtptPin = PrdCyclOtptPin,
+      .gpioOtptActHgh = true,
+   };
+
+   LimbsSftyLnFSwtch bnchSftySwtch (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+   // The writer function must be set before the output stage pins
+   if(!bnchSftySwtch.setOtptPinsWrtr(wrtOtptPins))
+      Error_Handler();
+   pinMode(LtchRlsOtptPin, OUTPUT);
+   pinMode(PrdCyclOtptPin, OUTPUT);
+   if(!bnchSftySwtch.setOtptPins(ltchRlsIsOnOtpt, prdCyclIsOnOtpt))
+      Error_Handler();
+   if(!bnchSftySwtch.setEvntDrvn(true))
+      Error_Handler();
+   if(!bnchSftySwtch.begin(LsSwtchPollTm))
+      Error_Handler();
+   bnchSftySwtch.setTskToNtfyTrnOnLtchRls(bnchTskHndl);
+   bnchSftySwtch.setTskToNtfyTrnOffPrdCycl(bnchTskHndl);
+
+   Serial.printf("LimbsSftyLnFSwtch output stage latency benchmark, %u cycles per run, CPU @ %u MHz\n", BnchSmplsQty, ESP.getCpuFreqMHz());
+
+   for(;;){
+      *loopTmrStrtTmPtr = xTaskGetTickCount() / portTICK_RATE_MS;
+      smplsQty = 0;
+      ttlOtptStgLtncy = 0;
+      maxOtptStgLtncy = 0;
+      ttlNtfctnLtncy = 0;
+      maxNtfctnLtncy = 0;
+
+      for(int smplNum{0}; smplNum < BnchSmplsQty; ++smplNum){
+         xTaskNotifyWait(0x00, 0xFFFFFFFF, NULL, 0);  // Discard any pending notification
+         bnchSftySwtch.injctInptEvnt(lftHndInptId, true);
+         bnchSftySwtch.injctInptEvnt(rghtHndInptId, true);
+         vTaskDelay(pdMS_TO_TICKS(_HwMinDbncTime + lftHndBhvrSUp.swtchStrtDlyTm + 2 * LsSwtchPollTm)); // Both hands debounced and out of the start delay, foot switch enabled
+
+         ltchRlsPinStTm = 0;
+         ftPrssTm = esp_timer_get_time();
+         bnchSftySwtch.injctInptEvnt(ftInptId, true);
+         if(xTaskNotifyWait(0x00, 0xFFFFFFFF, NULL, pdMS_TO_TICKS(1000)) == pdPASS){
+            ntfctnLtncy = esp_timer_get_time() - ftPrssTm;
+            otptStgLtncy = ltchRlsPinStTm - ftPrssTm;
+            ttlNtfctnLtncy += ntfctnLtncy;
+            ttlOtptStgLtncy += otptStgLtncy;
+            if(maxNtfctnLtncy < ntfctnLtncy)
+               maxNtfctnLtncy = ntfctnLtncy;
+            if(maxOtptStgLtncy < otptStgLtncy)
+               maxOtptStgLtncy = otptStgLtncy;
+            ++smplsQty;
+         }
+
+         bnchSftySwtch.injctInptEvnt(ftInptId, false);
+         bnchSftySwtch.injctInptEvnt(lftHndInptId, false);
+         bnchSftySwtch.injctInptEvnt(rghtHndInptId, false);
+         xTaskNotifyWait(0x00, 0xFFFFFFFF, NULL, pdMS_TO_TICKS(lsssSwtchWrkngPrm.prdCyclActvTm + 1000)); // Production cycle end
+      }
+
+      if(smplsQty > 0){
+         Serial.printf("Foot press to latch release pin, output stage: mean %6lld us | max %6lld us\n", ttlOtptStgLtncy / smplsQty, maxOtptStgLtncy);
+         Serial.printf("Foot press to latch release notified task:    mean %6lld us | max %6lld us | %d/%d cycles completed\n\n",
+            ttlNtfctnLtncy / smplsQty, maxNtfctnLtncy, smplsQty, BnchSmplsQty);
+      }
+      else{
+         Serial.println("No production cycle completed, check the configuration parameters");
+      }
+
+      vTaskDelayUntil(loopTmrStrtTmPtr, totalDelay);
+   }
+}
+//===============================>> User Tasks Implementations END
+
+//===============================>> User Functions Implementations BEGIN
+void wrtOtptPins(uint64_t stPinsMsk, uint64_t clrPinsMsk, void* argPtr){
+   // Executed by the object's update code holding the object lock: time stamp and write the registers, nothing else
+   if(stPinsMsk & (static_cast<uint64_t>(1) << LtchRlsOtptPin))
+      ltchRlsPinStTm = esp_timer_get_time();
+   if(static_cast<uint32_t>(stPinsMsk) != 0)
+      REG_WRITE(GPIO_OUT_W1TS_REG, static_cast<uint32_t>(stPinsMsk));
+   if(static_cast<uint32_t>(clrPinsMsk) != 0)
+      REG_WRITE(GPIO_OUT_W1TC_REG, static_cast<uint32_t>(clrPinsMsk));
+
+   return;
+}
+
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+  for(;;)
+  {
+  }
+
+  return;
+}
+//===============================>> User Functions Implementations END
@@ -0,0 +1,227 @@
+/**
+  ******************************************************************************
+  * @file	: LimbsSftyLnFSwtch_Bench_09.cpp
+  * @brief  : Packed status encoding and decoding benchmark for the LimbsSafetySw_ESP32 library
+  *
+  * Benchmark for the LimbsSftySw_ESP32 library lssOtptsSttsPkg() and
+  * lssOtptsSttsUnpkg() functions.
+  *
+  * This sketch compares the library packing and unpacking functions, that move
+  * all the flags with a fixed sequence of shift and mask operations, with a
+  * reference implementation setting or clearing one flag per conditional
+  * branch, as the library did before.
+  *
+  * For each run the following values are reported through the serial port:
+  * - The quantity of 32-bit values -out of the 1024 combinations of the 10
+  * status flags- for which the library and the reference results differ,
+  * expected to be 0
+  * - The mean CPU cycles per call of each of the four functions, measured over
+  * BnchRndsQty rounds of the 1024 combinations
+  *
+  * No object is instantiated and no switch needs to be operated while the
+  * benchmark runs.
+  *
+  * Framework: Arduino
+  * Platform: ESP32
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 15/10/2026
+  *       Last update:   15/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+
+//==============================================>> General use definitions BEGIN
+//* This definitions are placed here for easier testing of important implementation parameters, checking the change of behavior when playing around with different values, etc.
+#define BnchTskPrrtyLvl 5
+#define BnchRndsQty 100  // Rounds of the 1024 status combinations measured for each run
+#define BnchRptDlyTm 5000  // Time between benchmark runs
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+uint32_t refOtptsSttsPkg(const lsSwtchOtpts_t &otpts);
+lsSwtchOtpts_t refOtptsSttsUnpkg(uint32_t pkgOtpts);
+//========================================>> General use function prototypes END
+
+//======================================>> Task Callback function prototypes BEGIN
+void bnchTsk(void *pvParameters);
+//========================================>> Task Callback function prototypes END
+
+//===========================>> Tasks Handles declarations BEGIN
+TaskHandle_t bnchTskHndl {NULL};
+//===========================>> Tasks Handles declarations END
+
+//===============================>> Global variables (strictly sanctioned) BEGIN
+volatile uint32_t bnchSink{0}; // Keeps the compiler from discarding the measured calls results
+//=================================>> Global variables (strictly sanctioned) END
+
+limbSftyFwConf_t bnchTskConf{
+   .lsSwExecTskCore = xPortGetCoreID(),
+   .lsSwExecTskPrrtyCnfg = BnchTskPrrtyLvl,
+};
+
+void setup() {
+   Serial.begin(115200);
+   xReturned = xTaskCreatePinnedToCore(
+      bnchTsk,  // Callback function/task to be called
+      "BenchmarkTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      bnchTskConf.lsSwExecTskPrrtyCnfg, // Priority level given to the task
+      &bnchTskHndl, // Task handle
+      bnchTskConf.lsSwExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void bnchTsk(void *pvParameters){
+   TickType_t loopTmrStrtTm{0};
+   TickType_t* loopTmrStrtTmPtr{&loopTmrStrtTm};
+   TickType_t totalDelay {BnchRptDlyTm};
+   const uint32_t cmbntnsQty{lsSwtchOtptsSttsMsk + 1};
+   const uint32_t callsQty{cmbntnsQty * BnchRndsQty};
+   uint32_t msmtchQty{0};
+   uint32_t strtCycl{0};
+   uint32_t refPkgCycl{0};
+   uint32_t refUnpkgCycl{0};
+   uint32_t pkgCycl{0};
+   uint32_t unpkgCycl{0};
+   lsSwtchOtpts_t lsSwtchStts{};
+   lsSwtchOtpts_t refLsSwtchStts{};
+
+   Serial.printf("LimbsSftyLnFSwtch packed status benchmark, %u calls per function per run, CPU @ %u MHz\n", callsQty, ESP.getCpuFreqMHz());
+
+   for(;;){
+      *loopTmrStrtTmPtr = xTaskGetTickCount() / portTICK_RATE_MS;
+      msmtchQty = 0;
+
+      for(uint32_t pkgOtpts{0}; pkgOtpts < cmbntnsQty; ++pkgOtpts){
+         lsSwtchStts = lssOtptsSttsUnpkg(pkgOtpts);
+         refLsSwtchStts = refOtptsSttsUnpkg(pkgOtpts);
+         if((memcmp(&lsSwtchStts, &refLsSwtchStts, sizeof(lsSwtchOtpts_t)) != 0) || (lssOtptsSttsPkg(lsSwtchStts) != refOtptsSttsPkg(refLsSwtchStts)) || (lssOtptsSttsPkg(lsSwtchStts) != pkgOtpts))
+            ++msmtchQty;
+      }
+
+      strtCycl = ESP.getCycleCount();
+      for(uint32_t callNum{0}; callNum < callsQty; ++callNum)
+         bnchSink = bnchSink + refOtptsSttsUnpkg(callNum & lsSwtchOtptsSttsMsk).ltchRlsIsOn;
+      refUnpkgCycl = ESP.getCycleCount() - strtCycl;
+
+      strtCycl = ESP.getCycleCount();
+      for(uint32_t callNum{0}; callNum < callsQty; ++callNum)
+         bnchSink = bnchSink + lssOtptsSttsUnpkg(callNum & lsSwtchOtptsSttsMsk).ltchRlsIsOn;
+      unpkgCycl = ESP.getCycleCount() - strtCycl;
+
+      strtCycl = ESP.getCycleCount();
+      for(uint32_t callNum{0}; callNum < callsQty; ++callNum){
+         refLsSwtchStts.ftSwIsOn = (callNum & 0x01);
+         bnchSink = bnchSink + refOtptsSttsPkg(refLsSwtchStts);
+      }
+      refPkgCycl = ESP.getCycleCount() - strtCycl;
+
+      strtCycl = ESP.getCycleCount();
+      for(uint32_t callNum{0}; callNum < callsQty; ++callNum){
+         lsSwtchStts.ftSwIsOn = (callNum & 0x01);
+         bnchSink = bnchSink + lssOtptsSttsPkg(lsSwtchStts);
+      }
+      pkgCycl = ESP.getCycleCount() - strtCycl;
+
+      Serial.printf("Library and reference results mismatches: %u/%u\n", msmtchQty, cmbntnsQty);
+      Serial.printf("Unpacking cycles per call: reference %6.2f | library %6.2f\n", static_cast<float>(refUnpkgCycl) / callsQty, static_cast<float>(unpkgCycl) / callsQty);
+      Serial.printf("Packing cycles per call:   reference %6.2f | library %6.2f\n\n", static_cast<float>(refPkgCycl) / callsQty, static_cast<float>(pkgCycl) / callsQty);
+
+      vTaskDelayUntil(loopTmrStrtTmPtr, totalDelay);
+   }
+}
+//===============================>> User Tasks Implementations END
+
+//===============================>> User Functions Implementations BEGIN
+/**
+ * @brief Reference packing function, one conditional branch per flag
+ */
+uint32_t __attribute__((noinline)) refOtptsSttsPkg(const lsSwtchOtpts_t &otpts){
+   uint32_t result{0};
+
+   if(otpts.lftHndIsEnbld)
+      result |= ((uint32_t)1) << lftHndSwtchIsEnbldBP;
+   if(otpts.lftHndIsOn)
+      result |= ((uint32_t)1) << lftHndSwtchIsOnBP;
+   if(otpts.lftHndIsVdd)
+      result |= ((uint32_t)1) << lftHndSwtchIsVddBP;
+   if(otpts.rghtHndIsEnbld)
+      result |= ((uint32_t)1) << rghtHndSwtchIsEnbldBP;
+   if(otpts.rghtHndIsOn)
+      result |= ((uint32_t)1) << rghtHndSwtchIsOnBP;
+   if(otpts.rghtHndIsVdd)
+      result |= ((uint32_t)1) << rghtHndSwtchIsVddBP;
+   if(otpts.ftSwIsEnbld)
+      result |= ((uint32_t)1) << ftSwtchIsEnbldBP;
+   if(otpts.ftSwIsOn)
+      result |= ((uint32_t)1) << ftSwtchIsOnBP;
+   if(otpts.ltchRlsIsOn)
+      result |= ((uint32_t)1) << LsSwtchLtchRlsIsOnBP;
+   if(otpts.prdCyclIsOn)
+      result |= ((uint32_t)1) << LsSwtchPrdCyclIsOnBP;
+
+   return result;
+}
+
+/**
+ * @brief Reference unpacking function, one conditional branch per flag
+ */
+lsSwtchOtpts_t __attribute__((noinline)) refOtptsSttsUnpkg(uint32_t pkgOtpts){
+   lsSwtchOtpts_t result {0};
+
+   if(pkgOtpts & (((uint32_t)1) << lftHndSwtchIsEnbldBP))
+      result.lftHndIsEnbld = true;
+   if(pkgOtpts & (((uint32_t)1) << lftHndSwtchIsOnBP))
+      result.lftHndIsOn = true;
+   if(pkgOtpts & (((uint32_t)1) << lftHndSwtchIsVddBP))
+      result.lftHndIsVdd = true;
+   if(pkgOtpts & (((uint32_t)1) << rghtHndSwtchIsEnbldBP))
+      result.rghtHndIsEnbld = true;
+   if(pkgOtpts & (((uint32_t)1) << rghtHndSwtchIsOnBP))
+      result.rghtHndIsOn = true;
+   if(pkgOtpts & (((uint32_t)1) << rghtHndSwtchIsVddBP))
+      result.rghtHndIsVdd = true;
+   if(pkgOtpts & (((uint32_t)1) << ftSwtchIsEnbldBP))
+      result.ftSwIsEnbld = true;
+   if(pkgOtpts & (((uint32_t)1) << ftSwtchIsOnBP))
+      result.ftSwIsOn = true;
+   if(pkgOtpts & (((uint32_t)1) << LsSwtchLtchRlsIsOnBP))
+      result.ltchRlsIsOn = true;
+   if(pkgOtpts & (((uint32_t)1) << LsSwtchPrdCyclIsOnBP))
+      result.prdCyclIsOn = true;
+
+   return result;
+}
+
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+  for(;;)
+  {
+  }
+
+  return;
+}
+//===============================>> User Functions Implementations END
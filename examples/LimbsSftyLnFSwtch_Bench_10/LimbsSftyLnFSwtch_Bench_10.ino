@@ -0,0 +1,245 @@
+/**
+  ******************************************************************************
+  * @file	: LimbsSftyLnFSwtch_Bench_10.cpp
+  * @brief  : Emergency stop reaction time benchmark for the LimbsSftyLnFSwtch class
+  *
+  * Benchmark for the LimbsSftySw_ESP32 library LimbsSftyLnFSwtch class.
+  *
+  * This sketch measures the reaction time of the emergency stop path while the
+  * latch release phase is active, the worst moment for a press safety device.
+  * Each sample runs a production cycle with input edges produced by the
+  * injctInptEvnt() method, and halfway through the latch release phase the
+  * emergency stop is triggered by one of:
+  * - The trgrEmrgncyStp() method -default-
+  * - A GPIO write on the EmrgncyLpbckPin, wired to the EmrgncyStpInptPin, to
+  * exercise the emergency stop input Interrupt Service Routine path. Set
+  * EmrgncyLpbck to true after wiring both pins together
+  * After each stop the hands are released and the FDA is recovered by the
+  * rcvrEmrgncyStp() method, that must succeed.
+  *
+  * For each run the following values are reported through the serial port:
+  * - Maximum time, in microseconds, from the emergency stop request to the
+  * output stage pins set to their inactive levels, as registered by the object
+  * - Maximum time, in microseconds, from the emergency stop request to the FDA
+  * entering the stEmrgncyExcpHndl state, as registered by the object
+  * - Mean and maximum latency, in microseconds, from the trigger to the
+  * benchmark task being unblocked by the latch release turn off notification
+  * - The object's poll period, the bound of the reaction time when the stop is
+  * served by the periodic update instead of the deferred emergency stop call
+  *
+  * The same reaction times, through the emergency stop input ISR path, and the
+  * recovery refused while the hands inputs are pressed run on a Linux host by
+  * the LsSwtchEmrgncyTst target of the extras/LsSwtchHost CMake project.
+  *
+  * Framework: Arduino
+  * Platform: ESP32
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 16/10/2026
+  *       Last update:   16/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+
+//==============================================>> General use definitions BEGIN
+//* This definitions are placed here for easier testing of important implementation parameters, checking the change of behavior when playing around with different values, etc.
+#define BnchTskPrrtyLvl 5
+#define LsSwtchPollTm 20
+#define LtchRlsOtptPin GPIO_NUM_23
+#define PrdCyclOtptPin GPIO_NUM_22
+#define EmrgncyStpInptPin GPIO_NUM_18
+#define EmrgncyLpbckPin GPIO_NUM_19
+#define EmrgncyLpbck false   // Trigger through the EmrgncyLpbckPin to EmrgncyStpInptPin wire instead of the trgrEmrgncyStp() method
+#define BnchSmplsQty 100  // Quantity of emergency stops measured for each run
+#define BnchRptDlyTm 5000  // Time between benchmark runs
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+//========================================>> General use function prototypes END
+
+//======================================>> Task Callback function prototypes BEGIN
+void bnchTsk(void *pvParameters);
+//========================================>> Task Callback function prototypes END
+
+//===========================>> Tasks Handles declarations BEGIN
+TaskHandle_t bnchTskHndl {NULL};
+//===========================>> Tasks Handles declarations END
+
+limbSftyFwConf_t bnchTskConf{
+   .lsSwExecTskCore = xPortGetCoreID(),
+   .lsSwExecTskPrrtyCnfg = BnchTskPrrtyLvl,
+};
+
+void setup() {
+   Serial.begin(115200);
+   xReturned = xTaskCreatePinnedToCore(
+      bnchTsk,  // Callback function/task to be called
+      "BenchmarkTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      bnchTskConf.lsSwExecTskPrrtyCnfg, // Priority level given to the task
+      &bnchTskHndl, // Task handle
+      bnchTskConf.lsSwExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void bnchTsk(void *pvParameters){
+   TickType_t loopTmrStrtTm{0};
+   TickType_t* loopTmrStrtTmPtr{&loopTmrStrtTm};
+   TickType_t totalDelay {BnchRptDlyTm};
+   int64_t trgrTm{0};
+   int64_t ntfctnLtncy{0};
+   int64_t ttlNtfctnLtncy{0};
+   int64_t maxNtfctnLtncy{0};
+   int smplsQty{0};
+   int rcvrFldQty{0};
+   lsSwtchEmrgncyStts_t emrgncyStts{};
+
+   swtchInptHwCfg_t lftHndHwAttrbts{.inptPin = GPIO_NUM_4};
+   swtchInptHwCfg_t rghtHndHwAttrbts{.inptPin = GPIO_NUM_2};
+   swtchInptHwCfg_t ftHwAttrbts{.inptPin = GPIO_NUM_5};
+   swtchInptHwCfg_t emrgncyStpHwAttrbts{
+      .inptPin = EmrgncyStpInptPin,
+      .typeNO = true,
+      .pulledUp = true,   // Active low input
+   };
+   swtchBhvrCfg_t lftHndBhvrSUp{
+      .swtchStrtDlyTm = 50,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t rghtHndBhvrSUp{
+      .swtchStrtDlyTm = 50,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t ftBhvrSUp{
+      .swtchStrtDlyTm = 0,
+      .swtchIsEnbld = false,
+   };
+   lsSwtchSwCfg_t lsssSwtchWrkngPrm{
+      .ltchRlsActvTm = 100,
+      .prdCyclActvTm = 200,
+   };
+   gpioPinOtptHwCfg_t ltchRlsIsOnOtpt{
+      .gpioOtptPin = LtchRlsOtptPin,
+      .gpioOtptActHgh = true,
+   };
+   gpioPinOtptHwCfg_t prdCyclIsOnOtpt{
+      .gpioOtptPin = PrdCyclOtptPin,
+      .gpioOtptActHgh = true,
+   };
+
+   LimbsSftyLnFSwtch bnchSftySwtch (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+   if(EmrgncyLpbck){
+      pinMode(EmrgncyLpbckPin, OUTPUT);
+      digitalWrite(EmrgncyLpbckPin, HIGH);   // Emergency stop input inactive
+   }
+   if(!bnchSftySwtch.setEmrgncyStpPin(emrgncyStpHwAttrbts))
+      Error_Handler();
+   if(!bnchSftySwtch.setOtptPins(ltchRlsIsOnOtpt, prdCyclIsOnOtpt))
+      Error_Handler();
+   if(!bnchSftySwtch.setEvntDrvn(true))
+      Error_Handler();
+   if(!bnchSftySwtch.begin(LsSwtchPollTm))
+      Error_Handler();
+   bnchSftySwtch.setTskToNtfyTrnOnLtchRls(bnchTskHndl);
+   bnchSftySwtch.setTskToNtfyTrnOffLtchRls(bnchTskHndl);
+
+   Serial.printf("LimbsSftyLnFSwtch emergency stop reaction benchmark, %u stops per run triggered by %s, CPU @ %u MHz\n",
+      BnchSmplsQty, EmrgncyLpbck?"the emergency stop input":"trgrEmrgncyStp()", ESP.getCpuFreqMHz());
+
+   for(;;){
+      *loopTmrStrtTmPtr = xTaskGetTickCount() / portTICK_RATE_MS;
+      smplsQty = 0;
+      rcvrFldQty = 0;
+      ttlNtfctnLtncy = 0;
+      maxNtfctnLtncy = 0;
+      bnchSftySwtch.rstEmrgncyStts();
+
+      for(int smplNum{0}; smplNum < BnchSmplsQty; ++smplNum){
+         xTaskNotifyWait(0x00, 0xFFFFFFFF, NULL, 0);  // Discard any pending notification
+         bnchSftySwtch.injctInptEvnt(lftHndInptId, true);
+         bnchSftySwtch.injctInptEvnt(rghtHndInptId, true);
+         vTaskDelay(pdMS_TO_TICKS(_HwMinDbncTime + lftHndBhvrSUp.swtchStrtDlyTm + 2 * LsSwtchPollTm)); // Both hands debounced and out of the start delay, foot switch enabled
+
+         bnchSftySwtch.injctInptEvnt(ftInptId, true);
+         if(xTaskNotifyWait(0x00, 0xFFFFFFFF, NULL, pdMS_TO_TICKS(1000)) == pdPASS){
+            vTaskDelay(pdMS_TO_TICKS(lsssSwtchWrkngPrm.ltchRlsActvTm / 2));   // Halfway through the latch release phase
+            trgrTm = esp_timer_get_time();
+            if(EmrgncyLpbck)
+               digitalWrite(EmrgncyLpbckPin, LOW);
+            else
+               bnchSftySwtch.trgrEmrgncyStp();
+            if(xTaskNotifyWait(0x00, 0xFFFFFFFF, NULL, pdMS_TO_TICKS(1000)) == pdPASS){
+               ntfctnLtncy = esp_timer_get_time() - trgrTm;
+               ttlNtfctnLtncy += ntfctnLtncy;
+               if(maxNtfctnLtncy < ntfctnLtncy)
+                  maxNtfctnLtncy = ntfctnLtncy;
+               ++smplsQty;
+            }
+         }
+
+         // Release everything and recover from the emergency stop
+         if(EmrgncyLpbck)
+            digitalWrite(EmrgncyLpbckPin, HIGH);
+         bnchSftySwtch.injctInptEvnt(ftInptId, false);
+         bnchSftySwtch.injctInptEvnt(lftHndInptId, false);
+         bnchSftySwtch.injctInptEvnt(rghtHndInptId, false);
+         vTaskDelay(pdMS_TO_TICKS(_HwMinDbncTime + 2 * LsSwtchPollTm));   // Hands release debounced
+         if(!bnchSftySwtch.rcvrEmrgncyStp())
+            ++rcvrFldQty;
+         vTaskDelay(pdMS_TO_TICKS(2 * LsSwtchPollTm));  // FDA start state entry code executed
+      }
+
+      bnchSftySwtch.getEmrgncyStts(emrgncyStts);
+      if(smplsQty > 0){
+         Serial.printf("Emergency stop to output pins off:         max %6u us (object registered)\n", emrgncyStts.maxOtptsOffTmUs);
+         Serial.printf("Emergency stop to FDA emergency state:     max %6u us (object registered)\n", emrgncyStts.maxFdaEntryTmUs);
+         Serial.printf("Emergency stop to latch release off task:  mean %6lld us | max %6lld us | %d/%d stops measured\n",
+            ttlNtfctnLtncy / smplsQty, maxNtfctnLtncy, smplsQty, BnchSmplsQty);
+      }
+      else{
+         Serial.println("No emergency stop measured, check the configuration parameters and the loopback wiring");
+      }
+      Serial.printf("Stops: %u | recoveries: %u | refused recoveries: %u | failed recoveries in this run: %d\n",
+         emrgncyStts.emrgncyStpQty, emrgncyStts.rcvrQty, emrgncyStts.rcvrRfsdQty, rcvrFldQty);
+      Serial.printf("Object poll period, reaction bound if served by the periodic update: %6lu us\n\n", LsSwtchPollTm * 1000UL);
+
+      vTaskDelayUntil(loopTmrStrtTmPtr, totalDelay);
+   }
+}
+//===============================>> User Tasks Implementations END
+
+//===============================>> User Functions Implementations BEGIN
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+  for(;;)
+  {
+  }
+
+  return;
+}
+//===============================>> User Functions Implementations END
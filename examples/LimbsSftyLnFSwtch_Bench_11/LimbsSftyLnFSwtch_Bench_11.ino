@@ -0,0 +1,315 @@
+/**
+  ******************************************************************************
+  * @file	: LimbsSftyLnFSwtch_Bench_11.cpp
+  * @brief  : Worst case execution time analyzer for the LimbsSftyLnFSwtch class updates
+  *
+  * Benchmark for the LimbsSftySw_ESP32 library LimbsSftyLnFSwtch class.
+  *
+  * This sketch drives the object updates -the lsSwtchPollCb() periodic poll,
+  * the input events and the phase deadlines- through every FDA transition and
+  * reports the longest durations observed, from the worst case execution time
+  * records kept by the object, as a plain text report meant to be attached to
+  * the machine's technical file.
+  *
+  * The library must be built with the _lsSwtchPrfInstr flag set to 1 as a
+  * project wide build flag (i.e. PlatformIO "build_flags = -D_lsSwtchPrfInstr=1"),
+  * as the flag changes the class layout it can't be set by a #define in the
+  * sketch. Without it the instrumentation is compiled out and the sketch only
+  * reports it's not available.
+  *
+  * The object is set to the event driven and phase deadline timers modes, with
+  * the output stage pins, the five tasks notifications, the five functions,
+  * a status subscriber and an edges subscriber for all the edges set, so
+  * the timed updates include every action an update might execute. The
+  * input edges are produced by the injctInptEvnt() method and the emergency
+  * stops by the trgrEmrgncyStp() method, so no switch needs to be operated.
+  * Each run executes the following scenarios:
+  * - A complete production cycle: 0->1, 1->2, 2->3, 3->4 and 4->0 transitions
+  * - Both hands on missed by releasing the hands before the foot press: 1->0
+  * - An emergency stop in the 0, 1, 3 and 4 states, and its recovery: 0->5,
+  * 1->5, 3->5 and 4->5 transitions and updates in the 5 state
+  * The 2 state is left by the same update entering it, so it can't be stopped.
+  *
+  * For each FDA state and each FDA transition observed the report holds:
+  * - Quantity of updates -or FDA steps- timed
+  * - Maximum FDA step, object lock hold and whole update durations, in CPU
+  * clock cycles and in microseconds
+  * - The quantity of updates holding the object lock longer than the
+  * LckHldBndUs bound, flagged as EXCEEDED
+  * The expected transitions with no update timed are flagged as NOT EXERCISED.
+  * The records are kept between reports, so the maximums grow with the test time.
+  *
+  * The same scenarios and report run on a Linux host by the LsSwtchWcetTst
+  * target of the extras/LsSwtchHost CMake project, failing if an expected
+  * transition is not exercised.
+  *
+  * Framework: Arduino
+  * Platform: ESP32
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 16/10/2026
+  *       Last update:   16/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+
+//==============================================>> General use definitions BEGIN
+//* This definitions are placed here for easier testing of important implementation parameters, checking the change of behavior when playing around with different values, etc.
+#define BnchTskPrrtyLvl 5
+#define SnkTskPrrtyLvl 4
+#define LsSwtchPollTm 20
+#define LtchRlsOtptPin GPIO_NUM_23
+#define PrdCyclOtptPin GPIO_NUM_22
+#define LckHldBndUs 20   // Object lock hold time bound, the time the interrupts might stay masked by an update
+#define EmrgncyScnrsQty 4   // Emergency stop scenarios: stops in the 0, 1, 3 and 4 states
+#define WcetRunsQty 20  // Quantity of scenario runs between reports
+#define BnchRptDlyTm 1000  // Time between the end of a report and the next runs
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+void nullFn(void* argPtr);
+void prntWcetRcrd(const char* rcrdName, const lsSwtchWcetRcrd_t &rcrd, const uint32_t &tcksPerUs);
+//========================================>> General use function prototypes END
+
+//======================================>> Task Callback function prototypes BEGIN
+void bnchTsk(void *pvParameters);
+void snkTsk(void *pvParameters);
+//========================================>> Task Callback function prototypes END
+
+//===========================>> Tasks Handles declarations BEGIN
+TaskHandle_t bnchTskHndl {NULL};
+TaskHandle_t snkTskHndl {NULL};
+//===========================>> Tasks Handles declarations END
+
+//===============================>> Global variables (strictly sanctioned) BEGIN
+const char* const fdaSttNames[lsSwtchFdaSttsQty]{"Off, not both hands", "Off, both hands", "Start cycle", "Latch release", "Production cycle", "Emergency stop"};
+// Transitions the FDA might execute, as "from state, to state" pairs
+const uint8_t expctdTrnstns[][2]{{0, 1}, {1, 0}, {1, 2}, {2, 3}, {3, 4}, {4, 0}, {0, 5}, {1, 5}, {3, 5}, {4, 5}};
+//=================================>> Global variables (strictly sanctioned) END
+
+limbSftyFwConf_t bnchTskConf{
+   .lsSwExecTskCore = xPortGetCoreID(),
+   .lsSwExecTskPrrtyCnfg = BnchTskPrrtyLvl,
+};
+
+void setup() {
+   Serial.begin(115200);
+   // Create the notifications sink task, the receiver of every notification the object sends
+   xReturned = xTaskCreatePinnedToCore(
+      snkTsk,  // Callback function/task to be called
+      "SinkTask",  // Name of the task
+      1024,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      SnkTskPrrtyLvl, // Priority level given to the task
+      &snkTskHndl, // Task handle
+      bnchTskConf.lsSwExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+   xReturned = xTaskCreatePinnedToCore(
+      bnchTsk,  // Callback function/task to be called
+      "BenchmarkTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      bnchTskConf.lsSwExecTskPrrtyCnfg, // Priority level given to the task
+      &bnchTskHndl, // Task handle
+      bnchTskConf.lsSwExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void bnchTsk(void *pvParameters){
+   const uint32_t tcksPerUs{LimbsSftyLnFSwtch::getPrfTcksPerUs()};
+   lsSwtchWcetRcrd_t wcetRcrd{};
+   uint32_t runsQty{0};
+   bool bndExcdd{false};
+   char rcrdName[48];
+   fncVdPtrPrmPtrType nullFnPtr{nullFn};
+
+   swtchInptHwCfg_t lftHndHwAttrbts{.inptPin = GPIO_NUM_4};
+   swtchInptHwCfg_t rghtHndHwAttrbts{.inptPin = GPIO_NUM_2};
+   swtchInptHwCfg_t ftHwAttrbts{.inptPin = GPIO_NUM_5};
+   swtchBhvrCfg_t lftHndBhvrSUp{
+      .swtchStrtDlyTm = 50,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t rghtHndBhvrSUp{
+      .swtchStrtDlyTm = 50,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t ftBhvrSUp{
+      .swtchStrtDlyTm = 0,
+      .swtchIsEnbld = false,
+   };
+   lsSwtchSwCfg_t lsssSwtchWrkngPrm{
+      .ltchRlsActvTm = 100,
+      .prdCyclActvTm = 200,
+   };
+   gpioPinOtptHwCfg_t ltchRlsIsOnOtpt{
+      .gpioOtptPin = LtchRlsOtptPin,
+      .gpioOtptActHgh = true,
+   };
+   gpioPinOtptHwCfg_t prdCyclIsOnOtpt{
+      .gpioOtptPin = PrdCyclOtptPin,
+      .gpioOtptActHgh = true,
+   };
+   const TickType_t hndsOnDly{pdMS_TO_TICKS(_HwMinDbncTime + lftHndBhvrSUp.swtchStrtDlyTm + 2 * LsSwtchPollTm)};  // Both hands debounced and out of the start delay, foot switch enabled
+   const TickType_t stlDly{pdMS_TO_TICKS(_HwMinDbncTime + 2 * LsSwtchPollTm)};  // Input edges debounced and processed
+
+   LimbsSftyLnFSwtch bnchSftySwtch (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+   if(!bnchSftySwtch.setOtptPins(ltchRlsIsOnOtpt, prdCyclIsOnOtpt))
+      Error_Handler();
+   if(!bnchSftySwtch.setEvntDrvn(true))
+      Error_Handler();
+   if(!bnchSftySwtch.setPhsTmrDrvn(true))
+      Error_Handler();
+   bnchSftySwtch.setFnWhnBthHndsOnMssd(nullFnPtr);
+   bnchSftySwtch.setFnWhnTrnOnLtchRlsPtr(nullFnPtr);
+   bnchSftySwtch.setFnWhnTrnOffLtchRlsPtr(nullFnPtr);
+   bnchSftySwtch.setFnWhnTrnOnPrdCyclPtr(nullFnPtr);
+   bnchSftySwtch.setFnWhnTrnOffPrdCyclPtr(nullFnPtr);
+   if(!bnchSftySwtch.begin(LsSwtchPollTm))
+      Error_Handler();
+   bnchSftySwtch.setTskToNtfyBthHndsOnMssd(snkTskHndl);
+   bnchSftySwtch.setTskToNtfyTrnOnLtchRls(snkTskHndl);
+   bnchSftySwtch.setTskToNtfyTrnOffLtchRls(snkTskHndl);
+   bnchSftySwtch.setTskToNtfyTrnOnPrdCycl(snkTskHndl);
+   bnchSftySwtch.setTskToNtfyTrnOffPrdCycl(snkTskHndl);
+   bnchSftySwtch.setTskToNtfyLsSwtchOtptsChng(snkTskHndl);
+   bnchSftySwtch.addSttsSbscrbr(snkTskHndl, lsSwtchOtptsSttsMsk, lsSwtchOtptsSttsMsk);
+   bnchSftySwtch.addEdgsSbscrbr(snkTskHndl, lsSwtchEdgsMsk);
+
+   Serial.printf("LimbsSftyLnFSwtch worst case execution time analyzer, %u scenario runs per report, CPU @ %u MHz\n", WcetRunsQty, ESP.getCpuFreqMHz());
+   if(!bnchSftySwtch.setWcetLckHldBndUs(LckHldBndUs)){
+      Serial.println("Worst case execution time records not available, build the library with the _lsSwtchPrfInstr flag set to 1");
+      vTaskDelete(NULL);
+   }
+
+   for(;;){
+      for(int runNum{0}; runNum < WcetRunsQty; ++runNum){
+         // Complete production cycle
+         bnchSftySwtch.injctInptEvnt(lftHndInptId, true);
+         bnchSftySwtch.injctInptEvnt(rghtHndInptId, true);
+         vTaskDelay(hndsOnDly);
+         bnchSftySwtch.injctInptEvnt(ftInptId, true);
+         vTaskDelay(stlDly);
+         bnchSftySwtch.injctInptEvnt(ftInptId, false);
+         bnchSftySwtch.injctInptEvnt(lftHndInptId, false);
+         bnchSftySwtch.injctInptEvnt(rghtHndInptId, false);
+         vTaskDelay(pdMS_TO_TICKS(lsssSwtchWrkngPrm.prdCyclActvTm) + stlDly);
+
+         // Both hands on missed
+         bnchSftySwtch.injctInptEvnt(lftHndInptId, true);
+         bnchSftySwtch.injctInptEvnt(rghtHndInptId, true);
+         vTaskDelay(hndsOnDly);
+         bnchSftySwtch.injctInptEvnt(lftHndInptId, false);
+         bnchSftySwtch.injctInptEvnt(rghtHndInptId, false);
+         vTaskDelay(stlDly);
+
+         // Emergency stops in every stoppable state
+         for(uint8_t scnrNum{0}; scnrNum < EmrgncyScnrsQty; ++scnrNum){
+            if(scnrNum > 0){
+               bnchSftySwtch.injctInptEvnt(lftHndInptId, true);
+               bnchSftySwtch.injctInptEvnt(rghtHndInptId, true);
+               vTaskDelay(hndsOnDly);
+            }
+            if(scnrNum > 1){
+               bnchSftySwtch.injctInptEvnt(ftInptId, true);
+               vTaskDelay(pdMS_TO_TICKS((scnrNum == 2)?(lsssSwtchWrkngPrm.ltchRlsActvTm / 2):((lsssSwtchWrkngPrm.ltchRlsActvTm + lsssSwtchWrkngPrm.prdCyclActvTm) / 2)));
+            }
+            bnchSftySwtch.trgrEmrgncyStp();
+            vTaskDelay(stlDly);
+            bnchSftySwtch.injctInptEvnt(ftInptId, false);
+            bnchSftySwtch.injctInptEvnt(lftHndInptId, false);
+            bnchSftySwtch.injctInptEvnt(rghtHndInptId, false);
+            vTaskDelay(stlDly);
+            if(!bnchSftySwtch.rcvrEmrgncyStp())
+               Serial.println("Emergency stop recovery refused, check the configuration parameters");
+            vTaskDelay(stlDly);
+         }
+      }
+      runsQty += WcetRunsQty;
+
+      Serial.printf("\n==== Worst case execution time report: %lu scenario runs, CPU @ %u MHz, lock hold bound %u us ====\n", (unsigned long)runsQty, ESP.getCpuFreqMHz(), LckHldBndUs);
+      Serial.printf("%-36s %8s %10s %10s %10s %10s %8s\n", "Record", "Samples", "FDA cy", "Lock cy", "Update cy", "Update us", "Over");
+      bndExcdd = false;
+      for(uint8_t fdaStt{0}; fdaStt < lsSwtchFdaSttsQty; ++fdaStt){
+         if(bnchSftySwtch.getWcetSttRcrd(fdaStt, wcetRcrd)){
+            snprintf(rcrdName, sizeof(rcrdName), "State %u %s", fdaStt, fdaSttNames[fdaStt]);
+            prntWcetRcrd(rcrdName, wcetRcrd, tcksPerUs);
+            bndExcdd = bndExcdd || (wcetRcrd.lckHldOvrBndQty > 0);
+         }
+      }
+      for(uint8_t frmStt{0}; frmStt < lsSwtchFdaSttsQty; ++frmStt){
+         for(uint8_t toStt{0}; toStt < lsSwtchFdaSttsQty; ++toStt){
+            if(bnchSftySwtch.getWcetTrnstnRcrd(frmStt, toStt, wcetRcrd) && (wcetRcrd.smplsQty > 0)){
+               snprintf(rcrdName, sizeof(rcrdName), "Transition %u -> %u", frmStt, toStt);
+               prntWcetRcrd(rcrdName, wcetRcrd, tcksPerUs);
+               bndExcdd = bndExcdd || (wcetRcrd.lckHldOvrBndQty > 0);
+            }
+         }
+      }
+      for(const auto &expctdTrnstn : expctdTrnstns){
+         if(bnchSftySwtch.getWcetTrnstnRcrd(expctdTrnstn[0], expctdTrnstn[1], wcetRcrd) && (wcetRcrd.smplsQty == 0))
+            Serial.printf("Transition %u -> %u NOT EXERCISED\n", expctdTrnstn[0], expctdTrnstn[1]);
+      }
+      Serial.printf("Lock hold bound of %u us: %s\n", LckHldBndUs, bndExcdd?"EXCEEDED":"met by every update");
+
+      vTaskDelay(pdMS_TO_TICKS(BnchRptDlyTm));
+   }
+}
+
+void snkTsk(void *pvParameters){
+   for(;;){
+      xTaskNotifyWait(0x00, 0xFFFFFFFF, NULL, portMAX_DELAY);
+   }
+}
+//===============================>> User Tasks Implementations END
+
+//===============================>> User Functions Implementations BEGIN
+void nullFn(void* argPtr){
+   // Empty function: the updates are timed with the function call in place, the user code duration must be added to the report figures
+
+   return;
+}
+
+void prntWcetRcrd(const char* rcrdName, const lsSwtchWcetRcrd_t &rcrd, const uint32_t &tcksPerUs){
+   Serial.printf("%-36s %8lu %10lu %10lu %10lu %10.2f %8lu%s\n",
+      rcrdName, (unsigned long)rcrd.smplsQty, (unsigned long)rcrd.maxFdaTcks, (unsigned long)rcrd.maxLckHldTcks, (unsigned long)rcrd.maxUpdTcks,
+      static_cast<float>(rcrd.maxUpdTcks) / tcksPerUs, (unsigned long)rcrd.lckHldOvrBndQty, (rcrd.lckHldOvrBndQty > 0)?" EXCEEDED":"");
+
+   return;
+}
+
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+  for(;;)
+  {
+  }
+
+  return;
+}
+//===============================>> User Functions Implementations END
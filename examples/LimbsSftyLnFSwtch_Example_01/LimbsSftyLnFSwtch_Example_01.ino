@@ -17,7 +17,8 @@
   * - LimbsSftyLnFSwtch object behavior configuration parameters setting
   * - All previously configuration parameters set application by pin configurations
   * - LimbsSftyLnFSwtch object instantiation and timer activation using .begin() method
-  * - Endless loop execution updating inputs and outputs
+  * - Endless loop execution updating the outputs, blocked between the object
+  * status changes by the wtLsSwtchOtptsChng() method
   *
   * Framework: Arduino
   * Platform: ESP32
@@ -25,7 +26,7 @@
   * @author	: Gabriel D. Goldman
   *
   * @date First release: 28/11/2024 
-  *       Last update:   26/01/2025 11:20 GMT+0200
+  *       Last update:   16/10/2026 10:00 GMT+0200
   ******************************************************************************
   * @attention	This library gives no guarantees whatsoever about it's compliance
   * to any expectations but as those from it's own designers. Use under your own 
@@ -39,7 +40,6 @@
 
 //==============================================>> General use definitions BEGIN
 //* This definitions are placed here for easier testing of important implementation parameters, checking the change of behavior when playing around with different values, etc.
-#define LoopDlyTtlTm 25
 #define MainCtrlTskPrrtyLvl 5
 #define UndrlyngMPBttnPollTm 25
 #define LsSwtchPollTm 50
@@ -83,9 +83,8 @@ void loop() {
 
 //===============================>> User Tasks Implementations BEGIN
 void mainCtrlTsk(void *pvParameters){
-   TickType_t loopTmrStrtTm{0};
-   TickType_t* loopTmrStrtTmPtr{&loopTmrStrtTm};
-   TickType_t totalDelay {LoopDlyTtlTm};
+   uint32_t otptsSttsPkgd{0};
+   uint32_t chngSeqNum{0};
 
    //=============================>> Underlying switches configuration parameters values BEGIN
    //----------------------------->> Hardware construction related parameter values BEGIN
@@ -272,7 +271,7 @@ void mainCtrlTsk(void *pvParameters){
    stampSftySwtch.begin(LsSwtchPollTm);
 
    for(;;){
-      *loopTmrStrtTmPtr = xTaskGetTickCount() / portTICK_RATE_MS; //! Although this is just a test execution, this is implemented to save resources by not executing this loop constantly
+      stampSftySwtch.wtLsSwtchOtptsChng(otptsSttsPkgd, chngSeqNum);  //! The task is blocked -using no CPU time- until the object publishes a status change, the outputs are updated by the same object update that produced the change
 
       // Keep the _undrlLftHndMPB object outputs updated.		
       if(stampSftySwtch.getLftHndSwtchPtr()->getOutputsChange()){
@@ -334,8 +333,6 @@ void mainCtrlTsk(void *pvParameters){
          }
          stampSftySwtch.setLsSwtchOtptsChng(false);
       }
-   
-      vTaskDelayUntil(loopTmrStrtTmPtr, totalDelay);  //! Complementary code for the implementation to save resources by blocking this piece of code as is not needed to be executed constantly   
    }
 }
 //===============================>> User Tasks Implementations END
@@ -0,0 +1,171 @@
+/**
+  ******************************************************************************
+  * @file	: LimbsSftyLnFSwtch_Example_06.cpp
+  * @brief  : Compact binary event log of a LimbsSftyLnFSwtch object through the LsSwtchLgEncdr class
+  *
+  * Example for the LimbsSftySw_ESP32 library LsSwtchLgEncdr class.
+  *
+  * This example keeps an operator interactions history of a LimbsSftyLnFSwtch
+  * object: the transitions ring is set, and a logger task -notified by the
+  * object each time its outputs change- drains the ring records, encodes them
+  * through a LsSwtchLgEncdr object and writes the encoded bytes to the serial
+  * port. The serial port carries only the binary log, about 3 bytes per status
+  * change, so it might be captured to a file in the host, i.e.:
+  *    cat /dev/ttyUSB0 > lsSwtch.lg
+  * and expanded to CSV or JSON lines by the extras/LsSwtchLgDcdr host tool:
+  *    LsSwtchLgDcdr lsSwtch.lg > lsSwtch.csv
+  * The log header is written only when the sink is empty: as the serial port
+  * capture keeps running across the board restarts, a marker kept in the RTC
+  * memory -preserved by the software and watchdog resets, lost at power on-
+  * records the header was already sent. The same encoded bytes might be
+  * appended to a flash file instead, writing the log header only when the
+  * file is created. A header repeated by a power cycle during the capture is
+  * accepted by the decoder as the start of a new encoder's records.
+  *
+  * Framework: Arduino
+  * Platform: ESP32
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 16/10/2026
+  *       Last update:   16/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+
+//==============================================>> General use definitions BEGIN
+//* This definitions are placed here for easier testing of important implementation parameters, checking the change of behavior when playing around with different values, etc.
+#define LgTskPrrtyLvl 5
+#define LsSwtchPollTm 20
+#define LgTmRsltnUs 1000   // Log records time resolution, in microseconds
+#define LgRcrdsBtchSz 8 // Transitions ring records taken by each drain pass
+#define LgHdrSntMrk 0x4C534C01UL  // RTC memory marker value of a log header already sent to the sink
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+//========================================>> General use function prototypes END
+
+//======================================>> Task Callback function prototypes BEGIN
+void lgTsk(void *pvParameters);
+//========================================>> Task Callback function prototypes END
+
+//===========================>> Tasks Handles declarations BEGIN
+TaskHandle_t lgTskHndl {NULL};
+//===========================>> Tasks Handles declarations END
+
+//===============================>> Global variables (strictly sanctioned) BEGIN
+RTC_NOINIT_ATTR uint32_t lgHdrSnt;  // Not initialized at boot: keeps its value across software and watchdog resets
+//=================================>> Global variables (strictly sanctioned) END
+
+limbSftyFwConf_t lgTskConf{
+   .lsSwExecTskCore = xPortGetCoreID(),
+   .lsSwExecTskPrrtyCnfg = LgTskPrrtyLvl,
+};
+
+void setup() {
+   Serial.begin(115200);
+   xReturned = xTaskCreatePinnedToCore(
+      lgTsk,  // Callback function/task to be called
+      "LoggerTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      lgTskConf.lsSwExecTskPrrtyCnfg, // Priority level given to the task
+      &lgTskHndl, // Task handle
+      lgTskConf.lsSwExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void lgTsk(void *pvParameters){
+   lsSwtchTrnstnRcrd_t trnstnRcrds[LgRcrdsBtchSz];
+   size_t rcrdsQty{0};
+   uint8_t lgBfr[_lgEncdMaxSz];
+   size_t lgBfrSz{0};
+   LsSwtchLgEncdr lgEncdr(LgTmRsltnUs);
+
+   swtchInptHwCfg_t lftHndHwAttrbts{.inptPin = GPIO_NUM_4};
+   swtchInptHwCfg_t rghtHndHwAttrbts{.inptPin = GPIO_NUM_2};
+   swtchInptHwCfg_t ftHwAttrbts{.inptPin = GPIO_NUM_5};
+   swtchBhvrCfg_t lftHndBhvrSUp{
+      .swtchStrtDlyTm = 100,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t rghtHndBhvrSUp{
+      .swtchStrtDlyTm = 100,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t ftBhvrSUp{
+      .swtchStrtDlyTm = 200,
+      .swtchIsEnbld = false,
+   };
+   lsSwtchSwCfg_t lsssSwtchWrkngPrm{
+      .ltchRlsActvTm = 1500,
+      .prdCyclActvTm = 6000,
+   };
+   gpioPinOtptHwCfg_t ltchRlsIsOnOtpt{
+      .gpioOtptPin = GPIO_NUM_23,
+      .gpioOtptActHgh = true,
+   };
+
+   LimbsSftyLnFSwtch lgdSftySwtch (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+   if(!lgdSftySwtch.setOtptPins(ltchRlsIsOnOtpt))
+      Error_Handler();
+   if(!lgdSftySwtch.setTrnstnRcrdd(true))
+      Error_Handler();
+   if(!lgdSftySwtch.begin(LsSwtchPollTm))
+      Error_Handler();
+   lgdSftySwtch.setTskToNtfyLsSwtchOtptsChng(lgTskHndl);
+
+   // The header is written only to an empty sink, the RTC memory content after a power on is undefined
+   if((esp_reset_reason() == ESP_RST_POWERON) || (lgHdrSnt != LgHdrSntMrk)){
+      lgBfrSz = lgEncdr.encdHdr(lgBfr, sizeof(lgBfr));
+      Serial.write(lgBfr, lgBfrSz);
+      lgHdrSnt = LgHdrSntMrk;
+   }
+
+   for(;;){
+      xTaskNotifyWait(0x00, 0xFFFFFFFF, NULL, portMAX_DELAY);
+      // The ring is drained until empty, as a single notification might stand for several updates
+      while((rcrdsQty = lgdSftySwtch.getTrnstnRcrds(trnstnRcrds, LgRcrdsBtchSz)) > 0){
+         for(size_t rcrdNum{0}; rcrdNum < rcrdsQty; ++rcrdNum){
+            lgBfrSz = lgEncdr.encdTrnstn(trnstnRcrds[rcrdNum].tmUs, trnstnRcrds[rcrdNum].otptsSttsPkgd, lgBfr, sizeof(lgBfr));
+            if(lgBfrSz > 0)   // Records of FDA state changes with no packed status change produce no bytes
+               Serial.write(lgBfr, lgBfrSz);
+         }
+      }
+   }
+}
+//===============================>> User Tasks Implementations END
+
+//===============================>> User Functions Implementations BEGIN
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+  for(;;)
+  {
+  }
+
+  return;
+}
+//===============================>> User Functions Implementations END
@@ -0,0 +1,202 @@
+/**
+  ******************************************************************************
+  * @file	: LimbsSftyLnFSwtch_Replay_01.cpp
+  * @brief  : Replays an operator input trace through a LsSwtchRplyr class object
+  *
+  * Example for the LimbsSftySw_ESP32 library LsSwtchRplyr class.
+  *
+  * This example replays a production shift worth of operator inputs -left hand,
+  * right hand and foot switches edges- through the same FDA a LimbsSftyLnFSwtch
+  * object executes, driven by a virtual clock instead of the FreeRTOS ticks.
+  * The example:
+  * - Replays a short trace printing the exact packed status sequence produced,
+  * as CSV lines (virtual time in milliseconds, packed status in hexadecimal)
+  * - Replays a long synthetic trace, generated in chunks to keep the RAM use
+  * bounded, reporting the quantity of production cycles simulated, the
+  * quantity of status changes produced and the real time the replay took.
+  * - Reports the production statistics the replayer kept in virtual time for the
+  * long trace: cycles per hour, cycle periods, idle times and reaction times.
+  *
+  * In a real use case the trace chunks are expected to be read from a log
+  * file or received through a communications channel.
+  *
+  * Framework: Arduino
+  * Platform: ESP32
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 15/10/2026
+  *       Last update:   15/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+
+//==============================================>> General use definitions BEGIN
+//* This definitions are placed here for easier testing of important implementation parameters, checking the change of behavior when playing around with different values, etc.
+#define RplyTskPrrtyLvl 5
+#define LsSwtchPollTm 20   // Poll period of the LimbsSftyLnFSwtch being reproduced
+#define CyclPrd 8000UL  // Time between the starts of two consecutive operator sequences
+#define CyclsPerChnk 100   // Production cycles generated for each trace chunk
+#define EvntsPerCycl 6
+#define ShftCyclsQty 100000UL // Production cycles replayed in the long trace
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler();
+size_t genTrcChnk(lsSwtchTrcEvnt_t* trcChnk, const unsigned long int &frstCyclNum, const size_t &cyclsQty);
+void prntOtptsChng(unsigned long int chngTm, uint32_t otptsSttsPkgd, void* argPtr);
+void prntSttstcSmmry(const char* sttstcName, const lsSwtchSttstcSmmry_t &smmry);
+//========================================>> General use function prototypes END
+
+//======================================>> Task Callback function prototypes BEGIN
+void rplyTsk(void *pvParameters);
+//========================================>> Task Callback function prototypes END
+
+//===========================>> Tasks Handles declarations BEGIN
+TaskHandle_t rplyTskHndl {NULL};
+//===========================>> Tasks Handles declarations END
+
+//===============================>> Global variables (strictly sanctioned) BEGIN
+lsSwtchTrcEvnt_t trcChnk[CyclsPerChnk * EvntsPerCycl];
+//=================================>> Global variables (strictly sanctioned) END
+
+limbSftyFwConf_t rplyTskConf{
+   .lsSwExecTskCore = xPortGetCoreID(),
+   .lsSwExecTskPrrtyCnfg = RplyTskPrrtyLvl,
+};
+
+void setup() {
+   Serial.begin(115200);
+   xReturned = xTaskCreatePinnedToCore(
+      rplyTsk,  // Callback function/task to be called
+      "ReplayTask",  // Name of the task
+      4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+      NULL,  // Pointer to the parameters for the function to work with
+      rplyTskConf.lsSwExecTskPrrtyCnfg, // Priority level given to the task
+      &rplyTskHndl, // Task handle
+      rplyTskConf.lsSwExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler();
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void rplyTsk(void *pvParameters){
+   swtchInptHwCfg_t lftHndHwAttrbts{.inptPin = GPIO_NUM_4};
+   swtchInptHwCfg_t rghtHndHwAttrbts{.inptPin = GPIO_NUM_2};
+   swtchInptHwCfg_t ftHwAttrbts{.inptPin = GPIO_NUM_5};
+   swtchBhvrCfg_t lftHndBhvrSUp{
+      .swtchStrtDlyTm = 100,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t rghtHndBhvrSUp{
+      .swtchStrtDlyTm = 100,
+      .swtchIsEnbld = true,
+      .swtchVdTm = 5000,
+   };
+   swtchBhvrCfg_t ftBhvrSUp{
+      .swtchStrtDlyTm = 200,
+      .swtchIsEnbld = false,
+   };
+   lsSwtchSwCfg_t lsssSwtchWrkngPrm{
+      .ltchRlsActvTm = 1500,
+      .prdCyclActvTm = 6000,
+   };
+   uint32_t otptsChngQty{0};
+   size_t trcChnkQty{0};
+   int64_t rplyStrtTm{0};
+   lsSwtchPrdSttstcs_t prdSttstcs{};
+
+   LsSwtchRplyr stampRplyr (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+   stampRplyr.setRplyStpTm(LsSwtchPollTm);
+
+   //------------------>> Short trace, printing every status change
+   Serial.println("virtualTimeMs,otptsSttsPkgd");
+   stampRplyr.setFnWhnRplyOtptsChng(prntOtptsChng);
+   trcChnkQty = genTrcChnk(trcChnk, 0, 2);
+   stampRplyr.rplyTrc(trcChnk, trcChnkQty, 2 * CyclPrd);
+
+   //------------------>> Long trace, counting the status changes
+   stampRplyr.setFnWhnRplyOtptsChng(nullptr);
+   stampRplyr.rstRply();
+   stampRplyr.rstPrdSttstcs();
+   rplyStrtTm = esp_timer_get_time();
+   for(unsigned long int frstCyclNum{0}; frstCyclNum < ShftCyclsQty; frstCyclNum += CyclsPerChnk){
+      trcChnkQty = genTrcChnk(trcChnk, frstCyclNum, CyclsPerChnk);
+      otptsChngQty += stampRplyr.rplyTrc(trcChnk, trcChnkQty, (frstCyclNum + CyclsPerChnk) * CyclPrd);
+   }
+   Serial.printf("Replayed %lu production cycles (%lu virtual seconds) in %lld ms, %lu status changes\n",
+      ShftCyclsQty, stampRplyr.getVrtlClkMs() / 1000UL, (esp_timer_get_time() - rplyStrtTm) / 1000LL, (unsigned long)otptsChngQty);
+
+   //------------------>> Production statistics of the long trace
+   stampRplyr.getPrdSttstcs(prdSttstcs);
+   Serial.printf("Production cycles completed: %lu | both hands missed: %lu | cycles per hour: %.1f\n",
+      (unsigned long)prdSttstcs.cyclsQty, (unsigned long)prdSttstcs.bthHndsMssdQty, prdSttstcs.cyclsPerHr);
+   prntSttstcSmmry("Cycle period", prdSttstcs.cyclPrd);
+   prntSttstcSmmry("Idle time", prdSttstcs.idleTm);
+   prntSttstcSmmry("Reaction time", prdSttstcs.rctnTm);
+
+   vTaskDelete(NULL);
+}
+//===============================>> User Tasks Implementations END
+
+//===============================>> User Functions Implementations BEGIN
+/**
+ * @brief Generates a synthetic input trace chunk, one regular operator sequence per production cycle
+ */
+size_t genTrcChnk(lsSwtchTrcEvnt_t* trcChnk, const unsigned long int &frstCyclNum, const size_t &cyclsQty){
+   size_t evntsQty{0};
+   unsigned long int cyclStrtTm{0};
+
+   for(size_t cyclNum{0}; cyclNum < cyclsQty; ++cyclNum){
+      cyclStrtTm = (frstCyclNum + cyclNum) * CyclPrd;
+      trcChnk[evntsQty++] = {cyclStrtTm, lftHndInptId, true};
+      trcChnk[evntsQty++] = {cyclStrtTm + 60, rghtHndInptId, true};
+      trcChnk[evntsQty++] = {cyclStrtTm + 450, ftInptId, true};
+      trcChnk[evntsQty++] = {cyclStrtTm + 700, ftInptId, false};
+      trcChnk[evntsQty++] = {cyclStrtTm + 2000, lftHndInptId, false};
+      trcChnk[evntsQty++] = {cyclStrtTm + 2100, rghtHndInptId, false};
+   }
+
+   return evntsQty;
+}
+
+void prntOtptsChng(unsigned long int chngTm, uint32_t otptsSttsPkgd, void* argPtr){
+   Serial.printf("%lu,0x%03lX\n", chngTm, (unsigned long)otptsSttsPkgd);
+
+   return;
+}
+
+void prntSttstcSmmry(const char* sttstcName, const lsSwtchSttstcSmmry_t &smmry){
+   Serial.printf("%-14s (ms): min %8.1f | mean %8.1f | std dev %8.1f | p50 %8.1f | p90 %8.1f | p99 %8.1f | max %8.1f\n",
+      sttstcName, smmry.min, smmry.mean, smmry.stdDev, smmry.p50, smmry.p90, smmry.p99, smmry.max);
+
+   return;
+}
+
+/**
+ * @brief Error Handling function
+ *
+ * Placeholder for a Error Handling function, in case of an error the execution
+ * will be trapped in this endless loop
+ */
+void Error_Handler(){
+  for(;;)
+  {
+  }
+
+  return;
+}
+//===============================>> User Functions Implementations END
@@ -0,0 +1,257 @@
+/**
+  ******************************************************************************
+  * @file	: LsSwtchCbDsptchTst.cpp
+  * @brief  : Host callback dispatch queue overflow test for the LimbsSftyLnFSwtch class
+  *
+  * Drives a LimbsSftyLnFSwtch object in the event driven and callback dispatch
+  * modes through production cycles while its dispatch task is kept stalled by
+  * a turn on function, until the dispatch queue is full. The timer service is
+  * executed by the shim background thread, as the target timer service task.
+  * The following behaviors are checked:
+  * - The request finding the queue full forces an emergency stop: the FDA
+  * enters the stEmrgncyExcpHndl state and the output stage pins are inactive
+  * - Once the dispatch task resumes, the last function executed for each output
+  * is its turn off function, and no fewer turn off than turn on functions were
+  * executed: the turn on requests might be dropped, the turn off ones not
+  * - The object is recovered and runs a complete production cycle
+  *
+  * Framework: None, host build
+  * Platform: Linux host
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 16/10/2026
+  *       Last update:   16/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+#include <LsSwtchHostShim.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <initializer_list>
+#include <thread>
+
+//==============================================>> General use definitions BEGIN
+#define LsSwtchPollTm 20
+#define LftHndPin GPIO_NUM_4
+#define RghtHndPin GPIO_NUM_2
+#define FtPin GPIO_NUM_5
+#define LtchRlsOtptPin GPIO_NUM_23
+#define PrdCyclOtptPin GPIO_NUM_22
+#define MaxCyclsQty 16  // Production cycles limit to fill the dispatch queue, each cycle queues four requests
+#define WtTmOut 2000 // Maximum time -in milliseconds- waited for each expected object reaction
+//================================================>> General use definitions END
+
+/**
+ * @brief Functions executions registered for one of the outputs
+ */
+struct otptFnsExctns_t{
+   std::atomic<uint32_t> trnOnQty{0};
+   std::atomic<uint32_t> trnOffQty{0};
+   std::atomic<bool> lstIsTrnOff{true};
+};
+
+/**
+ * @brief LimbsSftyLnFSwtch subclass giving the test access to the FDA state
+ */
+class LsSwtchCbDsptchTstd: public LimbsSftyLnFSwtch{
+public:
+   using LimbsSftyLnFSwtch::LimbsSftyLnFSwtch;
+
+   bool getIsEmrgncyStt(){
+      taskENTER_CRITICAL(&_lsSwtchMux);
+      const bool result{_lsSwtchFdaState == stEmrgncyExcpHndl};
+      taskEXIT_CRITICAL(&_lsSwtchMux);
+
+      return result;
+   }
+   bool getIsFdaStrtStt(){
+      taskENTER_CRITICAL(&_lsSwtchMux);
+      const bool result{_lsSwtchFdaState == stOffNotBHP};
+      taskEXIT_CRITICAL(&_lsSwtchMux);
+
+      return result;
+   }
+};
+
+//===============================>> Global variables (strictly sanctioned) BEGIN
+swtchInptHwCfg_t lftHndHwAttrbts{.inptPin = LftHndPin};
+swtchInptHwCfg_t rghtHndHwAttrbts{.inptPin = RghtHndPin};
+swtchInptHwCfg_t ftHwAttrbts{.inptPin = FtPin};
+swtchBhvrCfg_t lftHndBhvrSUp{.swtchStrtDlyTm = 0, .swtchIsEnbld = true, .swtchVdTm = 5000};
+swtchBhvrCfg_t rghtHndBhvrSUp{.swtchStrtDlyTm = 0, .swtchIsEnbld = true, .swtchVdTm = 5000};
+swtchBhvrCfg_t ftBhvrSUp{.swtchStrtDlyTm = 0, .swtchIsEnbld = false};
+lsSwtchSwCfg_t lsssSwtchWrkngPrm{.ltchRlsActvTm = 40, .prdCyclActvTm = 80};
+gpioPinOtptHwCfg_t ltchRlsIsOnOtpt{.gpioOtptPin = LtchRlsOtptPin, .gpioOtptActHgh = true};
+gpioPinOtptHwCfg_t prdCyclIsOnOtpt{.gpioOtptPin = PrdCyclOtptPin, .gpioOtptActHgh = true};
+otptFnsExctns_t ltchRlsFns{};
+otptFnsExctns_t prdCyclFns{};
+std::atomic<bool> dsptchStlld{true};   // The turn on functions keep the dispatch task stalled while set
+int fldChcksQty{0};
+//=================================>> Global variables (strictly sanctioned) END
+
+//======================================>> General use function prototypes BEGIN
+void chck(const bool &chckRslt, const char* chckName);
+void chckFnsExctns(const char* otptName, const otptFnsExctns_t &fnsExctns);
+bool runCycl(LsSwtchCbDsptchTstd &lsSwtch);
+void trnOffFn(void* argPtr);
+void trnOnFn(void* argPtr);
+template <typename F> bool wtFor(F cndFn);
+//========================================>> General use function prototypes END
+
+int main(){
+   lsSwtchCbDsptchStts_t cbDsptchStts{};
+   lsSwtchEmrgncyStts_t emrgncyStts{};
+   uint8_t cyclsQty{0};
+   fncVdPtrPrmPtrType trnOnFnPtr{trnOnFn};
+   fncVdPtrPrmPtrType trnOffFnPtr{trnOffFn};
+   void* ltchRlsFnsPtr{&ltchRlsFns};
+   void* prdCyclFnsPtr{&prdCyclFns};
+
+   LsSwtchCbDsptchTstd tstSftySwtch (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+   tstSftySwtch.setFnWhnTrnOnLtchRlsPtr(trnOnFnPtr);
+   tstSftySwtch.setTrnOnLtchRlsArgPtr(ltchRlsFnsPtr);
+   tstSftySwtch.setFnWhnTrnOffLtchRlsPtr(trnOffFnPtr);
+   tstSftySwtch.setTrnOffLtchRlsArgPtr(ltchRlsFnsPtr);
+   tstSftySwtch.setFnWhnTrnOnPrdCyclPtr(trnOnFnPtr);
+   tstSftySwtch.setTrnOnPrdCyclArgPtr(prdCyclFnsPtr);
+   tstSftySwtch.setFnWhnTrnOffPrdCyclPtr(trnOffFnPtr);
+   tstSftySwtch.setTrnOffPrdCyclArgPtr(prdCyclFnsPtr);
+   // Inputs released: at their pulled up idle level
+   for(const uint8_t inptPin: {LftHndPin, RghtHndPin, FtPin})
+      shimSetPinLvl(inptPin, HIGH);
+   if(!tstSftySwtch.setOtptPins(ltchRlsIsOnOtpt, prdCyclIsOnOtpt) || !tstSftySwtch.setEvntDrvn(true) || !tstSftySwtch.setCbDsptchd(true) || !tstSftySwtch.begin(LsSwtchPollTm)){
+      fprintf(stderr, "LimbsSftyLnFSwtch object start failed\n");
+      return 1;
+   }
+   shimStrtTmrSvcTsk();
+
+   // Production cycles with the dispatch task stalled, until a request finds the queue full
+   while((cyclsQty < MaxCyclsQty) && !tstSftySwtch.getIsEmrgncyStt() && (fldChcksQty == 0)){
+      chck(runCycl(tstSftySwtch) || tstSftySwtch.getIsEmrgncyStt(), "production cycle with the dispatch task stalled");
+      ++cyclsQty;
+   }
+   tstSftySwtch.getCbDsptchStts(cbDsptchStts);
+   tstSftySwtch.getEmrgncyStts(emrgncyStts);
+   chck(cbDsptchStts.ovrflwQty > 0, "dispatch queue overflow registered");
+   chck(wtFor([&](){return tstSftySwtch.getIsEmrgncyStt();}), "dispatch queue overflow forces the emergency stop state");
+   chck(emrgncyStts.emrgncyStpQty == 1, "forced emergency stop counted");
+   chck((shimGetPinLvl(LtchRlsOtptPin) == LOW) && (shimGetPinLvl(PrdCyclOtptPin) == LOW), "output stage pins inactive after the dispatch queue overflow");
+   printf("Dispatch queue full after %u production cycles: %u requests found the queue full\n", cyclsQty, cbDsptchStts.ovrflwQty);
+
+   // Dispatch task resumed: every queued function is executed, the turn off ones last
+   dsptchStlld = false;
+   std::this_thread::sleep_for(std::chrono::milliseconds(2 * LsSwtchPollTm));
+   chck(wtFor([&](){return ltchRlsFns.lstIsTrnOff && prdCyclFns.lstIsTrnOff;}), "queued functions executed once the dispatch task resumes");
+   chckFnsExctns("latch release", ltchRlsFns);
+   chckFnsExctns("production cycle", prdCyclFns);
+
+   // Recovery and a complete production cycle
+   chck(wtFor([&](){return tstSftySwtch.rcvrEmrgncyStp();}), "recovery accepted once the inputs releases are debounced");
+   chck(wtFor([&](){return tstSftySwtch.getIsFdaStrtStt();}), "FDA back to the start state after the recovery");
+   chck(runCycl(tstSftySwtch), "production cycle after the recovery");
+   chck(wtFor([&](){return ltchRlsFns.lstIsTrnOff && prdCyclFns.lstIsTrnOff;}), "production cycle functions executed after the recovery");
+   shimStopTmrSvcTsk();
+
+   if(fldChcksQty == 0)
+      printf("PASSED\n");
+   else
+      printf("FAILED: %d failed checks\n", fldChcksQty);
+
+   return (fldChcksQty == 0)?0:1;
+}
+
+//===============================>> User Functions Implementations BEGIN
+void chck(const bool &chckRslt, const char* chckName){
+   if(!chckRslt){
+      printf("FAILED %s\n", chckName);
+      ++fldChcksQty;
+   }
+
+   return;
+}
+
+void chckFnsExctns(const char* otptName, const otptFnsExctns_t &fnsExctns){
+   printf("%s functions executed: %u turn on, %u turn off\n", otptName, fnsExctns.trnOnQty.load(), fnsExctns.trnOffQty.load());
+   if(!fnsExctns.lstIsTrnOff || (fnsExctns.trnOffQty < fnsExctns.trnOnQty)){
+      printf("FAILED %s turn off functions: the last executed must be a turn off, and no fewer than the turn on ones\n", otptName);
+      ++fldChcksQty;
+   }
+
+   return;
+}
+
+/**
+ * @brief Runs a production cycle: both hands and foot pressed, then released until the production cycle ends
+ *
+ * @retval true The cycle was completed
+ * @retval false An expected object reaction didn't happen, i.e. the object was stopped
+ */
+bool runCycl(LsSwtchCbDsptchTstd &lsSwtch){
+   bool result{false};
+
+   shimSetPinLvl(LftHndPin, LOW);
+   shimSetPinLvl(RghtHndPin, LOW);
+   if(wtFor([&](){
+      const lsSwtchOtpts_t otptsStts{lssOtptsSttsUnpkg(lsSwtch.getLsSwtchOtptsSttsPkgd())};
+      return (otptsStts.lftHndIsOn && otptsStts.rghtHndIsOn && otptsStts.ftSwIsEnbld) || lsSwtch.getIsEmrgncyStt();
+   })){
+      shimSetPinLvl(FtPin, LOW);
+      result = wtFor([&](){return (shimGetPinLvl(LtchRlsOtptPin) == HIGH) || lsSwtch.getIsEmrgncyStt();}) && !lsSwtch.getIsEmrgncyStt();
+   }
+   for(const uint8_t inptPin: {FtPin, LftHndPin, RghtHndPin})
+      shimSetPinLvl(inptPin, HIGH);
+   if(result)
+      result = wtFor([&](){return (lsSwtch.getIsFdaStrtStt() && (shimGetPinLvl(PrdCyclOtptPin) == LOW)) || lsSwtch.getIsEmrgncyStt();}) && !lsSwtch.getIsEmrgncyStt();
+
+   return result;
+}
+
+void trnOffFn(void* argPtr){
+   otptFnsExctns_t* fnsExctns{static_cast<otptFnsExctns_t*>(argPtr)};
+
+   ++fnsExctns->trnOffQty;
+   fnsExctns->lstIsTrnOff = true;
+
+   return;
+}
+
+void trnOnFn(void* argPtr){
+   otptFnsExctns_t* fnsExctns{static_cast<otptFnsExctns_t*>(argPtr)};
+
+   // Executed by the dispatch task only, the turn on requests are never executed by the update code
+   while(dsptchStlld)
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+   ++fnsExctns->trnOnQty;
+   fnsExctns->lstIsTrnOff = false;
+
+   return;
+}
+
+/**
+ * @brief Waits for a condition set by the object's updates, executed by the shim timer service thread
+ *
+ * @retval true The condition was met
+ * @retval false WtTmOut milliseconds elapsed without the condition being met
+ */
+template <typename F> bool wtFor(F cndFn){
+   const std::chrono::steady_clock::time_point wtStrtTm{std::chrono::steady_clock::now()};
+   bool result{cndFn()};
+
+   while(!result && ((std::chrono::steady_clock::now() - wtStrtTm) < std::chrono::milliseconds(WtTmOut))){
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+      result = cndFn();
+   }
+
+   return result;
+}
+//===============================>> User Functions Implementations END
@@ -0,0 +1,182 @@
+/**
+  ******************************************************************************
+  * @file	: LsSwtchCntntnBnch.cpp
+  * @brief  : Host object lock contention and hold time benchmark for the LimbsSftyLnFSwtch class
+  *
+  * Host build of the LimbsSftyLnFSwtch_Bench_03 example. Each LimbsSftyLnFSwtch
+  * object owns a single spinlock protecting its internal state, emulated on
+  * the host by the shim portMUX spinlock, recursive for the owning thread. The
+  * host threads stand for the target cores, so the contention measured is
+  * that of the same spinlock algorithm, not of the ESP32 memory system:
+  * - Pairs load: 1, 2 and 4 threads execute setLsSwtchOtptsChng(true) and
+  * setLsSwtchOtptsChng(false) pairs -a short critical section that increments
+  * or decrements the outputs change counter- on the same object. As the pairs
+  * are balanced, a true outputs change flag after the run means the lock
+  * failed to provide mutual exclusion
+  * - Update load: one thread executes the object's poll update -the longest
+  * lock hold of the object- while a second one reads the packed status with
+  * getLsSwtchOtptsSttsPkgd(), the status consumers' lock free read
+  *
+  * For each thread the mean, 99th percentile (p99) and maximum time per
+  * operation are reported in nanoseconds through the standard output, the
+  * maximum includes the time spent spinning while other thread held the lock.
+  * The exit status is 1 if the mutual exclusion failed, 0 otherwise.
+  *
+  * Usage:
+  *    LsSwtchCntntnBnch [pairsQty]
+  *
+  * Framework: None, host build
+  * Platform: Linux host, 4 or more hardware threads for the 4 threads run
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 16/10/2026
+  *       Last update:   16/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+//==============================================>> General use definitions BEGIN
+#define BnchItrtnsQty 200000UL  // Default operations executed by each load thread
+#define BnchMaxThrdsQty 4
+//================================================>> General use definitions END
+
+/**
+ * @brief Load thread results
+ */
+struct bnchLoadRslt_t{
+   uint64_t ttlNs;
+   uint32_t p99Ns;
+   uint32_t maxNs;
+};
+
+/**
+ * @brief LimbsSftyLnFSwtch subclass giving the benchmark access to the poll update
+ */
+class LsSwtchBnch: public LimbsSftyLnFSwtch{
+public:
+   using LimbsSftyLnFSwtch::LimbsSftyLnFSwtch;
+
+   void pollCb(){
+      lsSwtchPollCb(_lsSwtchPollTmrHndl);
+   }
+   bool stopPollTmr(){
+      return (xTimerStop(_lsSwtchPollTmrHndl, portMAX_DELAY) == pdPASS);
+   }
+};
+
+//======================================>> General use function prototypes BEGIN
+void prntRslt(const char* loadName, const uint8_t &thrdNum, const bnchLoadRslt_t &rslt, const unsigned long int &itrtnsQty);
+template <typename F> bnchLoadRslt_t runLoad(F loadFn, const unsigned long int &itrtnsQty, std::atomic<uint8_t> &rdyThrdsQty, const uint8_t &thrdsQty);
+//========================================>> General use function prototypes END
+
+int main(int argc, char* argv[]){
+   const unsigned long int itrtnsQty{(argc > 1)?strtoul(argv[1], nullptr, 10):BnchItrtnsQty};
+   bnchLoadRslt_t loadRslt[BnchMaxThrdsQty]{};
+   std::vector<std::thread> loadThrds{};
+   std::atomic<uint8_t> rdyThrdsQty{0};
+   std::atomic<bool> pollLoadEnd{false};
+   bool result{true};
+
+   swtchInptHwCfg_t lftHndHwAttrbts{.inptPin = GPIO_NUM_4};
+   swtchInptHwCfg_t rghtHndHwAttrbts{.inptPin = GPIO_NUM_2};
+   swtchInptHwCfg_t ftHwAttrbts{.inptPin = GPIO_NUM_5};
+   swtchBhvrCfg_t lftHndBhvrSUp{};
+   swtchBhvrCfg_t rghtHndBhvrSUp{};
+   swtchBhvrCfg_t ftBhvrSUp{};
+   lsSwtchSwCfg_t lsssSwtchWrkngPrm{.ltchRlsActvTm = 1500, .prdCyclActvTm = 6000};
+
+   LsSwtchBnch bnchSftySwtch (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+   printf("LimbsSftyLnFSwtch host object lock benchmark, %lu operations per thread, %u hardware threads\n", itrtnsQty, std::thread::hardware_concurrency());
+
+   for(uint8_t thrdsQty{1}; thrdsQty <= BnchMaxThrdsQty; thrdsQty *= 2){
+      rdyThrdsQty = 0;
+      for(uint8_t thrdNum{0}; thrdNum < thrdsQty; ++thrdNum){
+         loadThrds.emplace_back([&, thrdNum, thrdsQty](){
+            loadRslt[thrdNum] = runLoad([&](){
+               bnchSftySwtch.setLsSwtchOtptsChng(true);
+               bnchSftySwtch.setLsSwtchOtptsChng(false);
+            }, itrtnsQty, rdyThrdsQty, thrdsQty);
+         });
+      }
+      for(std::thread &loadThrd: loadThrds)
+         loadThrd.join();
+      loadThrds.clear();
+      for(uint8_t thrdNum{0}; thrdNum < thrdsQty; ++thrdNum)
+         prntRslt((thrdsQty == 1)?"Uncontended pairs":"Contended pairs  ", thrdNum, loadRslt[thrdNum], itrtnsQty);
+      printf("Outputs change flag after the run: %s\n", bnchSftySwtch.getLsSwtchOtptsChng()?"true -> mutual exclusion FAILED":"false -> Ok");
+      if(bnchSftySwtch.getLsSwtchOtptsChng())
+         result = false;
+   }
+
+   // Poll updates on one thread, status reads on the other, until the reads are completed
+   if(!bnchSftySwtch.begin() || !bnchSftySwtch.stopPollTmr()){
+      fprintf(stderr, "LimbsSftyLnFSwtch object start failed\n");
+      return 1;
+   }
+   rdyThrdsQty = 0;
+   loadThrds.emplace_back([&](){
+      loadRslt[0] = runLoad([&](){bnchSftySwtch.pollCb();}, itrtnsQty, rdyThrdsQty, 2);
+      while(!pollLoadEnd)
+         bnchSftySwtch.pollCb();
+   });
+   loadThrds.emplace_back([&](){
+      loadRslt[1] = runLoad([&](){bnchSftySwtch.getLsSwtchOtptsSttsPkgd();}, itrtnsQty, rdyThrdsQty, 2);
+      pollLoadEnd = true;
+   });
+   for(std::thread &loadThrd: loadThrds)
+      loadThrd.join();
+   loadThrds.clear();
+   prntRslt("Poll update      ", 0, loadRslt[0], itrtnsQty);
+   prntRslt("Status read      ", 1, loadRslt[1], itrtnsQty);
+
+   return result?0:1;
+}
+
+//===============================>> User Functions Implementations BEGIN
+void prntRslt(const char* loadName, const uint8_t &thrdNum, const bnchLoadRslt_t &rslt, const unsigned long int &itrtnsQty){
+   printf("%s thread %u: mean %6llu ns | p99 %6u ns | max %8u ns per operation\n",
+      loadName, thrdNum, static_cast<unsigned long long>(rslt.ttlNs / itrtnsQty), rslt.p99Ns, rslt.maxNs);
+
+   return;
+}
+
+/**
+ * @brief Executes the load function itrtnsQty times once all the run's threads are ready, timing each execution
+ */
+template <typename F> bnchLoadRslt_t runLoad(F loadFn, const unsigned long int &itrtnsQty, std::atomic<uint8_t> &rdyThrdsQty, const uint8_t &thrdsQty){
+   bnchLoadRslt_t result{};
+   std::vector<uint32_t> smplsNs(std::max<unsigned long int>(itrtnsQty, 1));
+   std::chrono::steady_clock::time_point smplStrtTm{};
+
+   ++rdyThrdsQty;
+   while(rdyThrdsQty < thrdsQty){
+   }
+   for(uint32_t &smplNs: smplsNs){
+      smplStrtTm = std::chrono::steady_clock::now();
+      loadFn();
+      smplNs = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - smplStrtTm).count());
+      result.ttlNs += smplNs;
+   }
+   std::sort(smplsNs.begin(), smplsNs.end());
+   result.p99Ns = smplsNs[(smplsNs.size() * 99) / 100];
+   result.maxNs = smplsNs.back();
+
+   return result;
+}
+//===============================>> User Functions Implementations END
@@ -0,0 +1,272 @@
+/**
+  ******************************************************************************
+  * @file	: LsSwtchEmrgncyTst.cpp
+  * @brief  : Host emergency stop reaction and recovery test for the LimbsSftyLnFSwtch class
+  *
+  * Drives a LimbsSftyLnFSwtch object in the event driven mode through the shim
+  * GPIO pins: the hands and foot switches inputs, the emergency stop input and
+  * the latch release and production cycle output stage pins. The timer service
+  * is executed by the shim background thread, as the target timer service task.
+  * The following behaviors are checked:
+  * - The emergency stop input and an output pins writer function are refused
+  * by each other's setter
+  * - An emergency stop in the middle of the latch release phase sets the output
+  * pins to their inactive levels before the input edge ISR returns, and the
+  * FDA enters the stEmrgncyExcpHndl state by the deferred call
+  * - The recovery is refused while the hands inputs are pressed, even if the
+  * hands switches are disabled by the FDA, and accepted once they are released
+  * - A normally closed emergency stop contact with the internal pull-up stops
+  * the object when the contact opens, as it does when pressed or when its wire
+  * is broken
+  *
+  * The reaction times are then measured over repeated stop and recovery runs
+  * and reported through the standard output: from the emergency stop input
+  * edge to the output pins written -the ISR path- and to the FDA state change
+  * -the deferred path, bounded on the host by the shim timer service period-.
+  *
+  * Usage:
+  *    LsSwtchEmrgncyTst [runsQty]
+  *
+  * Framework: None, host build
+  * Platform: Linux host
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 16/10/2026
+  *       Last update:   16/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+#include <LsSwtchHostShim.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+//==============================================>> General use definitions BEGIN
+#define LsSwtchPollTm 20
+#define LftHndPin GPIO_NUM_4
+#define RghtHndPin GPIO_NUM_2
+#define FtPin GPIO_NUM_5
+#define EmrgncyStpPin GPIO_NUM_18
+#define LtchRlsOtptPin GPIO_NUM_23
+#define PrdCyclOtptPin GPIO_NUM_22
+#define NcLftHndPin GPIO_NUM_12
+#define NcRghtHndPin GPIO_NUM_13
+#define NcFtPin GPIO_NUM_14
+#define NcEmrgncyStpPin GPIO_NUM_19
+#define WtTmOut 2000 // Maximum time -in milliseconds- waited for each expected object reaction
+#define RctnRunsQty 200 // Default quantity of stop and recovery runs for the reaction times
+//================================================>> General use definitions END
+
+/**
+ * @brief LimbsSftyLnFSwtch subclass giving the test access to the FDA state
+ */
+class LsSwtchEmrgncyTstd: public LimbsSftyLnFSwtch{
+public:
+   using LimbsSftyLnFSwtch::LimbsSftyLnFSwtch;
+
+   bool getIsEmrgncyStt(){
+      taskENTER_CRITICAL(&_lsSwtchMux);
+      const bool result{_lsSwtchFdaState == stEmrgncyExcpHndl};
+      taskEXIT_CRITICAL(&_lsSwtchMux);
+
+      return result;
+   }
+   bool getIsFdaStrtStt(){
+      taskENTER_CRITICAL(&_lsSwtchMux);
+      const bool result{_lsSwtchFdaState == stOffNotBHP};
+      taskEXIT_CRITICAL(&_lsSwtchMux);
+
+      return result;
+   }
+};
+
+//===============================>> Global variables (strictly sanctioned) BEGIN
+swtchInptHwCfg_t lftHndHwAttrbts{.inptPin = LftHndPin};
+swtchInptHwCfg_t rghtHndHwAttrbts{.inptPin = RghtHndPin};
+swtchInptHwCfg_t ftHwAttrbts{.inptPin = FtPin};
+swtchInptHwCfg_t emrgncyStpHwAttrbts{.inptPin = EmrgncyStpPin};   // Normally open, pulled up: active low
+swtchInptHwCfg_t ncLftHndHwAttrbts{.inptPin = NcLftHndPin};
+swtchInptHwCfg_t ncRghtHndHwAttrbts{.inptPin = NcRghtHndPin};
+swtchInptHwCfg_t ncFtHwAttrbts{.inptPin = NcFtPin};
+swtchInptHwCfg_t ncEmrgncyStpHwAttrbts{.inptPin = NcEmrgncyStpPin, .typeNO = false};   // Normally closed, pulled up: active high
+swtchBhvrCfg_t lftHndBhvrSUp{.swtchStrtDlyTm = 0, .swtchIsEnbld = true, .swtchVdTm = 5000};
+swtchBhvrCfg_t rghtHndBhvrSUp{.swtchStrtDlyTm = 0, .swtchIsEnbld = true, .swtchVdTm = 5000};
+swtchBhvrCfg_t ftBhvrSUp{.swtchStrtDlyTm = 0, .swtchIsEnbld = false};
+lsSwtchSwCfg_t lsssSwtchWrkngPrm{.ltchRlsActvTm = 1500, .prdCyclActvTm = 6000};
+gpioPinOtptHwCfg_t ltchRlsIsOnOtpt{.gpioOtptPin = LtchRlsOtptPin, .gpioOtptActHgh = true};
+gpioPinOtptHwCfg_t prdCyclIsOnOtpt{.gpioOtptPin = PrdCyclOtptPin, .gpioOtptActHgh = true};
+int fldChcksQty{0};
+//=================================>> Global variables (strictly sanctioned) END
+
+//======================================>> General use function prototypes BEGIN
+void chck(const bool &chckRslt, const char* chckName);
+void nullOtptPinsWrtr(uint64_t stPinsMsk, uint64_t clrPinsMsk, void* wrtrArg);
+void prntRctnTms(const char* rctnName, std::vector<uint32_t> &rctnsNs);
+template <typename F> bool wtFor(F cndFn);
+//========================================>> General use function prototypes END
+
+int main(int argc, char* argv[]){
+   const unsigned long int rctnRunsQty{(argc > 1)?strtoul(argv[1], nullptr, 10):RctnRunsQty};
+   std::vector<uint32_t> otptsOffNs{};
+   std::vector<uint32_t> fdaEntryNs{};
+   std::chrono::steady_clock::time_point rqstTm{};
+   lsSwtchEmrgncyStts_t emrgncyStts{};
+
+   // Setters mutual exclusion, checked on objects never started
+   {
+      LimbsSftyLnFSwtch wrtrSftySwtch (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+      LimbsSftyLnFSwtch emrgncySftySwtch (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+      chck(wrtrSftySwtch.setOtptPinsWrtr(nullOtptPinsWrtr), "pins writer set with no emergency stop input");
+      chck(!wrtrSftySwtch.setEmrgncyStpPin(emrgncyStpHwAttrbts), "emergency stop input refused while a pins writer is set");
+      chck(emrgncySftySwtch.setEmrgncyStpPin(emrgncyStpHwAttrbts), "emergency stop input set with no pins writer");
+      chck(!emrgncySftySwtch.setOtptPinsWrtr(nullOtptPinsWrtr), "pins writer refused while the emergency stop input is set");
+      chck(emrgncySftySwtch.setOtptPinsWrtr(nullptr), "GPIO registers writes restored while the emergency stop input is set");
+   }
+
+   // Normally closed pulled up emergency stop contact, the timer service is executed by the waits: the pull-up must set the active level when the contact opens
+   {
+      LsSwtchEmrgncyTstd ncSftySwtch (ncLftHndHwAttrbts, lftHndBhvrSUp, ncRghtHndHwAttrbts, rghtHndBhvrSUp, ncFtHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+      for(const uint8_t inptPin: {NcLftHndPin, NcRghtHndPin, NcFtPin})
+         shimSetPinLvl(inptPin, HIGH);
+      shimSetPinLvl(NcEmrgncyStpPin, LOW);   // Contact closed
+      if(!ncSftySwtch.setEmrgncyStpPin(ncEmrgncyStpHwAttrbts) || !ncSftySwtch.begin(LsSwtchPollTm)){
+         fprintf(stderr, "Normally closed emergency stop LimbsSftyLnFSwtch object start failed\n");
+         return 1;
+      }
+      shimRunTmrSvc();
+      ncSftySwtch.getEmrgncyStts(emrgncyStts);
+      chck(!ncSftySwtch.getIsEmrgncyStt() && (emrgncyStts.emrgncyStpQty == 0), "normally closed contact closed: object not stopped");
+      shimRlsPin(NcEmrgncyStpPin);   // Contact opened by the press, or a broken wire
+      chck(shimGetPinLvl(NcEmrgncyStpPin) == HIGH, "normally closed contact opened: pulled up to the active level");
+      chck(wtFor([&](){shimRunTmrSvc(); return ncSftySwtch.getIsEmrgncyStt();}), "normally closed contact opened: FDA enters the emergency stop state");
+      ncSftySwtch.getEmrgncyStts(emrgncyStts);
+      chck(emrgncyStts.emrgncyStpQty == 1, "normally closed contact opened: emergency stop counted");
+      shimSetPinLvl(NcEmrgncyStpPin, LOW);
+      chck(ncSftySwtch.rcvrEmrgncyStp(), "normally closed contact closed again: recovery accepted");
+      emrgncyStts = {};
+   }
+
+   LsSwtchEmrgncyTstd tstSftySwtch (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+   // Inputs released and emergency stop inactive: all of them at their pulled up idle level
+   for(const uint8_t inptPin: {LftHndPin, RghtHndPin, FtPin, EmrgncyStpPin})
+      shimSetPinLvl(inptPin, HIGH);
+   if(!tstSftySwtch.setEmrgncyStpPin(emrgncyStpHwAttrbts) || !tstSftySwtch.setOtptPins(ltchRlsIsOnOtpt, prdCyclIsOnOtpt) || !tstSftySwtch.setEvntDrvn(true) || !tstSftySwtch.begin(LsSwtchPollTm)){
+      fprintf(stderr, "LimbsSftyLnFSwtch object start failed\n");
+      return 1;
+   }
+   shimStrtTmrSvcTsk();
+
+   // Emergency stop in the middle of the latch release phase
+   shimSetPinLvl(LftHndPin, LOW);
+   shimSetPinLvl(RghtHndPin, LOW);
+   chck(wtFor([&](){
+      const lsSwtchOtpts_t otptsStts{lssOtptsSttsUnpkg(tstSftySwtch.getLsSwtchOtptsSttsPkgd())};
+      return otptsStts.lftHndIsOn && otptsStts.rghtHndIsOn && otptsStts.ftSwIsEnbld;
+   }), "both hands on enable the foot switch");
+   shimSetPinLvl(FtPin, LOW);
+   chck(wtFor([&](){return shimGetPinLvl(LtchRlsOtptPin) == HIGH;}), "foot switch press activates the latch release output pin");
+   shimSetPinLvl(FtPin, HIGH);
+   shimSetPinLvl(EmrgncyStpPin, LOW);
+   chck(shimGetPinLvl(LtchRlsOtptPin) == LOW, "latch release output pin inactive when the emergency stop ISR returns");
+   chck(shimGetPinLvl(PrdCyclOtptPin) == LOW, "production cycle output pin inactive when the emergency stop ISR returns");
+   chck(wtFor([&](){return tstSftySwtch.getIsEmrgncyStt();}), "FDA enters the emergency stop state");
+   tstSftySwtch.getEmrgncyStts(emrgncyStts);
+   chck(emrgncyStts.emrgncyStpQty == 1, "emergency stop counted");
+   chck(!tstSftySwtch.getLtchRlsIsOn() && !tstSftySwtch.getPrdCyclIsOn(), "latch release and production cycle off in the emergency stop state");
+
+   // Recovery with the hands still pressed: their switches are disabled in the latch release phase, the inputs levels must refuse it
+   shimSetPinLvl(EmrgncyStpPin, HIGH);
+   chck(!tstSftySwtch.rcvrEmrgncyStp(), "recovery refused while the hands inputs are pressed");
+   tstSftySwtch.getEmrgncyStts(emrgncyStts);
+   chck(emrgncyStts.rcvrRfsdQty == 1, "refused recovery counted");
+   shimSetPinLvl(LftHndPin, HIGH);
+   shimSetPinLvl(RghtHndPin, HIGH);
+   chck(wtFor([&](){return tstSftySwtch.rcvrEmrgncyStp();}), "recovery accepted once the hands inputs are released");
+   chck(wtFor([&](){return tstSftySwtch.getIsFdaStrtStt();}), "FDA back to the start state after the recovery");
+
+   // Reaction times, the outputs are written by the ISR in every run even if already inactive
+   for(unsigned long int runNum{0}; (runNum < rctnRunsQty) && (fldChcksQty == 0); ++runNum){
+      rqstTm = std::chrono::steady_clock::now();
+      shimSetPinLvl(EmrgncyStpPin, LOW);
+      otptsOffNs.push_back(static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - rqstTm).count()));
+      chck(wtFor([&](){return tstSftySwtch.getIsEmrgncyStt();}), "FDA enters the emergency stop state in the reaction runs");
+      fdaEntryNs.push_back(static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - rqstTm).count()));
+      shimSetPinLvl(EmrgncyStpPin, HIGH);
+      chck(tstSftySwtch.rcvrEmrgncyStp(), "recovery accepted in the reaction runs");
+   }
+   shimStopTmrSvcTsk();
+
+   if(fldChcksQty == 0){
+      tstSftySwtch.getEmrgncyStts(emrgncyStts);
+      printf("Emergency stop reaction times, %zu runs\n", otptsOffNs.size());
+      prntRctnTms("Input edge to output pins off (ISR)", otptsOffNs);
+      prntRctnTms("Input edge to FDA emergency state", fdaEntryNs);
+      printf("Object registered: output pins off max %u us | FDA entry max %u us | %u stops, %u recoveries\n",
+         emrgncyStts.maxOtptsOffTmUs, emrgncyStts.maxFdaEntryTmUs, emrgncyStts.emrgncyStpQty, emrgncyStts.rcvrQty);
+   }
+   if(fldChcksQty == 0)
+      printf("PASSED\n");
+   else
+      printf("FAILED: %d failed checks\n", fldChcksQty);
+
+   return (fldChcksQty == 0)?0:1;
+}
+
+//===============================>> User Functions Implementations BEGIN
+void chck(const bool &chckRslt, const char* chckName){
+   if(!chckRslt){
+      printf("FAILED %s\n", chckName);
+      ++fldChcksQty;
+   }
+
+   return;
+}
+
+void nullOtptPinsWrtr(uint64_t stPinsMsk, uint64_t clrPinsMsk, void* wrtrArg){
+
+   return;
+}
+
+void prntRctnTms(const char* rctnName, std::vector<uint32_t> &rctnsNs){
+   uint64_t ttlNs{0};
+
+   std::sort(rctnsNs.begin(), rctnsNs.end());
+   for(const uint32_t &rctnNs: rctnsNs)
+      ttlNs += rctnNs;
+   printf("%-38s mean %9llu ns | p99 %9u ns | max %9u ns\n", rctnName, static_cast<unsigned long long>(ttlNs / rctnsNs.size()), rctnsNs[(rctnsNs.size() * 99) / 100], rctnsNs.back());
+
+   return;
+}
+
+/**
+ * @brief Waits for a condition set by the object's updates, executed by the shim timer service thread
+ *
+ * @retval true The condition was met
+ * @retval false WtTmOut milliseconds elapsed without the condition being met
+ */
+template <typename F> bool wtFor(F cndFn){
+   const std::chrono::steady_clock::time_point wtStrtTm{std::chrono::steady_clock::now()};
+   bool result{cndFn()};
+
+   while(!result && ((std::chrono::steady_clock::now() - wtStrtTm) < std::chrono::milliseconds(WtTmOut))){
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+      result = cndFn();
+   }
+
+   return result;
+}
+//===============================>> User Functions Implementations END
@@ -0,0 +1,176 @@
+/**
+  ******************************************************************************
+  * @file	: LsSwtchPollBnch.cpp
+  * @brief  : Host poll cycle cost benchmark for the LimbsSftyLnFSwtch class
+  *
+  * Host build of the LimbsSftyLnFSwtch_Bench_01 example: measures the execution
+  * cost of the LimbsSftyLnFSwtch polling hot path on the Linux host, so the
+  * regressions are detected on every build without flashing a board. The
+  * measured stages are:
+  * - The complete lsSwtchPollCb() timer callback
+  * - The _getUndrlSwtchStts() underlying switches status recovery
+  * - The _updFdaState() state machine update
+  *
+  * Each stage is measured with the underlying switches released, and with both
+  * hands switches pressed -set through the shim MPBttns stand-ins- so the FDA
+  * hands on states are measured too. For each one the following values are
+  * reported through the standard output:
+  * - Mean execution time in nanoseconds per poll (ns/poll)
+  * - 50th percentile (p50) and 99th percentile (p99) latency
+  * - Maximum latency observed
+  * - Heap allocations per poll cycle, counted by the shim global operator new
+  *
+  * Usage:
+  *    LsSwtchPollBnch [samplesQty]
+  * The exit status is 0 if no stage made heap allocations, 1 otherwise, so the
+  * benchmark is registered as a ctest test guarding the zero allocations poll.
+  *
+  * Framework: None, host build
+  * Platform: Linux host
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 16/10/2026
+  *       Last update:   16/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+#include <LsSwtchHostShim.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+//==============================================>> General use definitions BEGIN
+#define UndrlyngMPBttnPollTm 20
+#define LsSwtchPollTm 20
+#define BnchSmplsQty 20000  // Default quantity of samples taken for each measured stage
+//================================================>> General use definitions END
+
+/**
+ * @brief LimbsSftyLnFSwtch subclass giving the benchmark access to the polling hot path stages
+ */
+class LsSwtchBnch: public LimbsSftyLnFSwtch{
+public:
+   using LimbsSftyLnFSwtch::LimbsSftyLnFSwtch;
+
+   bool stopPollTmr(){
+      return (xTimerStop(_lsSwtchPollTmrHndl, portMAX_DELAY) == pdPASS);
+   }
+   void pollCb(){
+      lsSwtchPollCb(_lsSwtchPollTmrHndl);
+   }
+   void getUndrlSwtchStts(){
+      _getUndrlSwtchStts();
+   }
+   void updFdaState(){
+      _updCurTimeMs();
+      _updFdaState();
+   }
+};
+
+/**
+ * @brief Benchmark run results for one measured stage
+ */
+struct bnchRslt_t{
+   uint32_t nsPerPoll;
+   uint32_t p50Ns;
+   uint32_t p99Ns;
+   uint32_t maxNs;
+   float allocsPerPoll;
+};
+
+//======================================>> General use function prototypes BEGIN
+void prntRslt(const char* stgName, const bnchRslt_t &rslt);
+template <typename F> bnchRslt_t runBnch(F stgFn, std::vector<uint32_t> &smplsNs);
+//========================================>> General use function prototypes END
+
+int main(int argc, char* argv[]){
+   const size_t smplsQty{(argc > 1)?static_cast<size_t>(strtoul(argv[1], nullptr, 10)):BnchSmplsQty};
+   const uint32_t hndPrssdSttsPkgd{(1UL << IsOnBitPos) | (1UL << IsEnabledBitPos)};
+   const uint32_t hndRlsdSttsPkgd{1UL << IsEnabledBitPos};
+   std::vector<uint32_t> smplsNs(std::max<size_t>(smplsQty, 1));
+   float maxAllocsPerPoll{0.0};
+   bnchRslt_t rslt{};
+
+   swtchInptHwCfg_t lftHndHwAttrbts{.inptPin = GPIO_NUM_4, .typeNO = true, .pulledUp = true, .dbncTime = 0UL};
+   swtchInptHwCfg_t rghtHndHwAttrbts{.inptPin = GPIO_NUM_2, .typeNO = true, .pulledUp = true, .dbncTime = 0UL};
+   swtchInptHwCfg_t ftHwAttrbts{.inptPin = GPIO_NUM_5, .typeNO = true, .pulledUp = true, .dbncTime = 0UL};
+   swtchBhvrCfg_t lftHndBhvrSUp{.swtchStrtDlyTm = 100, .swtchIsEnbld = true, .swtchVdTm = 5000};
+   swtchBhvrCfg_t rghtHndBhvrSUp{.swtchStrtDlyTm = 100, .swtchIsEnbld = true, .swtchVdTm = 5000};
+   swtchBhvrCfg_t ftBhvrSUp{.swtchStrtDlyTm = 200, .swtchIsEnbld = false};
+   lsSwtchSwCfg_t lsssSwtchWrkngPrm{.ltchRlsActvTm = 1500, .prdCyclActvTm = 6000};
+
+   LsSwtchBnch bnchSftySwtch (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+   bnchSftySwtch.setUndrlSwtchsPollDelay(UndrlyngMPBttnPollTm);
+   if(!bnchSftySwtch.begin(LsSwtchPollTm) || !bnchSftySwtch.stopPollTmr()){
+      fprintf(stderr, "LimbsSftyLnFSwtch object start failed\n");
+      return 1;
+   }
+
+   printf("LimbsSftyLnFSwtch host poll cycle benchmark, %zu samples per stage\n", smplsNs.size());
+   for(uint8_t scnrNum{0}; scnrNum < 2; ++scnrNum){
+      bnchSftySwtch.getLftHndSwtchPtr()->shimSetOtptsSttsPkgd((scnrNum == 0)?hndRlsdSttsPkgd:hndPrssdSttsPkgd);
+      bnchSftySwtch.getRghtHndSwtchPtr()->shimSetOtptsSttsPkgd((scnrNum == 0)?hndRlsdSttsPkgd:hndPrssdSttsPkgd);
+      printf("%s\n", (scnrNum == 0)?"Switches released:":"Both hands switches pressed:");
+
+      rslt = runBnch([&](){bnchSftySwtch.pollCb();}, smplsNs);
+      prntRslt("lsSwtchPollCb", rslt);
+      maxAllocsPerPoll = std::max(maxAllocsPerPoll, rslt.allocsPerPoll);
+      rslt = runBnch([&](){bnchSftySwtch.getUndrlSwtchStts();}, smplsNs);
+      prntRslt("_getUndrlSwtchStts", rslt);
+      maxAllocsPerPoll = std::max(maxAllocsPerPoll, rslt.allocsPerPoll);
+      rslt = runBnch([&](){bnchSftySwtch.updFdaState();}, smplsNs);
+      prntRslt("_updFdaState", rslt);
+      maxAllocsPerPoll = std::max(maxAllocsPerPoll, rslt.allocsPerPoll);
+   }
+   if(maxAllocsPerPoll > 0.0)
+      fprintf(stderr, "The polling hot path made heap allocations\n");
+
+   return (maxAllocsPerPoll > 0.0)?1:0;
+}
+
+//===============================>> User Functions Implementations BEGIN
+void prntRslt(const char* stgName, const bnchRslt_t &rslt){
+   printf("%-20s %8u ns/poll | p50 %8u ns | p99 %8u ns | max %8u ns | %.3f allocs/poll\n",
+      stgName, rslt.nsPerPoll, rslt.p50Ns, rslt.p99Ns, rslt.maxNs, rslt.allocsPerPoll);
+
+   return;
+}
+
+/**
+ * @brief Runs one execution of the stage function per sample slot, measuring each one with the host monotonic clock
+ */
+template <typename F> bnchRslt_t runBnch(F stgFn, std::vector<uint32_t> &smplsNs){
+   bnchRslt_t rslt{};
+   uint32_t newOprtrCntBfr{0};
+   std::chrono::steady_clock::time_point smplStrtTm{};
+   uint64_t ttlNs{0};
+
+   newOprtrCntBfr = shimGetNewOprtrCnt();
+   for(uint32_t &smplNs: smplsNs){
+      smplStrtTm = std::chrono::steady_clock::now();
+      stgFn();
+      smplNs = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - smplStrtTm).count());
+      ttlNs += smplNs;
+   }
+   rslt.allocsPerPoll = static_cast<float>(shimGetNewOprtrCnt() - newOprtrCntBfr) / smplsNs.size();
+
+   std::sort(smplsNs.begin(), smplsNs.end());
+   rslt.nsPerPoll = static_cast<uint32_t>(ttlNs / smplsNs.size());
+   rslt.p50Ns = smplsNs[(smplsNs.size() * 50) / 100];
+   rslt.p99Ns = smplsNs[(smplsNs.size() * 99) / 100];
+   rslt.maxNs = smplsNs.back();
+
+   return rslt;
+}
+//===============================>> User Functions Implementations END
@@ -0,0 +1,271 @@
+/**
+  ******************************************************************************
+  * @file	: LsSwtchRplyTst.cpp
+  * @brief  : Host trace replay test for the LsSwtchRplyr class
+  *
+  * Replays recorded input traces through LsSwtchRplyr objects and compares the
+  * packed status sequences produced -virtual time and value of each change-
+  * against golden sequences. The golden sequences were checked flag by flag
+  * against the expected FDA behavior, any difference is a behavior change of
+  * the FDA or of the underlying switches behavior model:
+  * - A complete production cycle: hands start delays, foot start delay, latch
+  * release and production cycle phases, hands enabled at the cycle end
+  * - Both hands held past their voiding time
+  * - The foot switch pressed before the hands, with no production cycle
+  *
+  * Each trace is replayed in a single rplyTrc() call, in two consecutive calls
+  * and after a rstRply() of a used replayer, all of them must produce the
+  * golden sequence. The rstRply() method is also checked to clear the
+  * emergency stop state, both when the FDA is already in the emergency state
+  * and when the stop is still pending, the replays following the reset must
+  * produce the golden sequence with no emergency stop.
+  *
+  * The milliseconds time source extension is checked with a 32 bits counter
+  * source wrapping around: the object's time base must keep advancing across
+  * the wrap around.
+  *
+  * The packed status published before the first replay step is the seeded
+  * initial status, the same for a fresh and for a restarted replayer, and it's
+  * not reported as a change.
+  *
+  * Framework: None, host build
+  * Platform: Linux host
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 16/10/2026
+  *       Last update:   16/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+#include <cstdio>
+#include <vector>
+
+//==============================================>> General use definitions BEGIN
+#define RplyStpTm 20
+#define RplyEndTm 9000
+#define RplySdOtptsSttsPkgd 0x009   // Initial packed status: both hands enabled, the foot switch disabled
+#define RplyWrpTm 3000  // Virtual time of the 32 bits time source wrap around
+//================================================>> General use definitions END
+
+/**
+ * @brief Packed status change produced by a replay
+ */
+struct sttsChng_t{
+   unsigned long int chngTm;
+   uint32_t otptsSttsPkgd;
+};
+
+/**
+ * @brief Recorded input trace and the golden packed status sequence its replay must produce
+ */
+struct rplyCase_t{
+   const char* caseName;
+   std::vector<lsSwtchTrcEvnt_t> trcEvnts;
+   std::vector<sttsChng_t> gldnSttsChngs;
+};
+
+/**
+ * @brief LsSwtchRplyr subclass giving the test access to the FDA state, the pending emergency stop flag and a wrapping time source
+ */
+class LsSwtchRplyrTst: public LsSwtchRplyr{
+private:
+   static unsigned long int _wrpdClkRd(void* rplyrArg){
+      // The virtual clock shifted to wrap around the 32 bits counter at RplyWrpTm
+      return static_cast<uint32_t>(static_cast<LsSwtchRplyrTst*>(rplyrArg)->_vrtlClkMs + (0x100000000ULL - RplyWrpTm));
+   }
+public:
+   using LsSwtchRplyr::LsSwtchRplyr;
+
+   uint64_t getTmBsUs(){
+      _updCurTimeMs();
+      return _curTimeUs;
+   }
+   void setVrtlClkMs(const unsigned long int &newVal){
+      _vrtlClkMs = newVal;
+   }
+   void setWrpdTmSrc(){
+      setTmSrc(_wrpdClkRd, this);
+   }
+   bool getIsEmrgncyStt(){
+      return _lsSwtchFdaState == stEmrgncyExcpHndl;
+   }
+   bool getIsEmrgncyStpPndng(){
+      return _emrgncyStpPndng;
+   }
+   bool getIsFdaStrtStt(){
+      return _lsSwtchFdaState == stOffNotBHP;
+   }
+};
+
+//===============================>> Global variables (strictly sanctioned) BEGIN
+const std::vector<rplyCase_t> rplyCases{
+   {
+      "Production cycle",
+      {{0, lftHndInptId, true}, {60, rghtHndInptId, true}, {450, ftInptId, true}, {700, ftInptId, false}, {2000, lftHndInptId, false}, {2040, rghtHndInptId, false}},
+      {{100, 0x00B}, {160, 0x05B}, {660, 0x092}, {680, 0x300}, {2180, 0x200}, {6680, 0x009}}
+   },
+   {
+      "Hands voided",
+      {{0, lftHndInptId, true}, {80, rghtHndInptId, true}, {6000, rghtHndInptId, false}, {6100, lftHndInptId, false}},
+      {{100, 0x00B}, {180, 0x05B}, {5100, 0x01D}, {5180, 0x02D}, {6000, 0x00D}, {6100, 0x009}}
+   },
+   {
+      "Foot pressed first",
+      {{0, ftInptId, true}, {100, lftHndInptId, true}, {150, rghtHndInptId, true}, {400, ftInptId, false}, {600, lftHndInptId, false}, {620, rghtHndInptId, false}},
+      {{200, 0x00B}, {260, 0x05B}, {600, 0x019}, {620, 0x009}}
+   },
+};
+swtchInptHwCfg_t lftHndHwAttrbts{.inptPin = GPIO_NUM_4};
+swtchInptHwCfg_t rghtHndHwAttrbts{.inptPin = GPIO_NUM_2};
+swtchInptHwCfg_t ftHwAttrbts{.inptPin = GPIO_NUM_5};
+swtchBhvrCfg_t lftHndBhvrSUp{.swtchStrtDlyTm = 100, .swtchIsEnbld = true, .swtchVdTm = 5000};
+swtchBhvrCfg_t rghtHndBhvrSUp{.swtchStrtDlyTm = 100, .swtchIsEnbld = true, .swtchVdTm = 5000};
+swtchBhvrCfg_t ftBhvrSUp{.swtchStrtDlyTm = 200, .swtchIsEnbld = false};
+lsSwtchSwCfg_t lsssSwtchWrkngPrm{.ltchRlsActvTm = 1500, .prdCyclActvTm = 6000};
+int fldChcksQty{0};
+//=================================>> Global variables (strictly sanctioned) END
+
+//======================================>> General use function prototypes BEGIN
+void chck(const bool &chckRslt, const char* caseName, const char* chckName);
+bool cmpSttsChngs(const std::vector<sttsChng_t> &sttsChngs, const std::vector<sttsChng_t> &gldnSttsChngs, const char* caseName, const char* chckName);
+void rcrdSttsChng(unsigned long int chngTm, uint32_t otptsSttsPkgd, void* sttsChngsArg);
+//========================================>> General use function prototypes END
+
+int main(){
+   std::vector<sttsChng_t> sttsChngs{};
+   size_t splitIdx{0};
+   lsSwtchEmrgncyStts_t emrgncyStts{};
+
+   for(const rplyCase_t &rplyCase: rplyCases){
+      LsSwtchRplyrTst rplyr (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+      rplyr.setRplyStpTm(RplyStpTm);
+      rplyr.setFnWhnRplyOtptsChng(rcrdSttsChng, &sttsChngs);
+      chck(rplyr.getLsSwtchOtptsSttsPkgd() == RplySdOtptsSttsPkgd, rplyCase.caseName, "fresh replayer publishes the initial status");
+      chck(!rplyr.getLsSwtchOtptsChng(), rplyCase.caseName, "fresh replayer initial status is not a change");
+
+      sttsChngs.clear();
+      rplyr.rplyTrc(rplyCase.trcEvnts.data(), rplyCase.trcEvnts.size(), RplyEndTm);
+      cmpSttsChngs(sttsChngs, rplyCase.gldnSttsChngs, rplyCase.caseName, "single call replay");
+
+      rplyr.rstRply();
+      chck(rplyr.getVrtlClkMs() == 0, rplyCase.caseName, "rstRply() restarts the virtual clock");
+      chck(rplyr.getLsSwtchOtptsSttsPkgd() == RplySdOtptsSttsPkgd, rplyCase.caseName, "rstRply() publishes the initial status");
+      sttsChngs.clear();
+      splitIdx = rplyCase.trcEvnts.size() / 2;
+      rplyr.rplyTrc(rplyCase.trcEvnts.data(), splitIdx);
+      rplyr.rplyTrc(rplyCase.trcEvnts.data() + splitIdx, rplyCase.trcEvnts.size() - splitIdx, RplyEndTm);
+      cmpSttsChngs(sttsChngs, rplyCase.gldnSttsChngs, rplyCase.caseName, "two calls replay after rstRply()");
+   }
+
+   // rstRply() with the FDA in the emergency state, stopped in the middle of the production cycle phase
+   {
+      const rplyCase_t &rplyCase{rplyCases[0]};
+      LsSwtchRplyrTst rplyr (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+      rplyr.setRplyStpTm(RplyStpTm);
+      rplyr.setFnWhnRplyOtptsChng(rcrdSttsChng, &sttsChngs);
+      sttsChngs.clear();
+      rplyr.rplyTrc(rplyCase.trcEvnts.data(), 4, 800);
+      chck(rplyr.getPrdCyclIsOn(), "Emergency state reset", "production cycle phase reached");
+      chck(rplyr.trgrEmrgncyStp(), "Emergency state reset", "trgrEmrgncyStp() accepted");
+      rplyr.rplyTrc(nullptr, 0, rplyr.getVrtlClkMs() + 2 * RplyStpTm);
+      chck(rplyr.getIsEmrgncyStt(), "Emergency state reset", "FDA in the emergency state");
+      chck(!rplyr.getLtchRlsIsOn() && !rplyr.getPrdCyclIsOn(), "Emergency state reset", "outputs off in the emergency state");
+      rplyr.getEmrgncyStts(emrgncyStts);
+      chck(emrgncyStts.emrgncyStpQty == 1, "Emergency state reset", "emergency stop counted");
+
+      rplyr.rstRply();
+      chck(!rplyr.getIsEmrgncyStt() && rplyr.getIsFdaStrtStt(), "Emergency state reset", "rstRply() leaves the emergency state");
+      chck(!rplyr.getIsEmrgncyStpPndng(), "Emergency state reset", "rstRply() clears the pending stop");
+      sttsChngs.clear();
+      rplyr.rplyTrc(rplyCase.trcEvnts.data(), rplyCase.trcEvnts.size(), RplyEndTm);
+      cmpSttsChngs(sttsChngs, rplyCase.gldnSttsChngs, "Emergency state reset", "replay after rstRply()");
+      chck(!rplyr.getIsEmrgncyStt(), "Emergency state reset", "no emergency stop in the replay after rstRply()");
+   }
+
+   // rstRply() with the emergency stop requested but not yet served by a replay step
+   {
+      const rplyCase_t &rplyCase{rplyCases[0]};
+      LsSwtchRplyrTst rplyr (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+      rplyr.setRplyStpTm(RplyStpTm);
+      rplyr.setFnWhnRplyOtptsChng(rcrdSttsChng, &sttsChngs);
+      rplyr.rplyTrc(rplyCase.trcEvnts.data(), 4, 800);
+      rplyr.trgrEmrgncyStp();
+      chck(rplyr.getIsEmrgncyStpPndng(), "Pending emergency stop reset", "emergency stop pending");
+      rplyr.rstRply();
+      chck(!rplyr.getIsEmrgncyStpPndng(), "Pending emergency stop reset", "rstRply() clears the pending stop");
+      sttsChngs.clear();
+      rplyr.rplyTrc(rplyCase.trcEvnts.data(), rplyCase.trcEvnts.size(), RplyEndTm);
+      cmpSttsChngs(sttsChngs, rplyCase.gldnSttsChngs, "Pending emergency stop reset", "replay after rstRply()");
+      chck(!rplyr.getIsEmrgncyStt(), "Pending emergency stop reset", "no emergency stop in the replay after rstRply()");
+   }
+
+   // 32 bits milliseconds time source wrapping around
+   {
+      LsSwtchRplyrTst rplyr (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+      uint64_t tmBsBfrWrpUs{0};
+      uint64_t tmBsAftrWrpUs{0};
+
+      rplyr.setWrpdTmSrc();
+      rplyr.setVrtlClkMs(RplyWrpTm - RplyStpTm);
+      tmBsBfrWrpUs = rplyr.getTmBsUs();
+      rplyr.setVrtlClkMs(RplyWrpTm + RplyStpTm);
+      tmBsAftrWrpUs = rplyr.getTmBsUs();
+      chck(tmBsAftrWrpUs - tmBsBfrWrpUs == 2 * RplyStpTm * 1000ULL, "Time source wrap around", "time base advances across the wrap around");
+      rplyr.setVrtlClkMs(RplyWrpTm + 2 * RplyStpTm);
+      chck(rplyr.getTmBsUs() - tmBsAftrWrpUs == RplyStpTm * 1000ULL, "Time source wrap around", "wrap around counted once");
+   }
+
+   printf("%s: %d failed checks\n", (fldChcksQty == 0)?"PASSED":"FAILED", fldChcksQty);
+
+   return (fldChcksQty == 0)?0:1;
+}
+
+//===============================>> User Functions Implementations BEGIN
+void chck(const bool &chckRslt, const char* caseName, const char* chckName){
+   if(!chckRslt){
+      printf("FAILED %s: %s\n", caseName, chckName);
+      ++fldChcksQty;
+   }
+
+   return;
+}
+
+/**
+ * @brief Compares a replay packed status sequence against its golden sequence, printing both on a mismatch
+ */
+bool cmpSttsChngs(const std::vector<sttsChng_t> &sttsChngs, const std::vector<sttsChng_t> &gldnSttsChngs, const char* caseName, const char* chckName){
+   bool result{sttsChngs.size() == gldnSttsChngs.size()};
+
+   for(size_t chngIdx{0}; result && (chngIdx < sttsChngs.size()); ++chngIdx)
+      result = (sttsChngs[chngIdx].chngTm == gldnSttsChngs[chngIdx].chngTm) && (sttsChngs[chngIdx].otptsSttsPkgd == gldnSttsChngs[chngIdx].otptsSttsPkgd);
+   chck(result, caseName, chckName);
+   if(!result){
+      printf("   replayed:");
+      for(const sttsChng_t &sttsChng: sttsChngs)
+         printf(" {%lu, 0x%03X}", sttsChng.chngTm, sttsChng.otptsSttsPkgd);
+      printf("\n   golden:  ");
+      for(const sttsChng_t &sttsChng: gldnSttsChngs)
+         printf(" {%lu, 0x%03X}", sttsChng.chngTm, sttsChng.otptsSttsPkgd);
+      printf("\n");
+   }
+
+   return result;
+}
+
+void rcrdSttsChng(unsigned long int chngTm, uint32_t otptsSttsPkgd, void* sttsChngsArg){
+   static_cast<std::vector<sttsChng_t>*>(sttsChngsArg)->push_back({chngTm, otptsSttsPkgd});
+
+   return;
+}
+//===============================>> User Functions Implementations END
@@ -0,0 +1,270 @@
+/**
+  ******************************************************************************
+  * @file	: LsSwtchSbscrbrTst.cpp
+  * @brief  : Host notifications subscribers table test for the LimbsSftyLnFSwtch class
+  *
+  * Drives a LimbsSftyLnFSwtch object in the event driven mode through
+  * production cycles, with tasks notified by edges subscriptions, by the
+  * setTskToNtfy* methods and by the setTskToNtfyLsSwtchOtptsChng() method, all
+  * of them held by the object's single subscribers table. The timer service is
+  * executed by the shim background thread, as the target timer service task.
+  * The following behaviors are checked:
+  * - The subscriptions are refused for a NULL task, an empty edges mask, an
+  * already subscribed task and over the _maxEdgsSbscrbrsQty limit
+  * - Each subscriber gets only the edges selected by its mask, the edges of an
+  * update coalesced in a single notification
+  * - A task set by several setTskToNtfy* methods gets the edge bits of all of
+  * them, the setTskToNtfyLsSwtchOtptsChng() task gets the packed status value
+  * - Replacing a setTskToNtfy* task moves only that edge to the new task, and
+  * an unsubscribed task is not notified anymore
+  *
+  * Framework: None, host build
+  * Platform: Linux host
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 16/10/2026
+  *       Last update:   16/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+#include <LsSwtchHostShim.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <initializer_list>
+#include <thread>
+
+//==============================================>> General use definitions BEGIN
+#define LsSwtchPollTm 20
+#define LftHndPin GPIO_NUM_4
+#define RghtHndPin GPIO_NUM_2
+#define FtPin GPIO_NUM_5
+#define LtchRlsOtptPin GPIO_NUM_23
+#define PrdCyclOtptPin GPIO_NUM_22
+#define SbscrbrsQty 6   // Tasks created: logger, HMI, PLC bridge, status display and two spare tasks
+#define WtTmOut 2000 // Maximum time -in milliseconds- waited for each expected object reaction
+//================================================>> General use definitions END
+
+/**
+ * @brief Notifications registered by a subscriber task
+ */
+struct sbscrbrRcrd_t{
+   std::atomic<uint32_t> ntfysQty{0};
+   std::atomic<uint32_t> valsOr{0};   // Bitwise or of the notification values received
+   std::atomic<uint32_t> lstVal{0};
+};
+
+/**
+ * @brief LimbsSftyLnFSwtch subclass giving the test access to the FDA state
+ */
+class LsSwtchSbscrbrTstd: public LimbsSftyLnFSwtch{
+public:
+   using LimbsSftyLnFSwtch::LimbsSftyLnFSwtch;
+
+   bool getIsFdaStrtStt(){
+      taskENTER_CRITICAL(&_lsSwtchMux);
+      const bool result{_lsSwtchFdaState == stOffNotBHP};
+      taskEXIT_CRITICAL(&_lsSwtchMux);
+
+      return result;
+   }
+};
+
+//===============================>> Tasks Handles declarations BEGIN
+TaskHandle_t sbscrbrTskHndl[SbscrbrsQty]{};
+//===============================>> Tasks Handles declarations END
+
+//===============================>> Global variables (strictly sanctioned) BEGIN
+swtchInptHwCfg_t lftHndHwAttrbts{.inptPin = LftHndPin};
+swtchInptHwCfg_t rghtHndHwAttrbts{.inptPin = RghtHndPin};
+swtchInptHwCfg_t ftHwAttrbts{.inptPin = FtPin};
+swtchBhvrCfg_t lftHndBhvrSUp{.swtchStrtDlyTm = 0, .swtchIsEnbld = true, .swtchVdTm = 5000};
+swtchBhvrCfg_t rghtHndBhvrSUp{.swtchStrtDlyTm = 0, .swtchIsEnbld = true, .swtchVdTm = 5000};
+swtchBhvrCfg_t ftBhvrSUp{.swtchStrtDlyTm = 0, .swtchIsEnbld = false};
+lsSwtchSwCfg_t lsssSwtchWrkngPrm{.ltchRlsActvTm = 40, .prdCyclActvTm = 80};
+gpioPinOtptHwCfg_t ltchRlsIsOnOtpt{.gpioOtptPin = LtchRlsOtptPin, .gpioOtptActHgh = true};
+gpioPinOtptHwCfg_t prdCyclIsOnOtpt{.gpioOtptPin = PrdCyclOtptPin, .gpioOtptActHgh = true};
+sbscrbrRcrd_t sbscrbrRcrd[SbscrbrsQty]{};
+int fldChcksQty{0};
+//=================================>> Global variables (strictly sanctioned) END
+
+//======================================>> General use function prototypes BEGIN
+void chck(const bool &chckRslt, const char* chckName);
+void rstRcrds();
+bool runCycl(LsSwtchSbscrbrTstd &lsSwtch);
+template <typename F> bool wtFor(F cndFn);
+//========================================>> General use function prototypes END
+
+//======================================>> Task Callback function prototypes BEGIN
+void sbscrbrTsk(void *pvParameters);
+//========================================>> Task Callback function prototypes END
+
+int main(){
+   const uint8_t lgrId{0};
+   const uint8_t hmiId{1};
+   const uint8_t plcId{2};
+   const uint8_t sttsId{3};
+   const uint8_t spr1Id{4};
+   const uint8_t spr2Id{5};
+   const uint32_t cyclEdgs{ltchRlsTrnOnEdgBit | prdCyclTrnOnEdgBit | ltchRlsTrnOffEdgBit | prdCyclTrnOffEdgBit};
+   const uint32_t hmiEdgsMsk{ltchRlsTrnOnEdgBit | ltchRlsTrnOffEdgBit | lsSwtchOtptsChngEdgBit};
+   lsSwtchOtpts_t lstStts{};
+
+   LsSwtchSbscrbrTstd tstSftySwtch (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+   for(uint8_t sbscrbrId{0}; sbscrbrId < SbscrbrsQty; ++sbscrbrId)
+      xTaskCreatePinnedToCore(sbscrbrTsk, "SbscrbrTsk", 2048, &sbscrbrRcrd[sbscrbrId], 2, &sbscrbrTskHndl[sbscrbrId], 0);
+
+   // Subscriptions: the logger gets the FDA transitions edges, the HMI the latch release edges and the status changes
+   chck(!tstSftySwtch.addEdgsSbscrbr(NULL), "NULL task subscription refused");
+   chck(!tstSftySwtch.addEdgsSbscrbr(sbscrbrTskHndl[spr1Id], 0), "empty edges mask subscription refused");
+   chck(tstSftySwtch.addEdgsSbscrbr(sbscrbrTskHndl[lgrId]), "logger subscribed");
+   chck(!tstSftySwtch.addEdgsSbscrbr(sbscrbrTskHndl[lgrId]), "already subscribed task refused");
+   chck(tstSftySwtch.addEdgsSbscrbr(sbscrbrTskHndl[hmiId], hmiEdgsMsk), "HMI subscribed");
+   chck(tstSftySwtch.addEdgsSbscrbr(sbscrbrTskHndl[spr1Id]) && tstSftySwtch.addEdgsSbscrbr(sbscrbrTskHndl[spr2Id]), "subscriptions up to the quantity limit");
+   chck(!tstSftySwtch.addEdgsSbscrbr(sbscrbrTskHndl[plcId]), "subscription over the quantity limit refused");
+   chck(tstSftySwtch.rmvEdgsSbscrbr(sbscrbrTskHndl[spr1Id]) && tstSftySwtch.rmvEdgsSbscrbr(sbscrbrTskHndl[spr2Id]), "spare tasks unsubscribed");
+   chck(!tstSftySwtch.rmvEdgsSbscrbr(sbscrbrTskHndl[spr1Id]), "not subscribed task unsubscription refused");
+   // The PLC bridge is set for both production cycle edges, the status display for the packed status changes
+   tstSftySwtch.setTskToNtfyTrnOnPrdCycl(sbscrbrTskHndl[plcId]);
+   tstSftySwtch.setTskToNtfyTrnOffPrdCycl(sbscrbrTskHndl[plcId]);
+   tstSftySwtch.setTskToNtfyLsSwtchOtptsChng(sbscrbrTskHndl[sttsId]);
+
+   // Inputs released: at their pulled up idle level
+   for(const uint8_t inptPin: {LftHndPin, RghtHndPin, FtPin})
+      shimSetPinLvl(inptPin, HIGH);
+   if(!tstSftySwtch.setOtptPins(ltchRlsIsOnOtpt, prdCyclIsOnOtpt) || !tstSftySwtch.setEvntDrvn(true) || !tstSftySwtch.begin(LsSwtchPollTm)){
+      fprintf(stderr, "LimbsSftyLnFSwtch object start failed\n");
+      return 1;
+   }
+   shimStrtTmrSvcTsk();
+
+   chck(wtFor([&](){return tstSftySwtch.getIsFdaStrtStt();}), "FDA in the start state");
+   rstRcrds();
+   chck(runCycl(tstSftySwtch), "first production cycle");
+   chck(wtFor([&](){return sbscrbrRcrd[lgrId].valsOr == cyclEdgs;}), "logger notified of the production cycle edges");
+   chck(sbscrbrRcrd[lgrId].ntfysQty <= 3, "logger notifications: the production cycle start edges in a single notification");
+   chck(wtFor([&](){return sbscrbrRcrd[hmiId].valsOr == hmiEdgsMsk;}), "HMI notified of the latch release edges and the status changes only");
+   chck(wtFor([&](){return sbscrbrRcrd[plcId].valsOr == (prdCyclTrnOnEdgBit | prdCyclTrnOffEdgBit);}), "PLC bridge notified of both edges set by the setTskToNtfy* methods");
+   chck(wtFor([&](){return (sbscrbrRcrd[sttsId].valsOr & (1UL << LsSwtchPrdCyclIsOnBP)) != 0;}), "status display got a packed status with the production cycle on");
+   chck(wtFor([&](){
+      lstStts = lssOtptsSttsUnpkg(sbscrbrRcrd[sttsId].lstVal);
+      return !lstStts.ltchRlsIsOn && !lstStts.prdCyclIsOn;
+   }), "status display last packed status with both outputs off");
+   chck((sbscrbrRcrd[spr1Id].ntfysQty == 0) && (sbscrbrRcrd[spr2Id].ntfysQty == 0), "unsubscribed spare tasks not notified");
+   printf("First cycle notifications: logger %u, HMI %u, PLC bridge %u, status display %u\n", sbscrbrRcrd[lgrId].ntfysQty.load(), sbscrbrRcrd[hmiId].ntfysQty.load(), sbscrbrRcrd[plcId].ntfysQty.load(), sbscrbrRcrd[sttsId].ntfysQty.load());
+
+   // The production cycle on edge moved to a spare task, the logger unsubscribed
+   tstSftySwtch.setTskToNtfyTrnOnPrdCycl(sbscrbrTskHndl[spr1Id]);
+   chck(eTaskGetState(sbscrbrTskHndl[plcId]) == eSuspended, "replaced task suspended");
+   chck(tstSftySwtch.getTskToNtfyTrnOnPrdCycl() == sbscrbrTskHndl[spr1Id], "replacing task set");
+   chck(tstSftySwtch.rmvEdgsSbscrbr(sbscrbrTskHndl[lgrId]), "logger unsubscribed");
+   rstRcrds();
+   chck(runCycl(tstSftySwtch), "second production cycle");
+   chck(wtFor([&](){return sbscrbrRcrd[spr1Id].valsOr == prdCyclTrnOnEdgBit;}), "replacing task notified of the production cycle on edge");
+   chck(wtFor([&](){return sbscrbrRcrd[plcId].valsOr == prdCyclTrnOffEdgBit;}), "replaced task keeps the production cycle off edge only");
+   chck(wtFor([&](){return sbscrbrRcrd[hmiId].valsOr == hmiEdgsMsk;}), "HMI notified in the second production cycle");
+   chck(sbscrbrRcrd[lgrId].ntfysQty == 0, "unsubscribed logger not notified");
+   shimStopTmrSvcTsk();
+   for(const TaskHandle_t &tskHndl: sbscrbrTskHndl)
+      vTaskDelete(tskHndl);
+
+   if(fldChcksQty == 0)
+      printf("PASSED\n");
+   else
+      printf("FAILED: %d failed checks\n", fldChcksQty);
+
+   return (fldChcksQty == 0)?0:1;
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void sbscrbrTsk(void *pvParameters){
+   sbscrbrRcrd_t* rcrd{static_cast<sbscrbrRcrd_t*>(pvParameters)};
+   uint32_t ntfyVal{0};
+
+   for(;;){
+      if(xTaskNotifyWait(0x00, 0xFFFFFFFF, &ntfyVal, portMAX_DELAY) == pdPASS){
+         rcrd->lstVal = ntfyVal;
+         rcrd->valsOr |= ntfyVal;
+         ++rcrd->ntfysQty;
+      }
+   }
+}
+//===============================>> User Tasks Implementations END
+
+//===============================>> User Functions Implementations BEGIN
+void chck(const bool &chckRslt, const char* chckName){
+   if(!chckRslt){
+      printf("FAILED %s\n", chckName);
+      ++fldChcksQty;
+   }
+
+   return;
+}
+
+/**
+ * @brief Clears the subscriber tasks records, once the notifications of the last production cycle were taken
+ */
+void rstRcrds(){
+   std::this_thread::sleep_for(std::chrono::milliseconds(2 * LsSwtchPollTm));
+   for(sbscrbrRcrd_t &rcrd: sbscrbrRcrd){
+      rcrd.ntfysQty = 0;
+      rcrd.valsOr = 0;
+      rcrd.lstVal = 0;
+   }
+
+   return;
+}
+
+/**
+ * @brief Runs a production cycle: both hands and foot pressed, then released until the production cycle ends
+ *
+ * @retval true The cycle was completed
+ * @retval false An expected object reaction didn't happen
+ */
+bool runCycl(LsSwtchSbscrbrTstd &lsSwtch){
+   bool result{false};
+
+   shimSetPinLvl(LftHndPin, LOW);
+   shimSetPinLvl(RghtHndPin, LOW);
+   if(wtFor([&](){
+      const lsSwtchOtpts_t otptsStts{lssOtptsSttsUnpkg(lsSwtch.getLsSwtchOtptsSttsPkgd())};
+      return otptsStts.lftHndIsOn && otptsStts.rghtHndIsOn && otptsStts.ftSwIsEnbld;
+   })){
+      shimSetPinLvl(FtPin, LOW);
+      result = wtFor([&](){return shimGetPinLvl(LtchRlsOtptPin) == HIGH;});
+   }
+   for(const uint8_t inptPin: {FtPin, LftHndPin, RghtHndPin})
+      shimSetPinLvl(inptPin, HIGH);
+   if(result)
+      result = wtFor([&](){return lsSwtch.getIsFdaStrtStt() && (shimGetPinLvl(PrdCyclOtptPin) == LOW);});
+
+   return result;
+}
+
+/**
+ * @brief Waits for a condition set by the object's updates, executed by the shim timer service thread
+ *
+ * @retval true The condition was met
+ * @retval false WtTmOut milliseconds elapsed without the condition being met
+ */
+template <typename F> bool wtFor(F cndFn){
+   const std::chrono::steady_clock::time_point wtStrtTm{std::chrono::steady_clock::now()};
+   bool result{cndFn()};
+
+   while(!result && ((std::chrono::steady_clock::now() - wtStrtTm) < std::chrono::milliseconds(WtTmOut))){
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+      result = cndFn();
+   }
+
+   return result;
+}
+//===============================>> User Functions Implementations END
@@ -0,0 +1,283 @@
+/**
+  ******************************************************************************
+  * @file	: LsSwtchWcetTst.cpp
+  * @brief  : Host worst case execution time report of the LimbsSftyLnFSwtch class updates
+  *
+  * Host build of the LimbsSftyLnFSwtch_Bench_11 example, linked to the library
+  * built with the _lsSwtchPrfInstr flag set. The object is set to the event
+  * driven and phase deadline timers modes, with the output stage pins, the
+  * five tasks notifications, the five functions, a status subscriber and an
+  * edges subscriber, so the timed updates include every action an update
+  * might execute. The timer service is executed by the shim background
+  * thread, as the target timer service task. Each run executes the Bench_11
+  * scenarios, each step waiting for the FDA state it must reach instead of a
+  * fixed delay:
+  * - A complete production cycle: 0->1, 1->2, 2->3, 3->4 and 4->0 transitions
+  * - Both hands on missed by releasing the hands before the foot press: 1->0
+  * - An emergency stop in the 0, 1, 3 and 4 states, and its recovery: 0->5,
+  * 1->5, 3->5 and 4->5 transitions and updates in the 5 state
+  *
+  * The state and transition records are reported through the standard output
+  * as the Bench_11 report, the ticks being nanoseconds on the host. The exit
+  * status is 1 if a scenario step failed, if the records are not available or
+  * if an expected transition has no FDA step timed, 0 otherwise. The lock hold
+  * bound is reported but not checked: the host threads are preempted by the
+  * host scheduler while holding the lock, the target cores are not.
+  *
+  * Usage:
+  *    LsSwtchWcetTst [runsQty]
+  *
+  * Framework: None, host build
+  * Platform: Linux host
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 16/10/2026
+  *       Last update:   16/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <Arduino.h>
+#include <LimbsSafetySw_ESP32.h>
+#include <LsSwtchHostShim.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <initializer_list>
+#include <thread>
+
+//==============================================>> General use definitions BEGIN
+#define LsSwtchPollTm 20
+#define LftHndPin GPIO_NUM_4
+#define RghtHndPin GPIO_NUM_2
+#define FtPin GPIO_NUM_5
+#define LtchRlsOtptPin GPIO_NUM_23
+#define PrdCyclOtptPin GPIO_NUM_22
+#define LckHldBndUs 20   // Object lock hold time bound, reported only on the host
+#define EmrgncyScnrsQty 4   // Emergency stop scenarios: stops in the 0, 1, 3 and 4 states
+#define WcetRunsQty 5   // Default quantity of scenario runs
+#define WtTmOut 2000 // Maximum time -in milliseconds- waited for each expected FDA state
+//================================================>> General use definitions END
+
+/**
+ * @brief LimbsSftyLnFSwtch subclass giving the test access to the FDA state
+ */
+class LsSwtchWcetTstd: public LimbsSftyLnFSwtch{
+public:
+   using LimbsSftyLnFSwtch::LimbsSftyLnFSwtch;
+
+   uint8_t getFdaStt(){
+      taskENTER_CRITICAL(&_lsSwtchMux);
+      const uint8_t result{static_cast<uint8_t>(_lsSwtchFdaState)};
+      taskEXIT_CRITICAL(&_lsSwtchMux);
+
+      return result;
+   }
+};
+
+//===============================>> Global variables (strictly sanctioned) BEGIN
+const char* const fdaSttNames[lsSwtchFdaSttsQty]{"Off, not both hands", "Off, both hands", "Start cycle", "Latch release", "Production cycle", "Emergency stop"};
+// Transitions the FDA might execute, as "from state, to state" pairs
+const uint8_t expctdTrnstns[][2]{{0, 1}, {1, 0}, {1, 2}, {2, 3}, {3, 4}, {4, 0}, {0, 5}, {1, 5}, {3, 5}, {4, 5}};
+swtchInptHwCfg_t lftHndHwAttrbts{.inptPin = LftHndPin};
+swtchInptHwCfg_t rghtHndHwAttrbts{.inptPin = RghtHndPin};
+swtchInptHwCfg_t ftHwAttrbts{.inptPin = FtPin};
+swtchBhvrCfg_t lftHndBhvrSUp{.swtchStrtDlyTm = 0, .swtchIsEnbld = true, .swtchVdTm = 5000};
+swtchBhvrCfg_t rghtHndBhvrSUp{.swtchStrtDlyTm = 0, .swtchIsEnbld = true, .swtchVdTm = 5000};
+swtchBhvrCfg_t ftBhvrSUp{.swtchStrtDlyTm = 0, .swtchIsEnbld = false};
+lsSwtchSwCfg_t lsssSwtchWrkngPrm{.ltchRlsActvTm = 100, .prdCyclActvTm = 200};
+gpioPinOtptHwCfg_t ltchRlsIsOnOtpt{.gpioOtptPin = LtchRlsOtptPin, .gpioOtptActHgh = true};
+gpioPinOtptHwCfg_t prdCyclIsOnOtpt{.gpioOtptPin = PrdCyclOtptPin, .gpioOtptActHgh = true};
+int fldStpsQty{0};
+//=================================>> Global variables (strictly sanctioned) END
+
+//======================================>> General use function prototypes BEGIN
+void chck(const bool &chckRslt, const char* chckName);
+void nullFn(void* argPtr);
+void prntWcetRcrd(const char* rcrdName, const lsSwtchWcetRcrd_t &rcrd, const uint32_t &tcksPerUs);
+template <typename F> bool wtFor(F cndFn);
+bool wtForStt(LsSwtchWcetTstd &lsSwtch, const uint8_t &fdaStt);
+//========================================>> General use function prototypes END
+
+//======================================>> Task Callback function prototypes BEGIN
+void snkTsk(void *pvParameters);
+//========================================>> Task Callback function prototypes END
+
+int main(int argc, char* argv[]){
+   const unsigned long int runsQty{(argc > 1)?strtoul(argv[1], nullptr, 10):WcetRunsQty};
+   const uint32_t tcksPerUs{LimbsSftyLnFSwtch::getPrfTcksPerUs()};
+   lsSwtchWcetRcrd_t wcetRcrd{};
+   TaskHandle_t snkTskHndl{NULL};
+   bool bndExcdd{false};
+   bool result{true};
+   char rcrdName[48];
+   fncVdPtrPrmPtrType nullFnPtr{nullFn};
+
+   LsSwtchWcetTstd tstSftySwtch (lftHndHwAttrbts, lftHndBhvrSUp, rghtHndHwAttrbts, rghtHndBhvrSUp, ftHwAttrbts, ftBhvrSUp, lsssSwtchWrkngPrm);
+
+   xTaskCreatePinnedToCore(snkTsk, "SinkTask", 1024, NULL, 4, &snkTskHndl, 0);
+   if(!tstSftySwtch.setOtptPins(ltchRlsIsOnOtpt, prdCyclIsOnOtpt) || !tstSftySwtch.setEvntDrvn(true) || !tstSftySwtch.setPhsTmrDrvn(true)){
+      fprintf(stderr, "LimbsSftyLnFSwtch object configuration failed\n");
+      return 1;
+   }
+   tstSftySwtch.setFnWhnBthHndsOnMssd(nullFnPtr);
+   tstSftySwtch.setFnWhnTrnOnLtchRlsPtr(nullFnPtr);
+   tstSftySwtch.setFnWhnTrnOffLtchRlsPtr(nullFnPtr);
+   tstSftySwtch.setFnWhnTrnOnPrdCyclPtr(nullFnPtr);
+   tstSftySwtch.setFnWhnTrnOffPrdCyclPtr(nullFnPtr);
+   // Inputs released: at their pulled up idle level, the edges are then injected
+   for(const uint8_t inptPin: {LftHndPin, RghtHndPin, FtPin})
+      shimSetPinLvl(inptPin, HIGH);
+   if(!tstSftySwtch.begin(LsSwtchPollTm)){
+      fprintf(stderr, "LimbsSftyLnFSwtch object start failed\n");
+      return 1;
+   }
+   tstSftySwtch.setTskToNtfyBthHndsOnMssd(snkTskHndl);
+   tstSftySwtch.setTskToNtfyTrnOnLtchRls(snkTskHndl);
+   tstSftySwtch.setTskToNtfyTrnOffLtchRls(snkTskHndl);
+   tstSftySwtch.setTskToNtfyTrnOnPrdCycl(snkTskHndl);
+   tstSftySwtch.setTskToNtfyTrnOffPrdCycl(snkTskHndl);
+   tstSftySwtch.setTskToNtfyLsSwtchOtptsChng(snkTskHndl);
+   tstSftySwtch.addSttsSbscrbr(snkTskHndl, lsSwtchOtptsSttsMsk, lsSwtchOtptsSttsMsk);
+   tstSftySwtch.addEdgsSbscrbr(snkTskHndl);
+   if(!tstSftySwtch.setWcetLckHldBndUs(LckHldBndUs)){
+      fprintf(stderr, "Worst case execution time records not available, the library must be built with the _lsSwtchPrfInstr flag set to 1\n");
+      return 1;
+   }
+   shimStrtTmrSvcTsk();
+
+   for(unsigned long int runNum{0}; (runNum < runsQty) && (fldStpsQty == 0); ++runNum){
+      // Complete production cycle
+      tstSftySwtch.injctInptEvnt(lftHndInptId, true);
+      tstSftySwtch.injctInptEvnt(rghtHndInptId, true);
+      chck(wtForStt(tstSftySwtch, 1), "production cycle: both hands on");
+      tstSftySwtch.injctInptEvnt(ftInptId, true);
+      chck(wtForStt(tstSftySwtch, 3), "production cycle: latch release");
+      tstSftySwtch.injctInptEvnt(ftInptId, false);
+      tstSftySwtch.injctInptEvnt(lftHndInptId, false);
+      tstSftySwtch.injctInptEvnt(rghtHndInptId, false);
+      chck(wtForStt(tstSftySwtch, 4), "production cycle: production cycle phase");
+      chck(wtForStt(tstSftySwtch, 0), "production cycle: cycle end");
+
+      // Both hands on missed
+      tstSftySwtch.injctInptEvnt(lftHndInptId, true);
+      tstSftySwtch.injctInptEvnt(rghtHndInptId, true);
+      chck(wtForStt(tstSftySwtch, 1), "hands on missed: both hands on");
+      tstSftySwtch.injctInptEvnt(lftHndInptId, false);
+      tstSftySwtch.injctInptEvnt(rghtHndInptId, false);
+      chck(wtForStt(tstSftySwtch, 0), "hands on missed: hands released");
+
+      // Emergency stops in every stoppable state
+      for(uint8_t scnrNum{0}; scnrNum < EmrgncyScnrsQty; ++scnrNum){
+         if(scnrNum > 0){
+            tstSftySwtch.injctInptEvnt(lftHndInptId, true);
+            tstSftySwtch.injctInptEvnt(rghtHndInptId, true);
+            chck(wtForStt(tstSftySwtch, 1), "emergency stop: both hands on");
+         }
+         if(scnrNum > 1){
+            tstSftySwtch.injctInptEvnt(ftInptId, true);
+            chck(wtForStt(tstSftySwtch, (scnrNum == 2)?3:4), "emergency stop: stopped phase reached");
+         }
+         tstSftySwtch.trgrEmrgncyStp();
+         chck(wtForStt(tstSftySwtch, 5), "emergency stop: FDA stopped");
+         tstSftySwtch.injctInptEvnt(ftInptId, false);
+         tstSftySwtch.injctInptEvnt(lftHndInptId, false);
+         tstSftySwtch.injctInptEvnt(rghtHndInptId, false);
+         chck(wtFor([&](){return tstSftySwtch.rcvrEmrgncyStp();}), "emergency stop: recovery");
+         chck(wtForStt(tstSftySwtch, 0), "emergency stop: FDA recovered");
+      }
+   }
+   shimStopTmrSvcTsk();
+   vTaskDelete(snkTskHndl);
+   result = (fldStpsQty == 0);
+
+   printf("==== Worst case execution time report: %lu scenario runs, lock hold bound %u us ====\n", runsQty, LckHldBndUs);
+   printf("%-36s %8s %10s %10s %10s %10s %8s\n", "Record", "Samples", "FDA ns", "Lock ns", "Update ns", "Update us", "Over");
+   for(uint8_t fdaStt{0}; fdaStt < lsSwtchFdaSttsQty; ++fdaStt){
+      if(tstSftySwtch.getWcetSttRcrd(fdaStt, wcetRcrd)){
+         snprintf(rcrdName, sizeof(rcrdName), "State %u %s", fdaStt, fdaSttNames[fdaStt]);
+         prntWcetRcrd(rcrdName, wcetRcrd, tcksPerUs);
+         bndExcdd = bndExcdd || (wcetRcrd.lckHldOvrBndQty > 0);
+      }
+   }
+   for(uint8_t frmStt{0}; frmStt < lsSwtchFdaSttsQty; ++frmStt){
+      for(uint8_t toStt{0}; toStt < lsSwtchFdaSttsQty; ++toStt){
+         if(tstSftySwtch.getWcetTrnstnRcrd(frmStt, toStt, wcetRcrd) && (wcetRcrd.smplsQty > 0)){
+            snprintf(rcrdName, sizeof(rcrdName), "Transition %u -> %u", frmStt, toStt);
+            prntWcetRcrd(rcrdName, wcetRcrd, tcksPerUs);
+            bndExcdd = bndExcdd || (wcetRcrd.lckHldOvrBndQty > 0);
+         }
+      }
+   }
+   for(const auto &expctdTrnstn : expctdTrnstns){
+      if(!tstSftySwtch.getWcetTrnstnRcrd(expctdTrnstn[0], expctdTrnstn[1], wcetRcrd) || (wcetRcrd.smplsQty == 0) || (wcetRcrd.maxFdaTcks == 0)){
+         printf("Transition %u -> %u NOT EXERCISED\n", expctdTrnstn[0], expctdTrnstn[1]);
+         result = false;
+      }
+   }
+   printf("Lock hold bound of %u us: %s\n", LckHldBndUs, bndExcdd?"exceeded -host scheduler preemption, not checked-":"met by every update");
+   printf("%s\n", result?"PASSED":"FAILED");
+
+   return result?0:1;
+}
+
+//===============================>> User Tasks Implementations BEGIN
+void snkTsk(void *pvParameters){
+   for(;;){
+      xTaskNotifyWait(0x00, 0xFFFFFFFF, NULL, portMAX_DELAY);
+   }
+}
+//===============================>> User Tasks Implementations END
+
+//===============================>> User Functions Implementations BEGIN
+void chck(const bool &chckRslt, const char* chckName){
+   if(!chckRslt){
+      printf("FAILED %s\n", chckName);
+      ++fldStpsQty;
+   }
+
+   return;
+}
+
+void nullFn(void* argPtr){
+   // Empty function: the updates are timed with the function call in place, the user code duration must be added to the report figures
+
+   return;
+}
+
+void prntWcetRcrd(const char* rcrdName, const lsSwtchWcetRcrd_t &rcrd, const uint32_t &tcksPerUs){
+   printf("%-36s %8lu %10lu %10lu %10lu %10.2f %8lu%s\n",
+      rcrdName, (unsigned long)rcrd.smplsQty, (unsigned long)rcrd.maxFdaTcks, (unsigned long)rcrd.maxLckHldTcks, (unsigned long)rcrd.maxUpdTcks,
+      static_cast<float>(rcrd.maxUpdTcks) / tcksPerUs, (unsigned long)rcrd.lckHldOvrBndQty, (rcrd.lckHldOvrBndQty > 0)?" EXCEEDED":"");
+
+   return;
+}
+
+/**
+ * @brief Waits for a condition set by the object's updates, executed by the shim timer service thread
+ *
+ * @retval true The condition was met
+ * @retval false WtTmOut milliseconds elapsed without the condition being met
+ */
+template <typename F> bool wtFor(F cndFn){
+   const std::chrono::steady_clock::time_point wtStrtTm{std::chrono::steady_clock::now()};
+   bool result{cndFn()};
+
+   while(!result && ((std::chrono::steady_clock::now() - wtStrtTm) < std::chrono::milliseconds(WtTmOut))){
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+      result = cndFn();
+   }
+
+   return result;
+}
+
+bool wtForStt(LsSwtchWcetTstd &lsSwtch, const uint8_t &fdaStt){
+
+   return wtFor([&](){return lsSwtch.getFdaStt() == fdaStt;});
+}
+//===============================>> User Functions Implementations END
@@ -0,0 +1,231 @@
+/**
+  ******************************************************************************
+  * @file	: Arduino.h
+  * @brief  : Host stand-in for the Arduino-ESP32 core and ESP-IDF FreeRTOS API
+  *
+  * Declares the subset of the Arduino-ESP32 core, the ESP-IDF FreeRTOS API,
+  * the esp_timer API and the GPIO registers access macros used by the
+  * LimbsSafetySw_ESP32 library, so the library compiles unchanged on a Linux
+  * host. The implementations are in LsSwtchHostShim.cpp, the host side control
+  * functions -timer service execution, input pin levels, notifications
+  * inspection- are declared in LsSwtchHostShim.h.
+  *
+  * Framework: None, host build
+  * Platform: Linux host
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 16/10/2026
+  *       Last update:   16/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#ifndef _LSSWTCHHOST_ARDUINO_H_
+#define _LSSWTCHHOST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+//===========================>> FreeRTOS types and constants BEGIN
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint32_t EventBits_t;
+typedef uint32_t StackType_t;
+typedef void* TaskHandle_t;
+typedef void* TimerHandle_t;
+typedef void* EventGroupHandle_t;
+typedef void* QueueHandle_t;
+typedef void (*TimerCallbackFunction_t)(TimerHandle_t);
+typedef void (*PendedFunction_t)(void*, uint32_t);
+typedef void (*TaskFunction_t)(void*);
+
+struct StaticTimer_t{void* pxDummy[12];};
+struct StaticTask_t{void* pxDummy[90];};
+struct StaticEventGroup_t{void* pxDummy[8];};
+
+enum eNotifyAction{eNoAction, eSetBits, eIncrement, eSetValueWithOverwrite, eSetValueWithoutOverwrite};
+enum eTaskState{eRunning, eReady, eBlocked, eSuspended, eDeleted, eInvalid};
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define portMAX_DELAY 0xFFFFFFFF
+#define portTICK_RATE_MS 1
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(x) (x)
+#define configTIMER_TASK_PRIORITY 1
+#define configMAX_PRIORITIES 25
+#define configSTACK_DEPTH_TYPE uint32_t
+#define tskNO_AFFINITY 0x7FFFFFFF
+#define IRAM_ATTR
+//=============================>> FreeRTOS types and constants END
+
+//===========================>> Critical sections BEGIN
+/**
+ * @brief Host spinlock, recursive for the owning thread as the ESP-IDF portMUX is for the owning core
+ */
+struct portMUX_TYPE{
+   uint32_t owner;
+   uint32_t count;
+};
+#define portMUX_INITIALIZER_UNLOCKED {0, 0}
+
+void shimMuxEnter(portMUX_TYPE* mux);
+void shimMuxExit(portMUX_TYPE* mux);
+#define spinlock_initialize(mux) (*(mux) = portMUX_TYPE portMUX_INITIALIZER_UNLOCKED)
+#define taskENTER_CRITICAL(mux) shimMuxEnter(mux)
+#define taskEXIT_CRITICAL(mux) shimMuxExit(mux)
+#define taskENTER_CRITICAL_ISR(mux) shimMuxEnter(mux)
+#define taskEXIT_CRITICAL_ISR(mux) shimMuxExit(mux)
+#define portENTER_CRITICAL(mux) shimMuxEnter(mux)
+#define portEXIT_CRITICAL(mux) shimMuxExit(mux)
+#define portENTER_CRITICAL_ISR(mux) shimMuxEnter(mux)
+#define portEXIT_CRITICAL_ISR(mux) shimMuxExit(mux)
+#define portYIELD_FROM_ISR(x) (void)(x)
+//=============================>> Critical sections END
+
+//===========================>> FreeRTOS API BEGIN
+TimerHandle_t xTimerCreate(const char* pcTimerName, TickType_t xTimerPeriod, UBaseType_t uxAutoReload, void* pvTimerID, TimerCallbackFunction_t pxCallbackFunction);
+TimerHandle_t xTimerCreateStatic(const char* pcTimerName, TickType_t xTimerPeriod, UBaseType_t uxAutoReload, void* pvTimerID, TimerCallbackFunction_t pxCallbackFunction, StaticTimer_t* pxTimerBuffer);
+BaseType_t xTimerStart(TimerHandle_t xTimer, TickType_t xTicksToWait);
+BaseType_t xTimerStop(TimerHandle_t xTimer, TickType_t xTicksToWait);
+BaseType_t xTimerReset(TimerHandle_t xTimer, TickType_t xTicksToWait);
+BaseType_t xTimerDelete(TimerHandle_t xTimer, TickType_t xTicksToWait);
+BaseType_t xTimerChangePeriod(TimerHandle_t xTimer, TickType_t xNewPeriod, TickType_t xTicksToWait);
+BaseType_t xTimerStartFromISR(TimerHandle_t xTimer, BaseType_t* pxHigherPriorityTaskWoken);
+BaseType_t xTimerResetFromISR(TimerHandle_t xTimer, BaseType_t* pxHigherPriorityTaskWoken);
+BaseType_t xTimerIsTimerActive(TimerHandle_t xTimer);
+BaseType_t xTimerPendFunctionCall(PendedFunction_t xFunctionToPend, void* pvParameter1, uint32_t ulParameter2, TickType_t xTicksToWait);
+BaseType_t xTimerPendFunctionCallFromISR(PendedFunction_t xFunctionToPend, void* pvParameter1, uint32_t ulParameter2, BaseType_t* pxHigherPriorityTaskWoken);
+void* pvTimerGetTimerID(TimerHandle_t xTimer);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t pvTaskCode, const char* pcName, uint32_t usStackDepth, void* pvParameters, UBaseType_t uxPriority, TaskHandle_t* pvCreatedTask, BaseType_t xCoreID);
+TaskHandle_t xTaskCreateStaticPinnedToCore(TaskFunction_t pvTaskCode, const char* pcName, uint32_t ulStackDepth, void* pvParameters, UBaseType_t uxPriority, StackType_t* pxStackBuffer, StaticTask_t* pxTaskBuffer, BaseType_t xCoreID);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+eTaskState eTaskGetState(TaskHandle_t xTask);
+void vTaskSuspend(TaskHandle_t xTaskToSuspend);
+void vTaskDelete(TaskHandle_t xTaskToDelete);
+void vTaskDelay(TickType_t xTicksToDelay);
+void vTaskDelayUntil(TickType_t* pxPreviousWakeTime, TickType_t xTimeIncrement);
+TickType_t xTaskGetTickCount();
+TickType_t xTaskGetTickCountFromISR();
+BaseType_t xPortGetCoreID();
+
+BaseType_t xTaskNotify(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction);
+BaseType_t xTaskNotifyFromISR(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, BaseType_t* pxHigherPriorityTaskWoken);
+BaseType_t xTaskNotifyGive(TaskHandle_t xTaskToNotify);
+void vTaskNotifyGiveFromISR(TaskHandle_t xTaskToNotify, BaseType_t* pxHigherPriorityTaskWoken);
+BaseType_t xTaskNotifyWait(uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t* pulNotificationValue, TickType_t xTicksToWait);
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait);
+
+EventGroupHandle_t xEventGroupCreate();
+EventGroupHandle_t xEventGroupCreateStatic(StaticEventGroup_t* pxEventGroupBuffer);
+EventBits_t xEventGroupSetBits(EventGroupHandle_t xEventGroup, EventBits_t uxBitsToSet);
+BaseType_t xEventGroupSetBitsFromISR(EventGroupHandle_t xEventGroup, EventBits_t uxBitsToSet, BaseType_t* pxHigherPriorityTaskWoken);
+EventBits_t xEventGroupClearBits(EventGroupHandle_t xEventGroup, EventBits_t uxBitsToClear);
+EventBits_t xEventGroupGetBits(EventGroupHandle_t xEventGroup);
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t xEventGroup, EventBits_t uxBitsToWaitFor, BaseType_t xClearOnExit, BaseType_t xWaitForAllBits, TickType_t xTicksToWait);
+void vEventGroupDelete(EventGroupHandle_t xEventGroup);
+//=============================>> FreeRTOS API END
+
+//===========================>> ESP-IDF API BEGIN
+typedef void* esp_timer_handle_t;
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+enum esp_timer_dispatch_t{ESP_TIMER_TASK, ESP_TIMER_ISR};
+struct esp_timer_create_args_t{
+   void (*callback)(void* arg);
+   void* arg;
+   esp_timer_dispatch_t dispatch_method;
+   const char* name;
+   bool skip_unhandled_events;
+};
+int64_t esp_timer_get_time();
+esp_err_t esp_timer_create(const esp_timer_create_args_t* create_args, esp_timer_handle_t* out_handle);
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us);
+esp_err_t esp_timer_stop(esp_timer_handle_t timer);
+esp_err_t esp_timer_delete(esp_timer_handle_t timer);
+
+#define GPIO_IN_REG 0x3FF4403C
+#define GPIO_IN1_REG 0x3FF44040
+#define GPIO_OUT_W1TS_REG 0x3FF44008
+#define GPIO_OUT_W1TC_REG 0x3FF4400C
+#define GPIO_OUT1_W1TS_REG 0x3FF44014
+#define GPIO_OUT1_W1TC_REG 0x3FF44018
+uint32_t REG_READ(uint32_t reg);
+void REG_WRITE(uint32_t reg, uint32_t val);
+
+struct multi_heap_info_t{
+   size_t total_free_bytes;
+   size_t total_allocated_bytes;
+   size_t largest_free_block;
+   size_t minimum_free_bytes;
+   size_t allocated_blocks;
+   size_t free_blocks;
+   size_t total_blocks;
+};
+#define MALLOC_CAP_DEFAULT 1
+#define MALLOC_CAP_8BIT 4
+void heap_caps_get_info(multi_heap_info_t* info, uint32_t caps);
+//=============================>> ESP-IDF API END
+
+//===========================>> Arduino core BEGIN
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define INPUT_PULLDOWN 0x09
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+#define DEC 10
+#define HEX 16
+#define SOC_GPIO_PIN_COUNT 40
+#define GPIO_NUM_NC -1
+#define GPIO_NUM_MAX 40
+enum gpio_num_t{
+   GPIO_NUM_0 = 0, GPIO_NUM_1, GPIO_NUM_2, GPIO_NUM_3, GPIO_NUM_4, GPIO_NUM_5, GPIO_NUM_6, GPIO_NUM_7,
+   GPIO_NUM_8, GPIO_NUM_9, GPIO_NUM_10, GPIO_NUM_11, GPIO_NUM_12, GPIO_NUM_13, GPIO_NUM_14, GPIO_NUM_15,
+   GPIO_NUM_16, GPIO_NUM_17, GPIO_NUM_18, GPIO_NUM_19, GPIO_NUM_20, GPIO_NUM_21, GPIO_NUM_22, GPIO_NUM_23,
+   GPIO_NUM_24, GPIO_NUM_25, GPIO_NUM_26, GPIO_NUM_27, GPIO_NUM_28, GPIO_NUM_29, GPIO_NUM_30, GPIO_NUM_31,
+   GPIO_NUM_32, GPIO_NUM_33, GPIO_NUM_34, GPIO_NUM_35, GPIO_NUM_36, GPIO_NUM_37, GPIO_NUM_38, GPIO_NUM_39
+};
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+int digitalPinToInterrupt(int pin);
+void attachInterruptArg(uint8_t pin, void (*userFunc)(void*), void* arg, int mode);
+void detachInterrupt(uint8_t pin);
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+
+struct EspClass{
+   uint32_t getCycleCount();
+   uint32_t getCpuFreqMHz();
+   uint32_t getFreeHeap();
+};
+extern EspClass ESP;
+
+struct HardwareSerial{
+   void begin(unsigned long baud);
+   size_t print(const char* str);
+   size_t println(const char* str = "");
+   size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+   void flush();
+};
+extern HardwareSerial Serial;
+//=============================>> Arduino core END
+
+#endif   //_LSSWTCHHOST_ARDUINO_H_
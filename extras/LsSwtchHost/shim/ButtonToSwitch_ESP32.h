@@ -0,0 +1,121 @@
+/**
+  ******************************************************************************
+  * @file	: ButtonToSwitch_ESP32.h
+  * @brief  : Host stand-in for the ButtonToSwitch_ESP32 library classes used by LimbsSafetySw_ESP32
+  *
+  * The DbncdMPBttn, TmVdblMPBttn and SnglSrvcVdblMPBttn stand-ins hold no input
+  * processing: their packed outputs status is set by the host harness through
+  * the shimSetOtptsSttsPkgd() method, and it's returned unchanged by
+  * getOtptsSttsPkgd(), so the LimbsSftyLnFSwtch objects can be driven through
+  * any underlying switches status sequence. The function set by
+  * setFVPPWhnTrnOn() is executed when the isOn flag is set by the harness, as
+  * the library does when the switch turns on.
+  *
+  * The packed status bit positions are those of the ButtonToSwitch_ESP32
+  * library otptsSttsUnpkg(uint32_t) function.
+  *
+  * Framework: None, host build
+  * Platform: Linux host
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 16/10/2026
+  *       Last update:   16/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#ifndef _LSSWTCHHOST_BUTTONTOSWITCH_ESP32_H_
+#define _LSSWTCHHOST_BUTTONTOSWITCH_ESP32_H_
+
+#include <Arduino.h>
+
+//==============================================>> General use definitions BEGIN
+#define IsOnBitPos 0
+#define IsEnabledBitPos 1
+#define PilotOnBitPos 2
+#define WrnngOnBitPos 3
+#define IsVoidedBitPos 4
+#define IsOnScndryBitPos 5
+#define OtptCurValBitPos 16
+//================================================>> General use definitions END
+
+typedef void (*fncPtrType)();
+typedef void (*fncVdPtrPrmPtrType)(void*);
+
+struct MpbOtpts_t{
+   bool isOn;
+   bool isEnabled;
+   bool pilotOn;
+   bool wrnngOn;
+   bool isVoided;
+   bool isOnScndry;
+   uint16_t otptCurVal;
+};
+
+MpbOtpts_t otptsSttsUnpkg(uint32_t pkgOtpts);
+
+class DbncdMPBttn{
+protected:
+   int8_t _mpbttnPin{-1};
+   uint32_t _otptsSttsPkgd{1UL << IsEnabledBitPos};
+   bool _beginDisabled{false};
+   bool _isOnDisabled{false};
+   bool _isStarted{false};
+   bool _outputsChange{false};
+   unsigned long int _strtDelay{0};
+   fncVdPtrPrmPtrType _fnVdPtrPrmWhnTrnOn{nullptr};
+   void* _fnVdPtrPrmWhnTrnOnArgPtr{nullptr};
+   TaskHandle_t _taskToNotifyHndl{nullptr};
+public:
+   DbncdMPBttn(const int8_t &mpbttnPin = -1, const unsigned long int &strtDelay = 0);
+   virtual ~DbncdMPBttn();
+   bool begin(const unsigned long int &pollDelayMs = 20);
+   bool end();
+   bool pause();
+   bool resume();
+   void disable();
+   void enable();
+   const bool getIsEnabled() const;
+   const bool getIsOn() const;
+   const bool getIsOnDisabled() const;
+   const bool getIsVoided() const;
+   uint32_t getOtptsSttsPkgd();
+   const bool getOutputsChange() const;
+   unsigned long int getStrtDelay();
+   void setBeginDisabled(const bool &newBeginDisabled = false);
+   void setFnWhnTrnOnPtr(void (*newFnWhnTrnOn)());
+   void setFVPPWhnTrnOn(fncVdPtrPrmPtrType newFVPPWhnTrnOn, void* argPtr = nullptr);
+   void setIsOnDisabled(const bool &newIsOnDisabled);
+   bool setOutputsChange(bool newOutputsChange);
+   bool setStrtDelay(const unsigned long int &newStrtDelay);
+   void setTaskToNotify(const TaskHandle_t &newTaskHandle);
+   /**
+    * @brief Host harness only: sets the packed outputs status returned by getOtptsSttsPkgd()
+    *
+    * A false to true isOn flag change executes the function set by setFVPPWhnTrnOn().
+    */
+   void shimSetOtptsSttsPkgd(const uint32_t &newOtptsSttsPkgd);
+};
+
+class TmVdblMPBttn: public DbncdMPBttn{
+protected:
+   unsigned long int _voidTime;
+public:
+   TmVdblMPBttn(int8_t mpbttnPin, unsigned long int voidTime, bool pulledUp = true, bool typeNO = true, unsigned long int dbncTimeOrigSett = 0, unsigned long int strtDelay = 0, bool isOnDisabled = false);
+   virtual ~TmVdblMPBttn();
+   unsigned long int getVoidTime() const;
+   bool setVoidTime(const unsigned long int &newVoidTime);
+};
+
+class SnglSrvcVdblMPBttn: public DbncdMPBttn{
+public:
+   SnglSrvcVdblMPBttn(int8_t mpbttnPin, bool pulledUp = true, bool typeNO = true, unsigned long int dbncTimeOrigSett = 0, unsigned long int strtDelay = 0);
+   virtual ~SnglSrvcVdblMPBttn();
+};
+
+#endif   //_LSSWTCHHOST_BUTTONTOSWITCH_ESP32_H_
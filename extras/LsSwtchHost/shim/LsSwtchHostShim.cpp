@@ -0,0 +1,1067 @@
+/**
+  ******************************************************************************
+  * @file	: LsSwtchHostShim.cpp
+  * @brief  : Host implementation of the Arduino-ESP32, FreeRTOS and ButtonToSwitch_ESP32 stand-ins
+  *
+  * See LsSwtchHostShim.h for the execution model emulated.
+  *
+  * Framework: None, host build
+  * Platform: Linux host
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 16/10/2026
+  *       Last update:   16/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include "LsSwtchHostShim.h"
+#include <ButtonToSwitch_ESP32.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+//===========================>> Shim internal state BEGIN
+namespace{
+   struct shimTsk_t{
+      std::mutex ntfyMtx;
+      std::condition_variable ntfyCv;
+      uint32_t ntfyVal{0};
+      bool ntfyPndng{false};
+      bool isWtng{false};
+      bool isSspndd{false};
+      std::atomic<bool> isDltd{false};
+      std::thread tskThrd;
+   };
+   struct shimTskDltd_t{};   // Thrown in the deleted task thread to unwind it from its blocking call
+   struct shimTmr_t{
+      TimerCallbackFunction_t tmrCb;
+      void* tmrId;
+      TickType_t tmrPrd;
+      bool isAutoRld;
+      bool isActv;
+      int64_t expryTmUs;
+      bool isStc;
+   };
+   struct shimEspTmr_t{
+      void (*tmrCb)(void*);
+      void* tmrCbArg;
+      bool isArmd;
+      int64_t expryTmUs;
+   };
+   struct shimPnddFn_t{
+      PendedFunction_t fnToExct;
+      void* fnPrm1;
+      uint32_t fnPrm2;
+   };
+   struct shimEvntGrp_t{
+      std::mutex evntGrpMtx;
+      std::condition_variable evntGrpCv;
+      EventBits_t evntBits{0};
+   };
+   struct shimPinIsr_t{
+      void (*isrFn)(void*);
+      void* isrArg;
+      int isrMode;
+   };
+
+   const std::chrono::steady_clock::time_point shimStrtTm{std::chrono::steady_clock::now()};
+   std::atomic<uint32_t> thrdTknNxt{1};
+   thread_local uint32_t thrdTkn{0};
+   thread_local shimTsk_t* curTsk{nullptr};
+
+   std::mutex tmrSvcMtx;   // Protects the timers lists and the pended functions queue
+   std::vector<shimTmr_t*> tmrsLst;
+   std::vector<shimEspTmr_t*> espTmrsLst;
+   std::deque<shimPnddFn_t> pnddFnsQue;
+   std::atomic<bool> tmrSvcTskRnng{false};
+   std::thread tmrSvcTskThrd;
+
+   std::mutex pinsMtx;
+   bool pinLvl[shimPinsQty]{};
+   bool pinLvlByHrnss[shimPinsQty]{};
+   uint8_t pinMd[shimPinsQty]{};
+   shimPinIsr_t pinIsr[shimPinsQty]{};
+
+   std::atomic<uint32_t> newOprtrCnt{0};
+   std::atomic<uint32_t> dltOprtrCnt{0};
+
+   uint32_t getThrdTkn(){
+      if(thrdTkn == 0)
+         thrdTkn = thrdTknNxt++;
+
+      return thrdTkn;
+   }
+
+   shimTsk_t* getCurTsk(){
+      if(curTsk == nullptr)
+         curTsk = new shimTsk_t;   // Harness threads get a task record on their first use of the notifications API
+
+      return curTsk;
+   }
+
+   /**
+    * @brief Waits on a condition variable until the predicate is true or the ticks timeout expires, unwinding the calling task if it's deleted meanwhile
+    */
+   template <typename P> bool wtFor(std::condition_variable &cv, std::unique_lock<std::mutex> &lck, const TickType_t &xTicksToWait, P prdct){
+      const std::chrono::steady_clock::time_point wtEndTm{std::chrono::steady_clock::now() + std::chrono::milliseconds(xTicksToWait)};
+      bool result{prdct()};
+
+      while(!result && ((xTicksToWait == portMAX_DELAY) || (std::chrono::steady_clock::now() < wtEndTm))){
+         cv.wait_for(lck, std::chrono::milliseconds(1));
+         if((curTsk != nullptr) && curTsk->isDltd)
+            throw shimTskDltd_t{};
+         result = prdct();
+      }
+
+      return result;
+   }
+}
+//=============================>> Shim internal state END
+
+//===========================>> Heap allocations counting BEGIN
+void* operator new(size_t size){
+   void* ptr{malloc(size?size:1)};
+
+   if(ptr == nullptr)
+      throw std::bad_alloc{};
+   ++newOprtrCnt;
+
+   return ptr;
+}
+
+void* operator new[](size_t size){
+
+   return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept{
+   if(ptr != nullptr){
+      ++dltOprtrCnt;
+      free(ptr);
+   }
+
+   return;
+}
+
+void operator delete[](void* ptr) noexcept{
+   operator delete(ptr);
+
+   return;
+}
+
+void operator delete(void* ptr, size_t) noexcept{
+   operator delete(ptr);
+
+   return;
+}
+
+void operator delete[](void* ptr, size_t) noexcept{
+   operator delete(ptr);
+
+   return;
+}
+
+uint32_t shimGetNewOprtrCnt(){
+
+   return newOprtrCnt;
+}
+//=============================>> Heap allocations counting END
+
+//===========================>> Critical sections BEGIN
+void shimMuxEnter(portMUX_TYPE* mux){
+   const uint32_t ownTkn{getThrdTkn()};
+   uint32_t expctdTkn{0};
+
+   if(__atomic_load_n(&mux->owner, __ATOMIC_ACQUIRE) != ownTkn){
+      while(!__atomic_compare_exchange_n(&mux->owner, &expctdTkn, ownTkn, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+         expctdTkn = 0;
+   }
+   ++mux->count;
+
+   return;
+}
+
+void shimMuxExit(portMUX_TYPE* mux){
+   if(--mux->count == 0)
+      __atomic_store_n(&mux->owner, 0, __ATOMIC_RELEASE);
+
+   return;
+}
+//=============================>> Critical sections END
+
+//===========================>> Timer service BEGIN
+uint32_t shimRunTmrSvc(){
+   std::vector<std::pair<TimerCallbackFunction_t, TimerHandle_t>> tmrCbs{};
+   std::vector<std::pair<void (*)(void*), void*>> espTmrCbs{};
+   shimPnddFn_t pnddFn{};
+   bool pnddFnFnd{true};
+   int64_t curTmUs{esp_timer_get_time()};
+   uint32_t result{0};
+
+   {
+      std::lock_guard<std::mutex> lck(tmrSvcMtx);
+      for(shimTmr_t* tmr: tmrsLst){
+         if(tmr->isActv && (tmr->expryTmUs <= curTmUs)){
+            tmrCbs.push_back({tmr->tmrCb, tmr});
+            if(tmr->isAutoRld)
+               tmr->expryTmUs = std::max(tmr->expryTmUs + static_cast<int64_t>(tmr->tmrPrd) * 1000, curTmUs);
+            else
+               tmr->isActv = false;
+         }
+      }
+      for(shimEspTmr_t* espTmr: espTmrsLst){
+         if(espTmr->isArmd && (espTmr->expryTmUs <= curTmUs)){
+            espTmrCbs.push_back({espTmr->tmrCb, espTmr->tmrCbArg});
+            espTmr->isArmd = false;
+         }
+      }
+   }
+   for(auto &espTmrCb: espTmrCbs)
+      espTmrCb.first(espTmrCb.second);
+   for(auto &tmrCb: tmrCbs)
+      tmrCb.first(tmrCb.second);
+   result = static_cast<uint32_t>(tmrCbs.size() + espTmrCbs.size());
+
+   while(pnddFnFnd){
+      {
+         std::lock_guard<std::mutex> lck(tmrSvcMtx);
+         pnddFnFnd = !pnddFnsQue.empty();
+         if(pnddFnFnd){
+            pnddFn = pnddFnsQue.front();
+            pnddFnsQue.pop_front();
+         }
+      }
+      if(pnddFnFnd){
+         pnddFn.fnToExct(pnddFn.fnPrm1, pnddFn.fnPrm2);
+         ++result;
+      }
+   }
+
+   return result;
+}
+
+void shimStrtTmrSvcTsk(){
+   if(!tmrSvcTskRnng.exchange(true)){
+      tmrSvcTskThrd = std::thread([](){
+         while(tmrSvcTskRnng){
+            shimRunTmrSvc();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+         }
+      });
+   }
+
+   return;
+}
+
+void shimStopTmrSvcTsk(){
+   if(tmrSvcTskRnng.exchange(false))
+      tmrSvcTskThrd.join();
+
+   return;
+}
+
+size_t shimGetPndngFnCallsQty(){
+   std::lock_guard<std::mutex> lck(tmrSvcMtx);
+
+   return pnddFnsQue.size();
+}
+
+TimerHandle_t xTimerCreate(const char* pcTimerName, TickType_t xTimerPeriod, UBaseType_t uxAutoReload, void* pvTimerID, TimerCallbackFunction_t pxCallbackFunction){
+   shimTmr_t* result{new shimTmr_t{pxCallbackFunction, pvTimerID, xTimerPeriod, uxAutoReload != pdFALSE, false, 0, false}};
+   std::lock_guard<std::mutex> lck(tmrSvcMtx);
+
+   tmrsLst.push_back(result);
+
+   return result;
+}
+
+TimerHandle_t xTimerCreateStatic(const char* pcTimerName, TickType_t xTimerPeriod, UBaseType_t uxAutoReload, void* pvTimerID, TimerCallbackFunction_t pxCallbackFunction, StaticTimer_t* pxTimerBuffer){
+   static_assert(sizeof(StaticTimer_t) >= sizeof(shimTmr_t), "StaticTimer_t too small for the shim timer");
+   shimTmr_t* result{new (pxTimerBuffer) shimTmr_t{pxCallbackFunction, pvTimerID, xTimerPeriod, uxAutoReload != pdFALSE, false, 0, true}};
+   std::lock_guard<std::mutex> lck(tmrSvcMtx);
+
+   tmrsLst.push_back(result);
+
+   return result;
+}
+
+BaseType_t xTimerStart(TimerHandle_t xTimer, TickType_t xTicksToWait){
+   shimTmr_t* tmr{static_cast<shimTmr_t*>(xTimer)};
+   std::lock_guard<std::mutex> lck(tmrSvcMtx);
+
+   tmr->isActv = true;
+   tmr->expryTmUs = esp_timer_get_time() + static_cast<int64_t>(tmr->tmrPrd) * 1000;
+
+   return pdPASS;
+}
+
+BaseType_t xTimerStop(TimerHandle_t xTimer, TickType_t xTicksToWait){
+   std::lock_guard<std::mutex> lck(tmrSvcMtx);
+
+   static_cast<shimTmr_t*>(xTimer)->isActv = false;
+
+   return pdPASS;
+}
+
+BaseType_t xTimerReset(TimerHandle_t xTimer, TickType_t xTicksToWait){
+
+   return xTimerStart(xTimer, xTicksToWait);
+}
+
+BaseType_t xTimerDelete(TimerHandle_t xTimer, TickType_t xTicksToWait){
+   shimTmr_t* tmr{static_cast<shimTmr_t*>(xTimer)};
+   std::lock_guard<std::mutex> lck(tmrSvcMtx);
+
+   tmrsLst.erase(std::remove(tmrsLst.begin(), tmrsLst.end(), tmr), tmrsLst.end());
+   if(!tmr->isStc)
+      delete tmr;   // Static timers live in their owner's StaticTimer_t buffer, and are only unlisted
+
+   return pdPASS;
+}
+
+BaseType_t xTimerChangePeriod(TimerHandle_t xTimer, TickType_t xNewPeriod, TickType_t xTicksToWait){
+   static_cast<shimTmr_t*>(xTimer)->tmrPrd = xNewPeriod;
+
+   return xTimerStart(xTimer, xTicksToWait);
+}
+
+BaseType_t xTimerStartFromISR(TimerHandle_t xTimer, BaseType_t* pxHigherPriorityTaskWoken){
+
+   return xTimerStart(xTimer, 0);
+}
+
+BaseType_t xTimerResetFromISR(TimerHandle_t xTimer, BaseType_t* pxHigherPriorityTaskWoken){
+
+   return xTimerStart(xTimer, 0);
+}
+
+BaseType_t xTimerIsTimerActive(TimerHandle_t xTimer){
+   std::lock_guard<std::mutex> lck(tmrSvcMtx);
+
+   return static_cast<shimTmr_t*>(xTimer)->isActv?pdTRUE:pdFALSE;
+}
+
+BaseType_t xTimerPendFunctionCall(PendedFunction_t xFunctionToPend, void* pvParameter1, uint32_t ulParameter2, TickType_t xTicksToWait){
+   BaseType_t result{pdFAIL};
+   std::lock_guard<std::mutex> lck(tmrSvcMtx);
+
+   if(pnddFnsQue.size() < shimTmrQueLngth){
+      pnddFnsQue.push_back({xFunctionToPend, pvParameter1, ulParameter2});
+      result = pdPASS;
+   }
+
+   return result;
+}
+
+BaseType_t xTimerPendFunctionCallFromISR(PendedFunction_t xFunctionToPend, void* pvParameter1, uint32_t ulParameter2, BaseType_t* pxHigherPriorityTaskWoken){
+
+   return xTimerPendFunctionCall(xFunctionToPend, pvParameter1, ulParameter2, 0);
+}
+
+void* pvTimerGetTimerID(TimerHandle_t xTimer){
+
+   return static_cast<shimTmr_t*>(xTimer)->tmrId;
+}
+//=============================>> Timer service END
+
+//===========================>> Tasks and notifications BEGIN
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t pvTaskCode, const char* pcName, uint32_t usStackDepth, void* pvParameters, UBaseType_t uxPriority, TaskHandle_t* pvCreatedTask, BaseType_t xCoreID){
+   shimTsk_t* tsk{new shimTsk_t};
+
+   if(pvCreatedTask != nullptr)
+      *pvCreatedTask = tsk;
+   tsk->tskThrd = std::thread([tsk, pvTaskCode, pvParameters](){
+      curTsk = tsk;
+      try{
+         pvTaskCode(pvParameters);
+      }
+      catch(const shimTskDltd_t&){
+      }
+   });
+
+   return pdPASS;
+}
+
+TaskHandle_t xTaskCreateStaticPinnedToCore(TaskFunction_t pvTaskCode, const char* pcName, uint32_t ulStackDepth, void* pvParameters, UBaseType_t uxPriority, StackType_t* pxStackBuffer, StaticTask_t* pxTaskBuffer, BaseType_t xCoreID){
+   TaskHandle_t result{nullptr};
+
+   xTaskCreatePinnedToCore(pvTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, &result, xCoreID);
+
+   return result;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(){
+
+   return getCurTsk();
+}
+
+eTaskState eTaskGetState(TaskHandle_t xTask){
+   shimTsk_t* tsk{static_cast<shimTsk_t*>(xTask)};
+   eTaskState result{eReady};
+   std::lock_guard<std::mutex> lck(tsk->ntfyMtx);
+
+   if(tsk->isDltd)
+      result = eDeleted;
+   else if(tsk->isSspndd)
+      result = eSuspended;
+   else if(tsk->isWtng)
+      result = eBlocked;
+
+   return result;
+}
+
+void vTaskSuspend(TaskHandle_t xTaskToSuspend){
+   shimTsk_t* tsk{static_cast<shimTsk_t*>((xTaskToSuspend == nullptr)?getCurTsk():xTaskToSuspend)};
+   std::lock_guard<std::mutex> lck(tsk->ntfyMtx);
+
+   tsk->isSspndd = true;   // Registered only, the host threads are not suspended
+
+   return;
+}
+
+void vTaskDelete(TaskHandle_t xTaskToDelete){
+   shimTsk_t* tsk{static_cast<shimTsk_t*>(xTaskToDelete)};
+
+   if((tsk == nullptr) || (tsk == curTsk)){
+      if(curTsk != nullptr && curTsk->tskThrd.get_id() == std::this_thread::get_id())
+         throw shimTskDltd_t{};
+   }
+   else{
+      {
+         std::lock_guard<std::mutex> lck(tsk->ntfyMtx);
+         tsk->isDltd = true;
+      }
+      tsk->ntfyCv.notify_all();
+      if(tsk->tskThrd.joinable())
+         tsk->tskThrd.join();   // The task is unwound at its next blocking call
+      delete tsk;
+   }
+
+   return;
+}
+
+void vTaskDelay(TickType_t xTicksToDelay){
+   std::this_thread::sleep_for(std::chrono::milliseconds(xTicksToDelay));
+   if((curTsk != nullptr) && curTsk->isDltd)
+      throw shimTskDltd_t{};
+
+   return;
+}
+
+void vTaskDelayUntil(TickType_t* pxPreviousWakeTime, TickType_t xTimeIncrement){
+   *pxPreviousWakeTime += xTimeIncrement;
+   if(*pxPreviousWakeTime > xTaskGetTickCount())
+      vTaskDelay(*pxPreviousWakeTime - xTaskGetTickCount());
+
+   return;
+}
+
+TickType_t xTaskGetTickCount(){
+
+   return static_cast<TickType_t>(esp_timer_get_time() / 1000);
+}
+
+TickType_t xTaskGetTickCountFromISR(){
+
+   return xTaskGetTickCount();
+}
+
+BaseType_t xPortGetCoreID(){
+
+   return 0;
+}
+
+BaseType_t xTaskNotify(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction){
+   shimTsk_t* tsk{static_cast<shimTsk_t*>(xTaskToNotify)};
+   BaseType_t result{pdPASS};
+
+   {
+      std::lock_guard<std::mutex> lck(tsk->ntfyMtx);
+      switch(eAction){
+         case eSetBits:
+            tsk->ntfyVal |= ulValue;
+            break;
+         case eIncrement:
+            ++tsk->ntfyVal;
+            break;
+         case eSetValueWithOverwrite:
+            tsk->ntfyVal = ulValue;
+            break;
+         case eSetValueWithoutOverwrite:
+            if(tsk->ntfyPndng)
+               result = pdFAIL;
+            else
+               tsk->ntfyVal = ulValue;
+            break;
+         default:
+            break;
+      }
+      tsk->ntfyPndng = true;
+   }
+   tsk->ntfyCv.notify_all();
+
+   return result;
+}
+
+BaseType_t xTaskNotifyFromISR(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, BaseType_t* pxHigherPriorityTaskWoken){
+
+   return xTaskNotify(xTaskToNotify, ulValue, eAction);
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t xTaskToNotify){
+
+   return xTaskNotify(xTaskToNotify, 0, eIncrement);
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t xTaskToNotify, BaseType_t* pxHigherPriorityTaskWoken){
+   xTaskNotify(xTaskToNotify, 0, eIncrement);
+
+   return;
+}
+
+BaseType_t xTaskNotifyWait(uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t* pulNotificationValue, TickType_t xTicksToWait){
+   shimTsk_t* tsk{getCurTsk()};
+   BaseType_t result{pdFALSE};
+   std::unique_lock<std::mutex> lck(tsk->ntfyMtx);
+
+   if(!tsk->ntfyPndng)
+      tsk->ntfyVal &= ~ulBitsToClearOnEntry;
+   tsk->isWtng = true;
+   wtFor(tsk->ntfyCv, lck, xTicksToWait, [tsk](){return tsk->ntfyPndng;});
+   tsk->isWtng = false;
+   if(pulNotificationValue != nullptr)
+      *pulNotificationValue = tsk->ntfyVal;
+   if(tsk->ntfyPndng){
+      tsk->ntfyVal &= ~ulBitsToClearOnExit;
+      tsk->ntfyPndng = false;
+      result = pdTRUE;
+   }
+
+   return result;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait){
+   shimTsk_t* tsk{getCurTsk()};
+   uint32_t result{0};
+   std::unique_lock<std::mutex> lck(tsk->ntfyMtx);
+
+   tsk->isWtng = true;
+   wtFor(tsk->ntfyCv, lck, xTicksToWait, [tsk](){return tsk->ntfyVal != 0;});
+   tsk->isWtng = false;
+   result = tsk->ntfyVal;
+   if(result != 0)
+      tsk->ntfyVal = (xClearCountOnExit != pdFALSE)?0:(result - 1);
+   tsk->ntfyPndng = false;
+
+   return result;
+}
+//=============================>> Tasks and notifications END
+
+//===========================>> Event groups BEGIN
+EventGroupHandle_t xEventGroupCreate(){
+
+   return new shimEvntGrp_t;
+}
+
+EventGroupHandle_t xEventGroupCreateStatic(StaticEventGroup_t* pxEventGroupBuffer){
+
+   return new shimEvntGrp_t;  // std::mutex and std::condition_variable don't fit the target's StaticEventGroup_t size
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t xEventGroup, EventBits_t uxBitsToSet){
+   shimEvntGrp_t* evntGrp{static_cast<shimEvntGrp_t*>(xEventGroup)};
+   EventBits_t result{0};
+
+   {
+      std::lock_guard<std::mutex> lck(evntGrp->evntGrpMtx);
+      evntGrp->evntBits |= uxBitsToSet;
+      result = evntGrp->evntBits;
+   }
+   evntGrp->evntGrpCv.notify_all();
+
+   return result;
+}
+
+BaseType_t xEventGroupSetBitsFromISR(EventGroupHandle_t xEventGroup, EventBits_t uxBitsToSet, BaseType_t* pxHigherPriorityTaskWoken){
+   xEventGroupSetBits(xEventGroup, uxBitsToSet);
+
+   return pdPASS;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t xEventGroup, EventBits_t uxBitsToClear){
+   shimEvntGrp_t* evntGrp{static_cast<shimEvntGrp_t*>(xEventGroup)};
+   std::lock_guard<std::mutex> lck(evntGrp->evntGrpMtx);
+   EventBits_t result{evntGrp->evntBits};
+
+   evntGrp->evntBits &= ~uxBitsToClear;
+
+   return result;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t xEventGroup){
+   shimEvntGrp_t* evntGrp{static_cast<shimEvntGrp_t*>(xEventGroup)};
+   std::lock_guard<std::mutex> lck(evntGrp->evntGrpMtx);
+
+   return evntGrp->evntBits;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t xEventGroup, EventBits_t uxBitsToWaitFor, BaseType_t xClearOnExit, BaseType_t xWaitForAllBits, TickType_t xTicksToWait){
+   shimEvntGrp_t* evntGrp{static_cast<shimEvntGrp_t*>(xEventGroup)};
+   EventBits_t result{0};
+   std::unique_lock<std::mutex> lck(evntGrp->evntGrpMtx);
+   auto isStsfd = [&](){return (xWaitForAllBits != pdFALSE)?((evntGrp->evntBits & uxBitsToWaitFor) == uxBitsToWaitFor):((evntGrp->evntBits & uxBitsToWaitFor) != 0);};
+
+   wtFor(evntGrp->evntGrpCv, lck, xTicksToWait, isStsfd);
+   result = evntGrp->evntBits;
+   if(isStsfd() && (xClearOnExit != pdFALSE))
+      evntGrp->evntBits &= ~uxBitsToWaitFor;
+
+   return result;
+}
+
+void vEventGroupDelete(EventGroupHandle_t xEventGroup){
+   delete static_cast<shimEvntGrp_t*>(xEventGroup);
+
+   return;
+}
+//=============================>> Event groups END
+
+//===========================>> ESP-IDF API BEGIN
+int64_t esp_timer_get_time(){
+
+   return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - shimStrtTm).count();
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* create_args, esp_timer_handle_t* out_handle){
+   shimEspTmr_t* espTmr{new shimEspTmr_t{create_args->callback, create_args->arg, false, 0}};
+   std::lock_guard<std::mutex> lck(tmrSvcMtx);
+
+   espTmrsLst.push_back(espTmr);
+   *out_handle = espTmr;
+
+   return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us){
+   shimEspTmr_t* espTmr{static_cast<shimEspTmr_t*>(timer)};
+   std::lock_guard<std::mutex> lck(tmrSvcMtx);
+
+   espTmr->isArmd = true;
+   espTmr->expryTmUs = esp_timer_get_time() + static_cast<int64_t>(timeout_us);
+
+   return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer){
+   shimEspTmr_t* espTmr{static_cast<shimEspTmr_t*>(timer)};
+   esp_err_t result{ESP_FAIL};
+   std::lock_guard<std::mutex> lck(tmrSvcMtx);
+
+   if(espTmr->isArmd){
+      espTmr->isArmd = false;
+      result = ESP_OK;
+   }
+
+   return result;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer){
+   shimEspTmr_t* espTmr{static_cast<shimEspTmr_t*>(timer)};
+   std::lock_guard<std::mutex> lck(tmrSvcMtx);
+
+   espTmrsLst.erase(std::remove(espTmrsLst.begin(), espTmrsLst.end(), espTmr), espTmrsLst.end());
+   delete espTmr;
+
+   return ESP_OK;
+}
+
+uint32_t REG_READ(uint32_t reg){
+   const uint8_t frstPin{static_cast<uint8_t>((reg == GPIO_IN1_REG)?32:0)};
+   uint32_t result{0};
+   std::lock_guard<std::mutex> lck(pinsMtx);
+
+   for(uint8_t pinNum{0}; pinNum < 32; ++pinNum){
+      if(pinLvl[frstPin + pinNum])
+         result |= (1UL << pinNum);
+   }
+
+   return result;
+}
+
+void REG_WRITE(uint32_t reg, uint32_t val){
+   const uint8_t frstPin{static_cast<uint8_t>(((reg == GPIO_OUT1_W1TS_REG) || (reg == GPIO_OUT1_W1TC_REG))?32:0)};
+   const bool newLvl{(reg == GPIO_OUT_W1TS_REG) || (reg == GPIO_OUT1_W1TS_REG)};
+   std::lock_guard<std::mutex> lck(pinsMtx);
+
+   for(uint8_t pinNum{0}; pinNum < 32; ++pinNum){
+      if(val & (1UL << pinNum))
+         pinLvl[frstPin + pinNum] = newLvl;
+   }
+
+   return;
+}
+
+void heap_caps_get_info(multi_heap_info_t* info, uint32_t caps){
+   *info = multi_heap_info_t{};
+   info->allocated_blocks = newOprtrCnt - dltOprtrCnt;
+
+   return;
+}
+//=============================>> ESP-IDF API END
+
+//===========================>> Arduino core BEGIN
+EspClass ESP;
+HardwareSerial Serial;
+
+void shimSetPinLvl(const uint8_t &pin, const bool &lvl){
+   shimPinIsr_t isr{};
+   bool isEdge{false};
+
+   {
+      std::lock_guard<std::mutex> lck(pinsMtx);
+      isEdge = pinLvl[pin] != lvl;
+      pinLvl[pin] = lvl;
+      pinLvlByHrnss[pin] = true;
+      isr = pinIsr[pin];
+   }
+   if(isEdge && (isr.isrFn != nullptr) && ((isr.isrMode == CHANGE) || ((isr.isrMode == RISING) == lvl)))
+      isr.isrFn(isr.isrArg);
+
+   return;
+}
+
+void shimRlsPin(const uint8_t &pin){
+   shimPinIsr_t isr{};
+   bool isEdge{false};
+   bool lvl{false};
+
+   {
+      std::lock_guard<std::mutex> lck(pinsMtx);
+      // A pin with no pull resistor floats, modeled as keeping its last level
+      lvl = (pinMd[pin] == INPUT_PULLUP) || ((pinMd[pin] != INPUT_PULLDOWN) && pinLvl[pin]);
+      isEdge = pinLvl[pin] != lvl;
+      pinLvl[pin] = lvl;
+      pinLvlByHrnss[pin] = false;
+      isr = pinIsr[pin];
+   }
+   if(isEdge && (isr.isrFn != nullptr) && ((isr.isrMode == CHANGE) || ((isr.isrMode == RISING) == lvl)))
+      isr.isrFn(isr.isrArg);
+
+   return;
+}
+
+bool shimGetPinLvl(const uint8_t &pin){
+   std::lock_guard<std::mutex> lck(pinsMtx);
+
+   return pinLvl[pin];
+}
+
+void pinMode(uint8_t pin, uint8_t mode){
+   std::lock_guard<std::mutex> lck(pinsMtx);
+
+   pinMd[pin] = mode;
+   if(!pinLvlByHrnss[pin]){
+      if(mode == INPUT_PULLUP)
+         pinLvl[pin] = true;
+      else if(mode == INPUT_PULLDOWN)
+         pinLvl[pin] = false;
+   }
+
+   return;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val){
+   std::lock_guard<std::mutex> lck(pinsMtx);
+
+   pinLvl[pin] = (val != LOW);
+
+   return;
+}
+
+int digitalRead(uint8_t pin){
+
+   return shimGetPinLvl(pin)?HIGH:LOW;
+}
+
+int digitalPinToInterrupt(int pin){
+
+   return pin;
+}
+
+void attachInterruptArg(uint8_t pin, void (*userFunc)(void*), void* arg, int mode){
+   std::lock_guard<std::mutex> lck(pinsMtx);
+
+   pinIsr[pin] = {userFunc, arg, mode};
+
+   return;
+}
+
+void detachInterrupt(uint8_t pin){
+   std::lock_guard<std::mutex> lck(pinsMtx);
+
+   pinIsr[pin] = {};
+
+   return;
+}
+
+unsigned long millis(){
+
+   return static_cast<unsigned long>(esp_timer_get_time() / 1000);
+}
+
+unsigned long micros(){
+
+   return static_cast<unsigned long>(esp_timer_get_time());
+}
+
+void delay(uint32_t ms){
+   vTaskDelay(ms);
+
+   return;
+}
+
+uint32_t EspClass::getCycleCount(){
+
+   return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - shimStrtTm).count());
+}
+
+uint32_t EspClass::getCpuFreqMHz(){
+
+   return 1000;
+}
+
+uint32_t EspClass::getFreeHeap(){
+
+   return 0;
+}
+
+void HardwareSerial::begin(unsigned long baud){
+
+   return;
+}
+
+size_t HardwareSerial::print(const char* str){
+
+   return static_cast<size_t>(fputs(str, stdout));
+}
+
+size_t HardwareSerial::println(const char* str){
+
+   return static_cast<size_t>(::printf("%s\n", str));
+}
+
+size_t HardwareSerial::printf(const char* format, ...){
+   va_list args;
+   int result{0};
+
+   va_start(args, format);
+   result = vprintf(format, args);
+   va_end(args);
+
+   return static_cast<size_t>(result);
+}
+
+void HardwareSerial::flush(){
+   fflush(stdout);
+
+   return;
+}
+//=============================>> Arduino core END
+
+//===========================>> ButtonToSwitch_ESP32 stand-ins BEGIN
+MpbOtpts_t otptsSttsUnpkg(uint32_t pkgOtpts){
+   MpbOtpts_t result{};
+
+   result.isOn = (pkgOtpts >> IsOnBitPos) & 0x01;
+   result.isEnabled = (pkgOtpts >> IsEnabledBitPos) & 0x01;
+   result.pilotOn = (pkgOtpts >> PilotOnBitPos) & 0x01;
+   result.wrnngOn = (pkgOtpts >> WrnngOnBitPos) & 0x01;
+   result.isVoided = (pkgOtpts >> IsVoidedBitPos) & 0x01;
+   result.isOnScndry = (pkgOtpts >> IsOnScndryBitPos) & 0x01;
+   result.otptCurVal = static_cast<uint16_t>(pkgOtpts >> OtptCurValBitPos);
+
+   return result;
+}
+
+DbncdMPBttn::DbncdMPBttn(const int8_t &mpbttnPin, const unsigned long int &strtDelay)
+:_mpbttnPin{mpbttnPin}, _strtDelay{strtDelay}
+{
+}
+
+DbncdMPBttn::~DbncdMPBttn(){
+}
+
+bool DbncdMPBttn::begin(const unsigned long int &pollDelayMs){
+   _isStarted = true;
+   if(_beginDisabled)
+      disable();
+
+   return true;
+}
+
+void DbncdMPBttn::disable(){
+   _otptsSttsPkgd &= ~(1UL << IsEnabledBitPos);
+   if(_isOnDisabled)
+      _otptsSttsPkgd |= (1UL << IsOnBitPos);
+   else
+      _otptsSttsPkgd &= ~(1UL << IsOnBitPos);
+
+   return;
+}
+
+void DbncdMPBttn::enable(){
+   _otptsSttsPkgd |= (1UL << IsEnabledBitPos);
+   _otptsSttsPkgd &= ~(1UL << IsOnBitPos);
+
+   return;
+}
+
+bool DbncdMPBttn::end(){
+   _isStarted = false;
+
+   return true;
+}
+
+const bool DbncdMPBttn::getIsEnabled() const{
+
+   return (_otptsSttsPkgd >> IsEnabledBitPos) & 0x01;
+}
+
+const bool DbncdMPBttn::getIsOn() const{
+
+   return (_otptsSttsPkgd >> IsOnBitPos) & 0x01;
+}
+
+const bool DbncdMPBttn::getIsOnDisabled() const{
+
+   return _isOnDisabled;
+}
+
+const bool DbncdMPBttn::getIsVoided() const{
+
+   return (_otptsSttsPkgd >> IsVoidedBitPos) & 0x01;
+}
+
+uint32_t DbncdMPBttn::getOtptsSttsPkgd(){
+
+   return _otptsSttsPkgd;
+}
+
+const bool DbncdMPBttn::getOutputsChange() const{
+
+   return _outputsChange;
+}
+
+unsigned long int DbncdMPBttn::getStrtDelay(){
+
+   return _strtDelay;
+}
+
+bool DbncdMPBttn::pause(){
+
+   return true;
+}
+
+bool DbncdMPBttn::resume(){
+
+   return true;
+}
+
+void DbncdMPBttn::setBeginDisabled(const bool &newBeginDisabled){
+   _beginDisabled = newBeginDisabled;
+
+   return;
+}
+
+void DbncdMPBttn::setFnWhnTrnOnPtr(void (*newFnWhnTrnOn)()){
+
+   return;
+}
+
+void DbncdMPBttn::setFVPPWhnTrnOn(fncVdPtrPrmPtrType newFVPPWhnTrnOn, void* argPtr){
+   _fnVdPtrPrmWhnTrnOn = newFVPPWhnTrnOn;
+   _fnVdPtrPrmWhnTrnOnArgPtr = argPtr;
+
+   return;
+}
+
+void DbncdMPBttn::setIsOnDisabled(const bool &newIsOnDisabled){
+   _isOnDisabled = newIsOnDisabled;
+   if(!getIsEnabled())
+      disable();
+
+   return;
+}
+
+bool DbncdMPBttn::setOutputsChange(bool newOutputsChange){
+   _outputsChange = newOutputsChange;
+
+   return true;
+}
+
+bool DbncdMPBttn::setStrtDelay(const unsigned long int &newStrtDelay){
+   _strtDelay = newStrtDelay;
+
+   return true;
+}
+
+void DbncdMPBttn::setTaskToNotify(const TaskHandle_t &newTaskHandle){
+   _taskToNotifyHndl = newTaskHandle;
+
+   return;
+}
+
+void DbncdMPBttn::shimSetOtptsSttsPkgd(const uint32_t &newOtptsSttsPkgd){
+   const bool wasOn{getIsOn()};
+
+   _otptsSttsPkgd = newOtptsSttsPkgd;
+   _outputsChange = true;
+   if(!wasOn && getIsOn() && (_fnVdPtrPrmWhnTrnOn != nullptr))
+      _fnVdPtrPrmWhnTrnOn(_fnVdPtrPrmWhnTrnOnArgPtr);
+
+   return;
+}
+
+TmVdblMPBttn::TmVdblMPBttn(int8_t mpbttnPin, unsigned long int voidTime, bool pulledUp, bool typeNO, unsigned long int dbncTimeOrigSett, unsigned long int strtDelay, bool isOnDisabled)
+:DbncdMPBttn(mpbttnPin, strtDelay), _voidTime{voidTime}
+{
+   _isOnDisabled = isOnDisabled;
+}
+
+TmVdblMPBttn::~TmVdblMPBttn(){
+}
+
+unsigned long int TmVdblMPBttn::getVoidTime() const{
+
+   return _voidTime;
+}
+
+bool TmVdblMPBttn::setVoidTime(const unsigned long int &newVoidTime){
+   _voidTime = newVoidTime;
+
+   return true;
+}
+
+SnglSrvcVdblMPBttn::SnglSrvcVdblMPBttn(int8_t mpbttnPin, bool pulledUp, bool typeNO, unsigned long int dbncTimeOrigSett, unsigned long int strtDelay)
+:DbncdMPBttn(mpbttnPin, strtDelay)
+{
+}
+
+SnglSrvcVdblMPBttn::~SnglSrvcVdblMPBttn(){
+}
+//=============================>> ButtonToSwitch_ESP32 stand-ins END
@@ -0,0 +1,94 @@
+/**
+  ******************************************************************************
+  * @file	: LsSwtchHostShim.h
+  * @brief  : Host side control of the Arduino-ESP32 and FreeRTOS stand-ins
+  *
+  * The stand-ins declared in the shim Arduino.h emulate the target services
+  * with the following host execution model:
+  * - The critical sections are spinlocks, recursive for the owning thread, so
+  * the lock contention between threads is that of the target cores
+  * - The tasks created by the library run in their own std::thread, the task
+  * notifications and event groups block them as on target
+  * - The FreeRTOS software timers, the esp_timer one-shot timers and the
+  * functions pended by xTimerPendFunctionCall() are executed by the timer
+  * service, run by the harness calling shimRunTmrSvc(), or in a background
+  * thread started by shimStrtTmrSvcTsk(). The pended functions queue is
+  * shimTmrQueLngth entries long, as the target timer service queue is
+  * - The GPIO levels are kept in a pins array, the input levels are set by the
+  * harness with shimSetPinLvl(), that executes the pin attached ISR in the
+  * calling thread
+  * - The time base is the host monotonic clock, the CPU cycle counter runs at
+  * 1000 MHz so the cycle counts are nanoseconds
+  *
+  * Framework: None, host build
+  * Platform: Linux host
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 16/10/2026
+  *       Last update:   16/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#ifndef _LSSWTCHHOSTSHIM_H_
+#define _LSSWTCHHOSTSHIM_H_
+
+#include <Arduino.h>
+
+//==============================================>> General use definitions BEGIN
+const size_t shimTmrQueLngth{10};   // Timer service queue length, CONFIG_FREERTOS_TIMER_QUEUE_LENGTH default value of the Arduino-ESP32 core
+const uint8_t shimPinsQty{64};
+//================================================>> General use definitions END
+
+/**
+ * @brief Executes one timer service pass in the calling thread
+ *
+ * Executes the callbacks of the FreeRTOS software timers and the esp_timer one-shot timers expired at the time of the call, then the functions pended by xTimerPendFunctionCall() and xTimerPendFunctionCallFromISR() including those pended while the pass is executed.
+ *
+ * @return The quantity of callbacks and pended functions executed
+ */
+uint32_t shimRunTmrSvc();
+
+/**
+ * @brief Starts a background thread executing a timer service pass each millisecond
+ */
+void shimStrtTmrSvcTsk();
+
+/**
+ * @brief Stops the background timer service thread started by shimStrtTmrSvcTsk()
+ */
+void shimStopTmrSvcTsk();
+
+/**
+ * @brief Returns the quantity of functions pended to the timer service not yet executed
+ */
+size_t shimGetPndngFnCallsQty();
+
+/**
+ * @brief Sets the level of an input pin, executing the ISR attached to the pin if the edge matches its mode
+ */
+void shimSetPinLvl(const uint8_t &pin, const bool &lvl);
+
+/**
+ * @brief Stops driving an input pin from the harness, as an open contact or a broken wire do
+ *
+ * The pin level is set by the pull resistor of the mode last set by pinMode(), a pin with no pull resistor keeps its last level. The ISR attached to the pin is executed if the edge matches its mode.
+ */
+void shimRlsPin(const uint8_t &pin);
+
+/**
+ * @brief Returns the level of a pin, as last set by the harness for inputs or by the library for outputs
+ */
+bool shimGetPinLvl(const uint8_t &pin);
+
+/**
+ * @brief Returns the quantity of heap allocations made through the global operator new since the program start
+ */
+uint32_t shimGetNewOprtrCnt();
+
+#endif   //_LSSWTCHHOSTSHIM_H_
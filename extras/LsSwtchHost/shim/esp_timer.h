@@ -0,0 +1,12 @@
+/**
+  ******************************************************************************
+  * @file	: esp_timer.h
+  * @brief  : Host stand-in for the ESP-IDF esp_timer.h header, the declarations are in the shim Arduino.h
+  ******************************************************************************
+  */
+#ifndef _LSSWTCHHOST_ESP_TIMER_H_
+#define _LSSWTCHHOST_ESP_TIMER_H_
+
+#include <Arduino.h>
+
+#endif   //_LSSWTCHHOST_ESP_TIMER_H_
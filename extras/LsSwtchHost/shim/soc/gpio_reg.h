@@ -0,0 +1,12 @@
+/**
+  ******************************************************************************
+  * @file	: soc/gpio_reg.h
+  * @brief  : Host stand-in for the ESP-IDF soc/gpio_reg.h header, the declarations are in the shim Arduino.h
+  ******************************************************************************
+  */
+#ifndef _LSSWTCHHOST_GPIO_REG_H_
+#define _LSSWTCHHOST_GPIO_REG_H_
+
+#include <Arduino.h>
+
+#endif   //_LSSWTCHHOST_GPIO_REG_H_
@@ -0,0 +1,12 @@
+/**
+  ******************************************************************************
+  * @file	: soc/soc_caps.h
+  * @brief  : Host stand-in for the ESP-IDF soc/soc_caps.h header, the declarations are in the shim Arduino.h
+  ******************************************************************************
+  */
+#ifndef _LSSWTCHHOST_SOC_CAPS_H_
+#define _LSSWTCHHOST_SOC_CAPS_H_
+
+#include <Arduino.h>
+
+#endif   //_LSSWTCHHOST_SOC_CAPS_H_
@@ -0,0 +1,218 @@
+/**
+  ******************************************************************************
+  * @file	: LsSwtchLgDcdr.cpp
+  * @brief  : Host decoder tool for the LsSwtchLgEncdr binary event logs
+  *
+  * Expands a binary event log produced by the LimbsSafetySw_ESP32 library
+  * LsSwtchLgEncdr class back into one line per packed status change, as CSV
+  * -default- or as JSON lines. Each line holds the change time in microseconds,
+  * the packed status value and its decoded attribute flags.
+  *
+  * The tool is standard C++ with no dependencies, build it on the host with:
+  *    g++ -O2 -std=c++17 -o LsSwtchLgDcdr LsSwtchLgDcdr.cpp
+  *
+  * Usage:
+  *    LsSwtchLgDcdr [--json] [logFile]
+  * The log is read from the standard input if no file is given, i.e. a log
+  * captured from the UART. The exit status is 0 for a complete log, 1 for an
+  * invalid header and 2 for a log truncated inside a record, in which case the
+  * records decoded up to the truncation are still written.
+  *
+  * A header repeated between the records -a log captured across device
+  * restarts, each boot writing its own header- is taken as the start of a new
+  * encoder's records: the time resolution is updated and the next record must
+  * be a key frame. A repeated header is only accepted when followed by a key
+  * frame, another header or the log end, as a header is also a valid sequence
+  * of change records bytes.
+  *
+  * @note The packed status bit positions are those documented for the library
+  * lssOtptsSttsUnpkg(uint32_t) function, repeated here as the library header
+  * depends on the Arduino-ESP32 core.
+  *
+  * Framework: None, host tool
+  * Platform: Any C++17 host
+  *
+  * @author	: Gabriel D. Goldman
+  *
+  * @date First release: 16/10/2026
+  *       Last update:   16/10/2026 10:00 GMT+0200
+  ******************************************************************************
+  * @attention	This library gives no guarantees whatsoever about it's compliance
+  * to any expectations but as those from it's own designers. Use under your own
+  * responsibility and risk.
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+  */
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+//==============================================>> General use definitions BEGIN
+const uint8_t lgFrmtVrsn{0x01};
+const char* const sttsFlgsNames[]{"lftHndIsEnbld", "lftHndIsOn", "lftHndIsVdd", "rghtHndIsEnbld", "rghtHndIsOn", "rghtHndIsVdd", "ftSwIsEnbld", "ftSwIsOn", "ltchRlsIsOn", "prdCyclIsOn"};
+const uint8_t sttsFlgsQty{sizeof(sttsFlgsNames) / sizeof(sttsFlgsNames[0])};
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+bool dcdHdr(const std::vector<uint8_t> &lg, size_t &lgPos, uint64_t &tmRsltnUs, const bool &mdStrm);
+bool dcdVrnt(const std::vector<uint8_t> &lg, size_t &lgPos, uint64_t &val);
+void wrtRcrd(const uint64_t &tmUs, const uint32_t &otptsSttsPkgd, const bool &jsonOtpt);
+//========================================>> General use function prototypes END
+
+int main(int argc, char* argv[]){
+   bool jsonOtpt{false};
+   const char* lgFlNm{nullptr};
+   FILE* lgFl{stdin};
+   std::vector<uint8_t> lg{};
+   uint8_t rdBfr[4096];
+   size_t rdQty{0};
+   size_t lgPos{0};
+   size_t rcrdStrtPos{0};
+   uint64_t tmRsltnUs{0};
+   uint64_t curTm{0};
+   uint32_t curOtptsSttsPkgd{0};
+   uint64_t tmDlt{0};
+   uint64_t sttsXor{0};
+   bool kyFrmRcvd{false};
+   int result{0};
+
+   for(int argNum{1}; argNum < argc; ++argNum){
+      if(strcmp(argv[argNum], "--json") == 0)
+         jsonOtpt = true;
+      else
+         lgFlNm = argv[argNum];
+   }
+   if(lgFlNm != nullptr){
+      lgFl = fopen(lgFlNm, "rb");
+      if(lgFl == nullptr){
+         fprintf(stderr, "Can't open %s\n", lgFlNm);
+         return 1;
+      }
+   }
+   while((rdQty = fread(rdBfr, 1, sizeof(rdBfr), lgFl)) > 0)
+      lg.insert(lg.end(), rdBfr, rdBfr + rdQty);
+   if(lgFl != stdin)
+      fclose(lgFl);
+
+   if(!dcdHdr(lg, lgPos, tmRsltnUs, false)){
+      fprintf(stderr, "Not a LsSwtchLgEncdr version %u log, or invalid log header\n", lgFrmtVrsn);
+      return 1;
+   }
+
+   if(!jsonOtpt){
+      printf("tmUs,otptsSttsPkgd");
+      for(uint8_t flgNum{0}; flgNum < sttsFlgsQty; ++flgNum)
+         printf(",%s", sttsFlgsNames[flgNum]);
+      printf("\n");
+   }
+   while((lgPos < lg.size()) && (result == 0)){
+      rcrdStrtPos = lgPos;
+      if(dcdHdr(lg, lgPos, tmRsltnUs, true)){
+         // Repeated header: a new encoder -i.e. a device restart- appended its records, starting with a key frame
+         kyFrmRcvd = false;
+      }
+      else if(!dcdVrnt(lg, lgPos, tmDlt) || !dcdVrnt(lg, lgPos, sttsXor)){
+         result = 2;
+      }
+      else if((tmDlt == 0) && (sttsXor == 0)){
+         // Key frame: absolute time and packed status follow
+         if(!dcdVrnt(lg, lgPos, curTm) || !dcdVrnt(lg, lgPos, sttsXor)){
+            result = 2;
+         }
+         else{
+            curOtptsSttsPkgd = static_cast<uint32_t>(sttsXor);
+            kyFrmRcvd = true;
+            wrtRcrd(curTm * tmRsltnUs, curOtptsSttsPkgd, jsonOtpt);
+         }
+      }
+      else if(!kyFrmRcvd){
+         fprintf(stderr, "Change record before the first key frame at byte %zu\n", rcrdStrtPos);
+         return 1;
+      }
+      else{
+         curTm += tmDlt;
+         curOtptsSttsPkgd ^= static_cast<uint32_t>(sttsXor);
+         wrtRcrd(curTm * tmRsltnUs, curOtptsSttsPkgd, jsonOtpt);
+      }
+   }
+   if(result == 2)
+      fprintf(stderr, "Log truncated inside the record starting at byte %zu\n", rcrdStrtPos);
+
+   return result;
+}
+
+//===============================>> User Functions Implementations BEGIN
+/**
+ * @brief Decodes a log header
+ *
+ * @param lg Log contents
+ * @param lgPos Position of the first byte of the header, updated to the position following its last byte if the header is decoded
+ * @param tmRsltnUs Reference to the variable receiving the records time resolution, in microseconds, updated only if the header is decoded
+ * @param mdStrm true for a header repeated between the records, that must be followed by a key frame, another header or the log end
+ * @retval true The header was decoded
+ * @retval false There's no valid header at the lgPos position, lgPos and tmRsltnUs were not modified
+ */
+bool dcdHdr(const std::vector<uint8_t> &lg, size_t &lgPos, uint64_t &tmRsltnUs, const bool &mdStrm){
+   bool result{false};
+   size_t hdrPos{lgPos + 4};
+   uint64_t hdrTmRsltnUs{0};
+
+   if(((lgPos + 4) < lg.size()) && (lg[lgPos] == 'L') && (lg[lgPos + 1] == 'S') && (lg[lgPos + 2] == 'L') && (lg[lgPos + 3] == lgFrmtVrsn)){
+      if(dcdVrnt(lg, hdrPos, hdrTmRsltnUs) && (hdrTmRsltnUs != 0)){
+         result = !mdStrm || (hdrPos == lg.size()) || (lg[hdrPos] == 'L') || (((hdrPos + 1) < lg.size()) && (lg[hdrPos] == 0x00) && (lg[hdrPos + 1] == 0x00));
+         if(result){
+            lgPos = hdrPos;
+            tmRsltnUs = hdrTmRsltnUs;
+         }
+      }
+   }
+
+   return result;
+}
+
+/**
+ * @brief Decodes a LEB128 variable length unsigned integer
+ *
+ * @param lg Log contents
+ * @param lgPos Position of the first byte of the integer, updated to the position following its last byte
+ * @param val Reference to the variable receiving the decoded value
+ * @retval true The integer was decoded
+ * @retval false The log ends inside the integer, or the integer exceeds 64 bits
+ */
+bool dcdVrnt(const std::vector<uint8_t> &lg, size_t &lgPos, uint64_t &val){
+   bool result{false};
+   uint8_t shft{0};
+
+   val = 0;
+   while((lgPos < lg.size()) && (shft < 64) && !result){
+      val |= static_cast<uint64_t>(lg[lgPos] & 0x7F) << shft;
+      result = !(lg[lgPos] & 0x80);
+      shft += 7;
+      ++lgPos;
+   }
+
+   return result;
+}
+
+/**
+ * @brief Writes a decoded packed status change line to the standard output
+ */
+void wrtRcrd(const uint64_t &tmUs, const uint32_t &otptsSttsPkgd, const bool &jsonOtpt){
+   if(jsonOtpt){
+      printf("{\"tmUs\":%llu,\"otptsSttsPkgd\":%lu", static_cast<unsigned long long>(tmUs), static_cast<unsigned long>(otptsSttsPkgd));
+      for(uint8_t flgNum{0}; flgNum < sttsFlgsQty; ++flgNum)
+         printf(",\"%s\":%s", sttsFlgsNames[flgNum], ((otptsSttsPkgd >> flgNum) & 0x01)?"true":"false");
+      printf("}\n");
+   }
+   else{
+      printf("%llu,%lu", static_cast<unsigned long long>(tmUs), static_cast<unsigned long>(otptsSttsPkgd));
+      for(uint8_t flgNum{0}; flgNum < sttsFlgsQty; ++flgNum)
+         printf(",%u", (otptsSttsPkgd >> flgNum) & 0x01);
+      printf("\n");
+   }
+
+   return;
+}
+//===============================>> User Functions Implementations END
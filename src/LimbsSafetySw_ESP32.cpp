@@ -26,10 +26,25 @@
   */
 
 #include "LimbsSafetySw_ESP32.h"
+#include <new>
+#include <math.h>
+#if !defined(ARDUINO_ARCH_ESP32)
+   #include <time.h>
+#endif
+
+#if _lsSwtchPrfInstr
+   // Times the update stage just completed with the _prfLap() helper, using the update's prfStgTcks and prfLapStrtTcks local variables
+   #define _lsSwtchPrfLap(prfStgId) _prfLap(prfStgTcks, prfLapStrtTcks, prfStgId)
+   // Executes a FDA step with the _prfFdaStp() helper, registering it in the update's prfFdaStps local array
+   #define _lsSwtchPrfFdaStp() _prfFdaStp(prfFdaStps, prfFdaStpsQty, sizeof(prfFdaStps) / sizeof(prfFdaStps[0]))
+#else
+   #define _lsSwtchPrfLap(prfStgId) do{}while(0)
+   #define _lsSwtchPrfFdaStp() _updFdaState()
+#endif
 
 
 //=======================================> Static variables initialization BEGIN
-bool LimbsSftyLnFSwtch::_ltchRlsPndng = false;
+const float LsSwtchStrmSttstc::_qntlsPrbblty[_sttstcQntlsQty]{0.5, 0.9, 0.99};
 //=========================================> Static variables initialization END
 
 //=========================================================================> Class methods delimiter
@@ -40,10 +55,16 @@ LimbsSftyLnFSwtch::LimbsSftyLnFSwtch()
 LimbsSftyLnFSwtch::LimbsSftyLnFSwtch(swtchInptHwCfg_t lftHndInpCfg, swtchBhvrCfg_t lftHndBhvrCfg, swtchInptHwCfg_t rghtHndInpCfg, swtchBhvrCfg_t rghtHndBhvrCfg, swtchInptHwCfg_t ftInpCfg, swtchBhvrCfg_t ftBhvrCfg, lsSwtchSwCfg_t lsSwtchWrkngCnfg)
 :_lftHndInpCfg{lftHndInpCfg}, _lftHndBhvrCfg{lftHndBhvrCfg}, _rghtHndInpCfg{rghtHndInpCfg}, _rghtHndBhvrCfg{rghtHndBhvrCfg}, _ftInpCfg{ftInpCfg}, _ftBhvrCfg{ftBhvrCfg}
 {
-   // Build underlying DbncdMPBttn objects and pointers
+   // Build underlying DbncdMPBttn objects and pointers, in place inside the object buffers for the static allocation build
+#if _lsSwtchStcAlloc
+   _undrlLftHndMPBPtr = new (_undrlLftHndMPBBuf) TmVdblMPBttn(_lftHndInpCfg.inptPin, _lftHndBhvrCfg.swtchVdTm, _lftHndInpCfg.pulledUp, _lftHndInpCfg.typeNO, _lftHndInpCfg.dbncTime, _lftHndBhvrCfg.swtchStrtDlyTm, true);
+   _undrlRghtHndMPBPtr = new (_undrlRghtHndMPBBuf) TmVdblMPBttn (_rghtHndInpCfg.inptPin, _rghtHndBhvrCfg.swtchVdTm, _rghtHndInpCfg.pulledUp, _rghtHndInpCfg.typeNO, _rghtHndInpCfg.dbncTime, _rghtHndBhvrCfg.swtchStrtDlyTm, true);
+   _undrlFtMPBPtr = new (_undrlFtMPBBuf) SnglSrvcVdblMPBttn(_ftInpCfg.inptPin, _ftInpCfg.pulledUp, _ftInpCfg.typeNO, _ftInpCfg.dbncTime, _ftBhvrCfg.swtchStrtDlyTm);
+#else
    _undrlLftHndMPBPtr = new TmVdblMPBttn(_lftHndInpCfg.inptPin, _lftHndBhvrCfg.swtchVdTm, _lftHndInpCfg.pulledUp, _lftHndInpCfg.typeNO, _lftHndInpCfg.dbncTime, _lftHndBhvrCfg.swtchStrtDlyTm, true);
    _undrlRghtHndMPBPtr = new TmVdblMPBttn (_rghtHndInpCfg.inptPin, _rghtHndBhvrCfg.swtchVdTm, _rghtHndInpCfg.pulledUp, _rghtHndInpCfg.typeNO, _rghtHndInpCfg.dbncTime, _rghtHndBhvrCfg.swtchStrtDlyTm, true);
    _undrlFtMPBPtr = new SnglSrvcVdblMPBttn(_ftInpCfg.inptPin, _ftInpCfg.pulledUp, _ftInpCfg.typeNO, _ftInpCfg.dbncTime, _ftBhvrCfg.swtchStrtDlyTm);
+#endif
    
    // Configure underlying DbncdMPBttn objects and pointers  
    // Left Hand TmVdblMPBttn   
@@ -54,65 +75,290 @@ LimbsSftyLnFSwtch::LimbsSftyLnFSwtch(swtchInptHwCfg_t lftHndInpCfg, swtchBhvrCfg
       _undrlRghtHndMPBPtr->setBeginDisabled(true);
    // Foot SnglSrvcVdblMPBttn   
    _undrlRghtHndMPBPtr->setBeginDisabled(true);
-   _undrlFtMPBPtr-> setFnWhnTrnOnPtr(_setLtchRlsPndng); 
+   _undrlFtMPBPtr->setFVPPWhnTrnOn(_ftSwtchTrnOnCb, this);  // The latch release pending flag is kept by each object
+
+   // Configure the underlying switches behavior model to reflect the instantiated objects
+   _undrlSwtchsMdl[lftHndInptId].isEnbld = _lftHndBhvrCfg.swtchIsEnbld;
+   _undrlSwtchsMdl[lftHndInptId].isOnDsbld = true;
+   _undrlSwtchsMdl[rghtHndInptId].isEnbld = _rghtHndBhvrCfg.swtchIsEnbld;
+   _undrlSwtchsMdl[rghtHndInptId].isOnDsbld = true;
+   _undrlSwtchsMdl[ftInptId].isEnbld = false;
+
+   // Configure the input edge interrupts arguments, the pressed level is the opposite of the idle level set by the pull resistor and switch type
+   _inptIsrArg[lftHndInptId] = {this, lftHndInptId, static_cast<uint8_t>(_lftHndInpCfg.inptPin), _lftHndInpCfg.pulledUp != _lftHndInpCfg.typeNO, _lftHndInpCfg.pulledUp};
+   _inptIsrArg[rghtHndInptId] = {this, rghtHndInptId, static_cast<uint8_t>(_rghtHndInpCfg.inptPin), _rghtHndInpCfg.pulledUp != _rghtHndInpCfg.typeNO, _rghtHndInpCfg.pulledUp};
+   _inptIsrArg[ftInptId] = {this, ftInptId, static_cast<uint8_t>(_ftInpCfg.inptPin), _ftInpCfg.pulledUp != _ftInpCfg.typeNO, _ftInpCfg.pulledUp};
 
    // Configure LimbsSftyLnFSwtch attributes
    _ltchRlsTtlTm = lsSwtchWrkngCnfg.ltchRlsActvTm;
    _prdCyclTtlTm = lsSwtchWrkngCnfg.prdCyclActvTm;      
+
+   // Seed the published status with the instantiation status, so the readers never get an unpublished snapshot
+   _getUndrlSwtchStts();
+   _pblshSttsSnpsht(true);
 }
 
 LimbsSftyLnFSwtch::~LimbsSftyLnFSwtch(){
-   _undrlFtMPBPtr->~SnglSrvcVdblMPBttn();
-   _undrlRghtHndMPBPtr->~TmVdblMPBttn();
-   _undrlLftHndMPBPtr->~TmVdblMPBttn();
+   if(_evntDrvn && (_lsSwtchPollTmrHndl != NULL)){
+      for(uint8_t inptId{lftHndInptId}; inptId <= ftInptId; ++inptId)
+         detachInterrupt(_inptIsrArg[inptId].inptPin);
+   }
+   if(_emrgncyStpIsrAttchd)
+      detachInterrupt(_emrgncyStpIsrArg.inptPin);
+   // The timers commands are queued blocking, so the timer service task processes them before the object memory is reused
+   if(_lsSwtchPollTmrHndl != NULL){
+      xTimerStop(_lsSwtchPollTmrHndl, portMAX_DELAY);
+      xTimerDelete(_lsSwtchPollTmrHndl, portMAX_DELAY);
+   }
+   if(_lsSwtchPhsTmrHndl != NULL){
+#if _lsSwtchStcAlloc
+      xTimerStop(_lsSwtchPhsTmrHndl, portMAX_DELAY);
+      xTimerDelete(_lsSwtchPhsTmrHndl, portMAX_DELAY);
+#else
+      esp_timer_stop(_lsSwtchPhsTmrHndl);
+      esp_timer_delete(_lsSwtchPhsTmrHndl);
+#endif
+   }
+   if(_cbDsptchTskHndl != NULL)
+      vTaskDelete(_cbDsptchTskHndl);
+   if(_sttsWtrsEvntGrpHndl != NULL)
+      vEventGroupDelete(_sttsWtrsEvntGrpHndl);
+#if _lsSwtchStcAlloc
+   if(_undrlFtMPBPtr != nullptr){
+      _undrlFtMPBPtr->~SnglSrvcVdblMPBttn();
+      _undrlRghtHndMPBPtr->~TmVdblMPBttn();
+      _undrlLftHndMPBPtr->~TmVdblMPBttn();
+   }
+#else
+   delete _undrlFtMPBPtr;
+   delete _undrlRghtHndMPBPtr;
+   delete _undrlLftHndMPBPtr;
+#endif
 }
 
-void LimbsSftyLnFSwtch::_ackBthHndsOnMssd(){
-   portMUX_TYPE mux portMUX_INITIALIZER_UNLOCKED;
-   
-      //---------------->> Tasks related actions
-      if(getTskToNtfyBthHndsOnMssd() != NULL){
-         xReturned = xTaskNotify(
-            getTskToNtfyBthHndsOnMssd(),	// TaskHandle_t of the task receiving notification
-            static_cast<uint32_t>(0x00),
-            eSetValueWithOverwrite	// In this specific case using eSetBits is also a valid option
-         );
-         if (xReturned != pdPASS)
-            errorFlag = pdTRUE;
+bool LimbsSftyLnFSwtch::addEdgsSbscrbr(const TaskHandle_t &sbscrbrTsk, const uint32_t &edgsMsk){
+   bool result{false};
+   uint8_t sbscrbrIdx{_ntfySbscrbrsQty};
+
+   if((sbscrbrTsk != NULL) && ((edgsMsk & lsSwtchEdgsMsk) != 0)){
+      taskENTER_CRITICAL(&_lsSwtchMux);
+      if(_edgsSbscrbrsQty < _maxEdgsSbscrbrsQty){
+         sbscrbrIdx = _getNtfySbscrbr(sbscrbrTsk, true);
+         if((sbscrbrIdx < _ntfySbscrbrsQty) && (_ntfySbscrbr[sbscrbrIdx].edgsMsk == 0)){
+            _ntfySbscrbr[sbscrbrIdx].edgsMsk = edgsMsk & lsSwtchEdgsMsk;
+            _updNtfySbscrbr(sbscrbrIdx);
+            ++_edgsSbscrbrsQty;
+            result = true;
+         }
+      }
+      taskEXIT_CRITICAL(&_lsSwtchMux);
+   }
+
+   return result;
+}
+
+bool LimbsSftyLnFSwtch::addSttsSbscrbr(const TaskHandle_t &sbscrbrTsk, const uint32_t &rsngEdgsMsk, const uint32_t &fllngEdgsMsk){
+   bool result{false};
+   uint8_t sbscrbrIdx{_ntfySbscrbrsQty};
+
+   if((sbscrbrTsk != NULL) && (((rsngEdgsMsk | fllngEdgsMsk) & lsSwtchOtptsSttsMsk) != 0)){
+      taskENTER_CRITICAL(&_lsSwtchMux);
+      if(_sttsSbscrbrsQty < _maxSttsSbscrbrsQty){
+         sbscrbrIdx = _getNtfySbscrbr(sbscrbrTsk, true);
+         if((sbscrbrIdx < _ntfySbscrbrsQty) && ((_ntfySbscrbr[sbscrbrIdx].rsngEdgsMsk | _ntfySbscrbr[sbscrbrIdx].fllngEdgsMsk) == 0)){
+            _ntfySbscrbr[sbscrbrIdx].rsngEdgsMsk = rsngEdgsMsk & lsSwtchOtptsSttsMsk;
+            _ntfySbscrbr[sbscrbrIdx].fllngEdgsMsk = fllngEdgsMsk & lsSwtchOtptsSttsMsk;
+            _updNtfySbscrbr(sbscrbrIdx);
+            ++_sttsSbscrbrsQty;
+            result = true;
+         }
       }
-		//---------------->> Functions related actions
-		if(_fnWhnBthHndsOnMssd != nullptr)
-			_fnWhnBthHndsOnMssd(_fnWhnBthHndsOnMssdArg);
-	   //---------------->> Flags related actions
+      taskEXIT_CRITICAL(&_lsSwtchMux);
+   }
+
+   return result;
+}
+
+void LimbsSftyLnFSwtch::_ackBthHndsOnMssd(){
+   ++_prdBthHndsMssdQty;
+   // Tasks notification and function execution deferred until the object lock is released
+   _pndngActns |= actnBthHndsOnMssd;
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_addPrdSmpls(const prdSmpls_t &prdSmpls){
+   // The floating point summaries updates run outside the object lock, the times are added in milliseconds
+   taskENTER_CRITICAL(&_prdSttstcsMux);
+   if(prdSmpls.cyclPrdVld)
+      _prdCyclPrdSttstc.addSmpl(static_cast<float>(prdSmpls.cyclPrdUs) / 1000.0);
+   if(prdSmpls.idleTmVld)
+      _prdIdleTmSttstc.addSmpl(static_cast<float>(prdSmpls.idleTmUs) / 1000.0);
+   _prdRctnTmSttstc.addSmpl(static_cast<float>(prdSmpls.rctnTmUs) / 1000.0);
+   taskEXIT_CRITICAL(&_prdSttstcsMux);
 
    return;
 }
 
+bool LimbsSftyLnFSwtch::_attchInptIsrs(){
+   bool result{true};
+
+   for(uint8_t inptId{lftHndInptId}; inptId <= ftInptId; ++inptId){
+      if(_inptIsrArg[inptId].inptPin > _maxValidPinNum)
+         result = false;
+   }
+   if(result){
+      // Seed the inputs levels, the debouncing process starts from the present levels as the DbncdMPBttn objects do when started
+      _updCurTimeMs();
+      _rdUndrlSwtchsInpts();
+      for(uint8_t inptId{lftHndInptId}; inptId <= ftInptId; ++inptId)
+         attachInterruptArg(_inptIsrArg[inptId].inptPin, _inptIsr, &_inptIsrArg[inptId], CHANGE);
+   }
+
+   return result;
+}
+
+bool LimbsSftyLnFSwtch::_bgnCbDsptchTsk(){
+   bool result{true};
+
+   if(_cbDsptchd && !_cbDsptchTskHndl){
+#if _lsSwtchStcAlloc
+      _cbDsptchTskHndl = xTaskCreateStaticPinnedToCore(
+         lsSwtchCbDsptchTsk,  // Callback function/task to be called
+         _cbDsptchTskName,  // Name of the task
+         _cbDsptchTskStckSz,   // Stack size, the user callback functions are executed in this stack
+         this,  // The data passed as parameter to the task function is this same object
+         _cbDsptchTskCnfg.lsSwExecTskPrrtyCnfg, // Priority level given to the task
+         _cbDsptchTskStck, // Task stack, held by the object
+         &_cbDsptchTskBuf, // Task control block, held by the object
+         _cbDsptchTskCnfg.lsSwExecTskCore // Run in the configured core if it's a dual core mcu (ESP-FreeRTOS specific)
+      );
+      if(_cbDsptchTskHndl == NULL)
+         result = false;
+#else
+      if(xTaskCreatePinnedToCore(
+         lsSwtchCbDsptchTsk,  // Callback function/task to be called
+         _cbDsptchTskName,  // Name of the task
+         _cbDsptchTskStckSz,   // Stack size, the user callback functions are executed in this stack
+         this,  // The data passed as parameter to the task function is this same object
+         _cbDsptchTskCnfg.lsSwExecTskPrrtyCnfg, // Priority level given to the task
+         &_cbDsptchTskHndl, // Task handle
+         _cbDsptchTskCnfg.lsSwExecTskCore // Run in the configured core if it's a dual core mcu (ESP-FreeRTOS specific)
+      ) != pdPASS){
+         _cbDsptchTskHndl = NULL;
+         result = false;
+      }
+#endif
+   }
+
+   return result;
+}
+
+bool LimbsSftyLnFSwtch::_bgnEmrgncyStpInpt(){
+   if((_emrgncyStpIsrArg.lsSwtchObj != nullptr) && !_emrgncyStpIsrAttchd){
+      pinMode(_emrgncyStpIsrArg.inptPin, (_emrgncyStpIsrArg.pulledUp)?INPUT_PULLUP:INPUT);
+      attachInterruptArg(_emrgncyStpIsrArg.inptPin, _emrgncyStpIsr, &_emrgncyStpIsrArg, CHANGE);
+      _emrgncyStpIsrAttchd = true;
+      // An emergency stop input already active when starting is not an edge: the object starts stopped
+      _emrgncyStpInptActv = (digitalRead(_emrgncyStpIsrArg.inptPin) == HIGH) == _emrgncyStpIsrArg.prssdLvl;
+      if(_emrgncyStpInptActv){
+         taskENTER_CRITICAL(&_lsSwtchMux);
+         _rqstEmrgncyStp(false);
+         taskEXIT_CRITICAL(&_lsSwtchMux);
+      }
+   }
+
+   return true;
+}
+
+bool LimbsSftyLnFSwtch::_bgnSttsWtrs(){
+   bool result{true};
+
+   if(!_sttsWtrsEvntGrpHndl){
+#if _lsSwtchStcAlloc
+      _sttsWtrsEvntGrpHndl = xEventGroupCreateStatic(&_sttsWtrsEvntGrpBuf);
+#else
+      _sttsWtrsEvntGrpHndl = xEventGroupCreate();
+#endif
+      if(_sttsWtrsEvntGrpHndl == NULL)
+         result = false;
+   }
+
+   return result;
+}
+
 bool LimbsSftyLnFSwtch::begin(unsigned long int pollDelayMs){
    bool result {false};
 	BaseType_t tmrModResult {pdFAIL};
 
-	if (pollDelayMs >= _undrlSwtchsPollDelay){      
-      result = _undrlLftHndMPBPtr->begin(_undrlSwtchsPollDelay);   // Set the underlying left hand MPBttns to start updating it's input readings & output states
-      if(result){
-         result = _undrlRghtHndMPBPtr->begin(_undrlSwtchsPollDelay);  // Set the underlying right hand MPBttns to start updating it's input readings & output states
+	if ((pollDelayMs >= _undrlSwtchsPollDelay) && !_lsSwtchGrpd){      
+      if(_evntDrvn){
+         // The underlying switches are computed by the behavior model from the GPIO edge interrupts, the DbncdMPBttn subclasses objects are not started
+         result = _attchInptIsrs();
+      }
+      else{
+         result = _undrlLftHndMPBPtr->begin(_undrlSwtchsPollDelay);   // Set the underlying left hand MPBttns to start updating it's input readings & output states
          if(result){
-            result = _undrlFtMPBPtr->begin(_undrlSwtchsPollDelay); // Set the underlying foot MPBttns to start updating it's input readings & output states
-            if(result){
-               if (!_lsSwtchPollTmrHndl){        
-                  _lsSwtchPollTmrHndl = xTimerCreate(
-                     _swtchPollTmrName.c_str(),  // Timer name
-                     pdMS_TO_TICKS(pollDelayMs),  // Timer period in ticks
-                     pdTRUE,     // Auto-reload true
-                     this,       // TimerID: the data passed as parameter to the callback function is this same object
-                     lsSwtchPollCb	  //Callback function
-                  );
-                  if (_lsSwtchPollTmrHndl != NULL){
-                     tmrModResult = xTimerStart(_lsSwtchPollTmrHndl, portMAX_DELAY);
-                     if (tmrModResult == pdPASS)
-                        result = true;
-                  }
-               }
+            result = _undrlRghtHndMPBPtr->begin(_undrlSwtchsPollDelay);  // Set the underlying right hand MPBttns to start updating it's input readings & output states
+            if(result)
+               result = _undrlFtMPBPtr->begin(_undrlSwtchsPollDelay); // Set the underlying foot MPBttns to start updating it's input readings & output states
+         }
+      }
+      if(result && _phsTmrDrvn && !_lsSwtchPhsTmrHndl){
+#if _lsSwtchStcAlloc
+         _lsSwtchPhsTmrHndl = xTimerCreateStatic(
+            _swtchPhsTmrName,  // Timer name
+            1,          // Timer period in ticks, set to the time left to the phase deadline each time it's armed
+            pdFALSE,    // Auto-reload false
+            this,       // TimerID: the data passed as parameter to the callback function is this same object
+            lsSwtchPhsTmrCb,	  //Callback function
+            &_lsSwtchPhsTmrBuf   // Timer control block, held by the object
+         );
+#else
+         const esp_timer_create_args_t phsTmrArgs{
+            .callback = lsSwtchPhsTmrCb,  // Callback function
+            .arg = this,   // The data passed as parameter to the callback function is this same object
+            .dispatch_method = ESP_TIMER_TASK,
+            .name = _swtchPhsTmrName,  // Timer name
+            .skip_unhandled_events = false
+         };  // Armed one-shot with the time left to the phase deadline, in microseconds
+         if(esp_timer_create(&phsTmrArgs, &_lsSwtchPhsTmrHndl) != ESP_OK)
+            _lsSwtchPhsTmrHndl = NULL;
+#endif
+         if(_lsSwtchPhsTmrHndl == NULL)
+            result = false;
+      }
+      if(result)
+         result = _bgnCbDsptchTsk();
+      if(result)
+         result = _bgnSttsWtrs();
+      if(result)
+         result = _bgnEmrgncyStpInpt();
+      if(result){
+         if (!_lsSwtchPollTmrHndl){        
+#if _lsSwtchStcAlloc
+            _lsSwtchPollTmrHndl = xTimerCreateStatic(
+               _swtchPollTmrName,  // Timer name
+               pdMS_TO_TICKS(pollDelayMs),  // Timer period in ticks
+               pdTRUE,     // Auto-reload true
+               this,       // TimerID: the data passed as parameter to the callback function is this same object
+               lsSwtchPollCb,	  //Callback function
+               &_lsSwtchPollTmrBuf   // Timer control block, held by the object
+            );
+#else
+            _lsSwtchPollTmrHndl = xTimerCreate(
+               _swtchPollTmrName,  // Timer name
+               pdMS_TO_TICKS(pollDelayMs),  // Timer period in ticks
+               pdTRUE,     // Auto-reload true
+               this,       // TimerID: the data passed as parameter to the callback function is this same object
+               lsSwtchPollCb	  //Callback function
+            );
+#endif
+            if (_lsSwtchPollTmrHndl != NULL){
+               // In the event driven mode the timer is started to execute the FDA start state entry code, the first update will stop it if no time is pending
+               tmrModResult = xTimerStart(_lsSwtchPollTmrHndl, portMAX_DELAY);
+               if (tmrModResult == pdPASS)
+                  result = true;
             }
          }
       }
@@ -124,19 +370,13 @@ bool LimbsSftyLnFSwtch::begin(unsigned long int pollDelayMs){
 void LimbsSftyLnFSwtch::clrStatus(){
    _ltchRlsIsOn = false;
    _prdCyclIsOn = false;
-   _prdCyclTmrStrt = 0;
-   _undrlFtMPBPtr->disable(); // Disable FtSwitch
+   _prdCyclTmrStrtUs = 0;
+   _setUndrlSwtchEnbld(ftInptId, false); // Disable FtSwitch
 
-   _undrlLftHndMPBPtr->setIsOnDisabled(true);
-   if(_lftHndBhvrCfg.swtchIsEnbld)
-      _undrlLftHndMPBPtr->enable();
-   else
-      _undrlLftHndMPBPtr->disable();
-   _undrlRghtHndMPBPtr->setIsOnDisabled(true);
-   if(_rghtHndBhvrCfg.swtchIsEnbld)
-      _undrlRghtHndMPBPtr->enable();
-   else
-      _undrlRghtHndMPBPtr->disable();
+   _setUndrlSwtchIsOnDsbld(lftHndInptId, true);
+   _setUndrlSwtchEnbld(lftHndInptId, _lftHndBhvrCfg.swtchIsEnbld);
+   _setUndrlSwtchIsOnDsbld(rghtHndInptId, true);
+   _setUndrlSwtchEnbld(rghtHndInptId, _rghtHndBhvrCfg.swtchIsEnbld);
 
    return;
 }
@@ -163,10 +403,7 @@ bool LimbsSftyLnFSwtch::_cnfgHndSwtch(const bool &isLeft, const swtchBhvrCfg_t &
    }
    
    if((isLeft?_undrlLftHndMPBPtr:_undrlRghtHndMPBPtr)->getIsEnabled() != newCfg.swtchIsEnbld){
-      if(newCfg.swtchIsEnbld)
-         (isLeft?_undrlLftHndMPBPtr:_undrlRghtHndMPBPtr)->enable();
-      else
-         (isLeft?_undrlLftHndMPBPtr:_undrlRghtHndMPBPtr)->disable();
+      _setUndrlSwtchEnbld((isLeft?lftHndInptId:rghtHndInptId), newCfg.swtchIsEnbld);
       
       (isLeft?_lftHndBhvrCfg:_rghtHndBhvrCfg).swtchIsEnbld = newCfg.swtchIsEnbld;
    }
@@ -190,6 +427,245 @@ bool LimbsSftyLnFSwtch::cnfgRghtHndSwtch(const swtchBhvrCfg_t &newCfg){
    return _cnfgHndSwtch(false, newCfg);
 }
 
+bool LimbsSftyLnFSwtch::_deqCb(lsSwtchCbEvnt_t &cbEvnt, uint32_t &queDpth){
+   bool result{false};
+   uint32_t queTl{_cbDsptchQueTl.load(std::memory_order_relaxed)};
+   uint32_t queHd{_cbDsptchQueHd.load(std::memory_order_acquire)};
+
+   // Single consumer: the callback dispatch task is the only one advancing the queue tail
+   if(queHd != queTl){
+      cbEvnt = _cbDsptchQue[queTl & (_cbDsptchQueSz - 1)];
+      queDpth = queHd - queTl;
+      _cbDsptchQueTl.store(queTl + 1, std::memory_order_release);
+      result = true;
+   }
+
+   return result;
+}
+
+void LimbsSftyLnFSwtch::_emrgncyStpCb(void* lsSwtchObjArg, uint32_t ulParameter2){
+   LimbsSftyLnFSwtch* lsSwtchObj = static_cast<LimbsSftyLnFSwtch*>(lsSwtchObjArg);
+#if _lsSwtchPrfInstr
+   uint32_t prfStgTcks[_prfStgsQty]{};
+   const uint32_t prfUpdStrtTcks{_getPrfTcks()};
+   uint32_t prfLapStrtTcks{prfUpdStrtTcks};
+   fdaStpPrf_t prfFdaStp{};
+#endif
+
+   // Executed by the timer service task: only the emergency stop FDA entry and the status publication, independent of the object's update mode and period
+   lsSwtchObj->_updCurTimeMs();
+   _lsSwtchPrfLap(curTmPrfStgId);
+   taskENTER_CRITICAL(&lsSwtchObj->_lsSwtchMux);
+#if _lsSwtchPrfInstr
+   const uint32_t prfLckStrtTcks{_getPrfTcks()};
+   prfLapStrtTcks = prfLckStrtTcks;
+   prfFdaStp.frmStt = static_cast<uint8_t>(lsSwtchObj->_lsSwtchFdaState);
+#endif
+   lsSwtchObj->_entrEmrgncyStp();
+#if _lsSwtchPrfInstr
+   prfFdaStp.toStt = static_cast<uint8_t>(lsSwtchObj->_lsSwtchFdaState);
+   prfFdaStp.tcks = _getPrfTcks() - prfLapStrtTcks;
+#endif
+   _lsSwtchPrfLap(fdaPrfStgId);
+   lsSwtchObj->_getUndrlSwtchStts();
+   _lsSwtchPrfLap(undrlSwtchsPrfStgId);
+   lsSwtchObj->_pblshSttsSnpsht();
+   _lsSwtchPrfLap(sttsPblshPrfStgId);
+#if _lsSwtchPrfInstr
+   prfStgTcks[lckHldPrfStgId] = prfLapStrtTcks - prfLckStrtTcks;
+#endif
+   taskEXIT_CRITICAL(&lsSwtchObj->_lsSwtchMux);
+   lsSwtchObj->_exctPndngActns();
+   if(lsSwtchObj->_phsTmrDrvn)
+      lsSwtchObj->_updPhsTmrStt();
+   if(lsSwtchObj->_evntDrvn || lsSwtchObj->_phsTmrDrvn)
+      lsSwtchObj->_updPollTmrStt();
+   _lsSwtchPrfLap(ntfctnPrfStgId);
+#if _lsSwtchPrfInstr
+   prfStgTcks[updTtlPrfStgId] = prfLapStrtTcks - prfUpdStrtTcks;
+   lsSwtchObj->_rcrdPrfSmpls(prfStgTcks, prfFdaStp.frmStt, &prfFdaStp, 1);
+#endif
+
+   return;
+}
+
+void IRAM_ATTR LimbsSftyLnFSwtch::_emrgncyStpIsr(void* isrArgPtr){
+   lsSwtchInptIsrArg_t* isrArg = static_cast<lsSwtchInptIsrArg_t*>(isrArgPtr);
+   LimbsSftyLnFSwtch* lsSwtchObj = isrArg->lsSwtchObj;
+   BaseType_t hghrPrtyTskWkn{pdFALSE};
+
+   lsSwtchObj->_emrgncyStpInptActv = (_rdInptPinLvl(isrArg->inptPin) == isrArg->prssdLvl);
+   if(lsSwtchObj->_emrgncyStpInptActv){
+      // The output pins are set inactive from the ISR, the lock wait is bounded by the longest object lock hold time
+      taskENTER_CRITICAL_ISR(&lsSwtchObj->_lsSwtchMux);
+      lsSwtchObj->_rqstEmrgncyStp(true);
+      taskEXIT_CRITICAL_ISR(&lsSwtchObj->_lsSwtchMux);
+      // If the deferred call can't be queued the pending request is served by the next object update
+      xTimerPendFunctionCallFromISR(_emrgncyStpCb, lsSwtchObj, 0, &hghrPrtyTskWkn);
+      portYIELD_FROM_ISR(hghrPrtyTskWkn);
+   }
+
+   return;
+}
+
+bool LimbsSftyLnFSwtch::_enqCb(fncVdPtrPrmPtrType fnToExct, void* fnToExctArg, const bool &isTrnOff){
+   bool result{false};
+   uint32_t queHd{_cbDsptchQueHd.load(std::memory_order_relaxed)};
+
+   // Single producer: the object's update code, executed by the timer service task, is the only one advancing the queue head. The last entries are kept for the turn off requests
+   if((queHd - _cbDsptchQueTl.load(std::memory_order_acquire)) < (isTrnOff?_cbDsptchQueSz:(_cbDsptchQueSz - _cbDsptchRsrvdEntrs))){
+      _cbDsptchQue[queHd & (_cbDsptchQueSz - 1)] = {fnToExct, fnToExctArg, esp_timer_get_time()};
+      _cbDsptchQueHd.store(queHd + 1, std::memory_order_release);
+      result = true;
+   }
+
+   return result;
+}
+
+void LimbsSftyLnFSwtch::_entrEmrgncyStp(){
+   int64_t fdaEntryTmUs{0};
+
+   // Executed holding the object lock, by the deferred emergency stop call or by the FDA update, whichever comes first
+   if(_emrgncyStpPndng){
+      _emrgncyStpPndng = false;
+      if(_lsSwtchFdaState != stEmrgncyExcpHndl){
+         _turnOffLtchRls();
+         _turnOffPrdCycl();
+         _ltchRlsPndng = false;
+         _setUndrlSwtchEnbld(ftInptId, false); // Disable FtSwitch
+         _lsSwtchFdaState = stEmrgncyExcpHndl;
+         _setSttChng();
+         _emrgncyStpEntryTmUs = esp_timer_get_time();
+         fdaEntryTmUs = _emrgncyStpEntryTmUs - _emrgncyStpRqstTmUs;
+         ++_emrgncyStpStts.emrgncyStpQty;
+         _emrgncyStpStts.lstFdaEntryTmUs = static_cast<uint32_t>(fdaEntryTmUs);
+         if(_emrgncyStpStts.maxFdaEntryTmUs < _emrgncyStpStts.lstFdaEntryTmUs)
+            _emrgncyStpStts.maxFdaEntryTmUs = _emrgncyStpStts.lstFdaEntryTmUs;
+      }
+      _updOtptPins();
+   }
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_exctActn(fncVdPtrPrmPtrType fnToExct, void* fnToExctArg, const bool &isTrnOff){
+   //---------------->> Functions related actions
+   if(fnToExct != nullptr){
+      if(_cbDsptchTskHndl != NULL){
+         // The timer service task must never be blocked: a request finding the queue full stops the object, a turn off function is executed here instead of being dropped
+         if(!_enqCb(fnToExct, fnToExctArg, isTrnOff)){
+            taskENTER_CRITICAL(&_lsSwtchMux);
+            ++_cbDsptchStts.ovrflwQty;
+            taskEXIT_CRITICAL(&_lsSwtchMux);
+            trgrEmrgncyStp();
+            if(isTrnOff)
+               fnToExct(fnToExctArg);
+         }
+         xTaskNotifyGive(_cbDsptchTskHndl);
+      }
+      else
+         fnToExct(fnToExctArg);
+   }
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_exctPndngActns(){
+   uint8_t pndngActns{0};
+   uint8_t sttsWtrsToWk{0};
+   uint16_t sttsSbscrbrsToNtfy{0};
+   uint32_t sttsSbscrbrsOtptsSttsPkgd{0};
+   uint32_t sbscrbrSlts{0};
+   uint8_t sbscrbrIdx{0};
+   uint32_t sbscrbrEdgs{0};
+   TaskHandle_t ntfyTsk[_ntfySbscrbrsQty]{};
+   uint32_t ntfyVal[_ntfySbscrbrsQty]{};
+   eNotifyAction ntfyActn[_ntfySbscrbrsQty]{};
+   uint8_t ntfysQty{0};
+   prdSmpls_t prdSmpls{};
+
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   pndngActns = _pndngActns;
+   _pndngActns = 0;
+   if(_prdSmpls.pndng){
+      prdSmpls = _prdSmpls;
+      _prdSmpls = {};
+   }
+   sttsWtrsToWk = _sttsWtrsToWk;
+   _sttsWtrsToWk = 0;
+   sttsSbscrbrsToNtfy = _sttsSbscrbrsToNtfy;
+   _sttsSbscrbrsToNtfy = 0;
+   // The value published with the subscribers set, a later update can't publish a value whose edges didn't select them
+   if(sttsSbscrbrsToNtfy != 0)
+      sttsSbscrbrsOtptsSttsPkgd = _sttsSnpshtPkgd.load(std::memory_order_relaxed);
+   // A single pass over the used subscribers table entries, the notifications are issued after releasing the lock. The packed status value overwrites the edges bits of the same update
+   sbscrbrSlts = ((pndngActns != 0) || (sttsSbscrbrsToNtfy != 0))?_ntfySbscrbrSlts:0;
+   while(sbscrbrSlts != 0){
+      sbscrbrIdx = static_cast<uint8_t>(__builtin_ctz(sbscrbrSlts));
+      sbscrbrEdgs = pndngActns & (_ntfySbscrbr[sbscrbrIdx].edgsMsk | (_ntfySbscrbr[sbscrbrIdx].lgcyEdgsMsk & ~lsSwtchOtptsChngEdgBit));
+      if(sttsSbscrbrsToNtfy & (1 << sbscrbrIdx)){
+         ntfyTsk[ntfysQty] = _ntfySbscrbr[sbscrbrIdx].sbscrbrTsk;
+         ntfyVal[ntfysQty] = sttsSbscrbrsOtptsSttsPkgd;
+         ntfyActn[ntfysQty++] = eSetValueWithOverwrite;
+      }
+      else if(sbscrbrEdgs != 0){
+         ntfyTsk[ntfysQty] = _ntfySbscrbr[sbscrbrIdx].sbscrbrTsk;
+         ntfyVal[ntfysQty] = sbscrbrEdgs;
+         ntfyActn[ntfysQty++] = eSetBits;
+      }
+      sbscrbrSlts &= sbscrbrSlts - 1;
+   }
+   taskEXIT_CRITICAL(&_lsSwtchMux);
+
+   // The production statistics are updated before any task is woken, so the woken tasks read summaries including the cycle just started
+   if(prdSmpls.pndng)
+      _addPrdSmpls(prdSmpls);
+   // Tasks blocked in wtLsSwtchOtptsChng() are unblocked first, a bit for each waiter slot
+   if((sttsWtrsToWk != 0) && (_sttsWtrsEvntGrpHndl != NULL))
+      xEventGroupSetBits(_sttsWtrsEvntGrpHndl, static_cast<EventBits_t>(sttsWtrsToWk));
+
+   // Executed in the order the FDA produces them
+   if(pndngActns & actnBthHndsOnMssd)
+      _exctActn(_fnWhnBthHndsOnMssd, _fnWhnBthHndsOnMssdArg, false);
+   if(pndngActns & actnTrnOnLtchRls)
+      _exctActn(_fnWhnTrnOnLtchRls, _fnWhnTrnOnLtchRlsArg, false);
+   if(pndngActns & actnTrnOnPrdCycl)
+      _exctActn(_fnWhnTrnOnPrdCycl, _fnWhnTrnOnPrdCyclArg, false);
+   if(pndngActns & actnTrnOffLtchRls)
+      _exctActn(_fnWhnTrnOffLtchRls, _fnWhnTrnOffLtchRlsArg, true);
+   if(pndngActns & actnTrnOffPrdCycl)
+      _exctActn(_fnWhnTrnOffPrdCycl, _fnWhnTrnOffPrdCyclArg, true);
+   // Batched notification: all the edges of the update in a single notification for each task, the pending actions bits are the edges bits
+   static_assert((actnBthHndsOnMssd == bthHndsOnMssdEdgBit) && (actnTrnOnLtchRls == ltchRlsTrnOnEdgBit) && (actnTrnOnPrdCycl == prdCyclTrnOnEdgBit) &&
+      (actnTrnOffLtchRls == ltchRlsTrnOffEdgBit) && (actnTrnOffPrdCycl == prdCyclTrnOffEdgBit) && (actnOtptsChng == lsSwtchOtptsChngEdgBit), "Pending actions and edges notification bits mismatch");
+   for(uint8_t ntfyIdx{0}; ntfyIdx < ntfysQty; ++ntfyIdx)
+      xTaskNotify(ntfyTsk[ntfyIdx], ntfyVal[ntfyIdx], ntfyActn[ntfyIdx]);
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_ftSwtchTrnOnCb(void* lsSwtchObjArg){
+   static_cast<LimbsSftyLnFSwtch*>(lsSwtchObjArg)->_setLtchRlsPndng();
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::getCbDsptchStts(lsSwtchCbDsptchStts_t &stts) const{
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   stts = _cbDsptchStts;
+   taskEXIT_CRITICAL(&_lsSwtchMux);
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::getEmrgncyStts(lsSwtchEmrgncyStts_t &stts) const{
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   stts = _emrgncyStpStts;
+   taskEXIT_CRITICAL(&_lsSwtchMux);
+
+   return;
+}
+
 fncVdPtrPrmPtrType LimbsSftyLnFSwtch::getFnWhnTrnOffLtchRlsPtr(){
 
    return _fnWhnTrnOffLtchRls;
@@ -215,6 +691,26 @@ SnglSrvcVdblMPBttn* LimbsSftyLnFSwtch::getFtSwtchPtr(){
    return _undrlFtMPBPtr;
 }
 
+const bool LimbsSftyLnFSwtch::getIsCbDsptchd() const{
+
+   return _cbDsptchd;
+}
+
+const bool LimbsSftyLnFSwtch::getIsEvntDrvn() const{
+
+   return _evntDrvn;
+}
+
+const bool LimbsSftyLnFSwtch::getIsPhsTmrDrvn() const{
+
+   return _phsTmrDrvn;
+}
+
+const bool LimbsSftyLnFSwtch::getIsTrnstnRcrdd() const{
+
+   return _trnstnRcrdd;
+}
+
 TmVdblMPBttn* LimbsSftyLnFSwtch::getLftHndSwtchPtr(){
 
    return _undrlLftHndMPBPtr;
@@ -225,10 +721,58 @@ const bool LimbsSftyLnFSwtch::getLsSwtchOtptsChng() const{
 	return _lsSwtchOtptsChng;
 }
 
+bool LimbsSftyLnFSwtch::getLsSwtchOtptsSttsExtd(uint64_t &otptsSttsExtd) const{
+   bool result{false};
+   uint32_t seqNumStrt{0};
+   uint32_t seqNumEnd{0};
+   uint64_t sttsExtdRd{0};
+
+   for(uint8_t rdTry{0}; (rdTry < _maxSnpshtRdTries) && !result; ++rdTry){
+      seqNumStrt = _sttsSnpshtSeq.load(std::memory_order_acquire);
+      if(!(seqNumStrt & 0x01UL)){ // Odd sequence number: publication in progress
+         sttsExtdRd = static_cast<uint64_t>(_sttsSnpshtPkgd.load(std::memory_order_relaxed) & lsSwtchOtptsSttsMsk) |
+            (static_cast<uint64_t>(_sttsSnpshtFdaStt.load(std::memory_order_relaxed) & 0x07) << lsSwtchExtdFdaSttBP) |
+            (static_cast<uint64_t>(_sttsSnpshtPhsElpsdTm.load(std::memory_order_relaxed)) << lsSwtchExtdPhsElpsdBP) |
+            (static_cast<uint64_t>(_sttsSnpshtPhsRmngTm.load(std::memory_order_relaxed)) << lsSwtchExtdPhsRmngBP);
+         std::atomic_thread_fence(std::memory_order_acquire);
+         seqNumEnd = _sttsSnpshtSeq.load(std::memory_order_relaxed);
+         if(seqNumStrt == seqNumEnd){
+            otptsSttsExtd = sttsExtdRd | (static_cast<uint64_t>((seqNumStrt >> 1) & lsSwtchExtdSeqNumMsk) << lsSwtchExtdSeqNumBP);
+            result = true;
+         }
+      }
+   }
+
+   return result;
+}
+
 uint32_t LimbsSftyLnFSwtch::getLsSwtchOtptsSttsPkgd(){
-   _getUndrlSwtchStts();
    
-   return _lsSwtchOtptsSttsPkgd();
+   return _sttsSnpshtPkgd.load(std::memory_order_acquire);
+}
+
+bool LimbsSftyLnFSwtch::getLsSwtchSttsSnpsht(lsSwtchSttsSnpsht_t &snpsht) const{
+   bool result{false};
+   uint32_t seqNumStrt{0};
+   uint32_t seqNumEnd{0};
+   lsSwtchSttsSnpsht_t snpshtRd{};
+
+   for(uint8_t rdTry{0}; (rdTry < _maxSnpshtRdTries) && !result; ++rdTry){
+      seqNumStrt = _sttsSnpshtSeq.load(std::memory_order_acquire);
+      if(!(seqNumStrt & 0x01UL)){ // Odd sequence number: publication in progress
+         snpshtRd.otptsSttsPkgd = _sttsSnpshtPkgd.load(std::memory_order_relaxed);
+         snpshtRd.sttsTm = _sttsSnpshtTm.load(std::memory_order_relaxed);
+         std::atomic_thread_fence(std::memory_order_acquire);
+         seqNumEnd = _sttsSnpshtSeq.load(std::memory_order_relaxed);
+         if(seqNumStrt == seqNumEnd){
+            snpshtRd.seqNum = seqNumStrt >> 1;
+            snpsht = snpshtRd;
+            result = true;
+         }
+      }
+   }
+
+   return result;
 }
 
 const bool LimbsSftyLnFSwtch::getLtchRlsIsOn() const{
@@ -251,6 +795,56 @@ unsigned long int LimbsSftyLnFSwtch::getPrdCyclTtlTm(){
    return _prdCyclTtlTm;
 }
 
+void LimbsSftyLnFSwtch::getPrdSttstcs(lsSwtchPrdSttstcs_t &sttstcs) const{
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   sttstcs.cyclsQty = _prdCyclsQty;
+   sttstcs.bthHndsMssdQty = _prdBthHndsMssdQty;
+   taskEXIT_CRITICAL(&_lsSwtchMux);
+   taskENTER_CRITICAL(&_prdSttstcsMux);
+   _prdCyclPrdSttstc.getSmmry(sttstcs.cyclPrd);
+   _prdIdleTmSttstc.getSmmry(sttstcs.idleTm);
+   _prdRctnTmSttstc.getSmmry(sttstcs.rctnTm);
+   taskEXIT_CRITICAL(&_prdSttstcsMux);
+   sttstcs.cyclsPerHr = (sttstcs.cyclPrd.mean > 0.0)?(3600000.0 / sttstcs.cyclPrd.mean):0.0;
+
+   return;
+}
+
+bool LimbsSftyLnFSwtch::getPrfHstgrm(const uint8_t &prfStgId, lsSwtchPrfHstgrm_t &hstgrm) const{
+   bool result{false};
+
+#if _lsSwtchPrfInstr
+   if(prfStgId < _prfStgsQty){
+      taskENTER_CRITICAL(&_lsSwtchMux);
+      hstgrm = _prfHstgrm[prfStgId];
+      taskEXIT_CRITICAL(&_lsSwtchMux);
+      result = true;
+   }
+#endif
+
+   return result;
+}
+
+uint32_t LimbsSftyLnFSwtch::_getPrfTcks(){
+#if defined(ARDUINO_ARCH_ESP32)
+   // CPU clock cycles counter of the executing core, a single register read. Wraps around each 2^32 cycles, the durations are computed as unsigned differences
+   return ESP.getCycleCount();
+#else
+   timespec tmSpc{};
+
+   clock_gettime(CLOCK_MONOTONIC, &tmSpc);
+   return static_cast<uint32_t>(static_cast<uint64_t>(tmSpc.tv_sec) * 1000000000ULL + static_cast<uint64_t>(tmSpc.tv_nsec));
+#endif
+}
+
+uint32_t LimbsSftyLnFSwtch::getPrfTcksPerUs(){
+#if defined(ARDUINO_ARCH_ESP32)
+   return ESP.getCpuFreqMHz();
+#else
+   return 1000;
+#endif
+}
+
 TmVdblMPBttn* LimbsSftyLnFSwtch::getRghtHndSwtchPtr(){
 
    return _undrlRghtHndMPBPtr;
@@ -286,688 +880,2239 @@ const TaskHandle_t LimbsSftyLnFSwtch::getTskToNtfyTrnOnPrdCycl() const{
    return _tskToNtfyTrnOnPrdCycl;
 }
 
-void LimbsSftyLnFSwtch::_getUndrlSwtchStts(){   
-   _lftHndSwtchStts = otptsSttsUnpkg(_undrlLftHndMPBPtr->getOtptsSttsPkgd());
-   _rghtHndSwtchStts = otptsSttsUnpkg(_undrlRghtHndMPBPtr->getOtptsSttsPkgd());
-   _ftSwtchStts = otptsSttsUnpkg(_undrlFtMPBPtr->getOtptsSttsPkgd());
+size_t LimbsSftyLnFSwtch::getTrnstnRcrds(lsSwtchTrnstnRcrd_t* rcrds, const size_t &maxRcrdsQty){
+   size_t result{0};
+   uint32_t rngTl{_trnstnRngTl.load(std::memory_order_relaxed)};
+   const uint32_t rngHd{_trnstnRngHd.load(std::memory_order_acquire)};
 
-   return;
-}
+   // Single consumer: the draining task is the only one advancing the ring tail, the entries are freed once for the whole batch
+   while((rngTl != rngHd) && (result < maxRcrdsQty)){
+      rcrds[result] = _trnstnRng[rngTl & (_trnstnRngSz - 1)];
+      ++rngTl;
+      ++result;
+   }
+   if(result > 0)
+      _trnstnRngTl.store(rngTl, std::memory_order_release);
 
-uint32_t LimbsSftyLnFSwtch::_lsSwtchOtptsSttsPkgd(uint32_t prevVal){
-/*
-+--+-+--+--+--++--+--+--+--+--+--+--+--+
-|31|~|10|09|08||07|06|05|04|03|02|01|00|
- ------- -- --  -- -- -- -- -- -- -- --
-       |  |  |   |  |  |  |  |  |  |  |
-       |  |  |   |  |  |  |  |  |  |  lftHndSwtchIsEnbld
-       |  |  |   |  |  |  |  |  |  lftHndSwtchIsOn
-       |  |  |   |  |  |  |  |  lftHndSwtchIsVdd
-       |  |  |   |  |  |  |  rghtHndSwtchIsEnbld
-       |  |  |   |  |  |  rghtHndSwtchIsOn
-       |  |  |   |  |  rghtHndSwtchIsVdd
-       |  |  |   |  ftSwtchIsEnbld
-       |  |  |   ftSwtchIsOn
-       |  |  LsSwtchLtchRlsIsOn
-       |  LsSwtchPrdCyclIsOn
-       N/C
+   return result;
+}
 
-*/   
-   //Underlying DbncdMPBttns' attribute flags state
-	if(_lftHndSwtchStts.isEnabled)
-		prevVal |= ((uint32_t)1) << lftHndSwtchIsEnbldBP;
-	else
-		prevVal &= ~(((uint32_t)1) << lftHndSwtchIsEnbldBP);
-   if(_lftHndSwtchStts.isOn)
-		prevVal |= ((uint32_t)1) << lftHndSwtchIsOnBP;
-	else
-		prevVal &= ~(((uint32_t)1) << lftHndSwtchIsOnBP);
-   if(_lftHndSwtchStts.isVoided)
-		prevVal |= ((uint32_t)1) << lftHndSwtchIsVddBP;
-	else
-		prevVal &= ~(((uint32_t)1) << lftHndSwtchIsVddBP);
+uint32_t LimbsSftyLnFSwtch::getTrnstnRngOvrrnQty() const{
 
-	if(_rghtHndSwtchStts.isEnabled)
-		prevVal |= ((uint32_t)1) << rghtHndSwtchIsEnbldBP;
-	else
-		prevVal &= ~(((uint32_t)1) << rghtHndSwtchIsEnbldBP);
-	if(_rghtHndSwtchStts.isOn)
-		prevVal |= ((uint32_t)1) << rghtHndSwtchIsOnBP;
-	else
-		prevVal &= ~(((uint32_t)1) << rghtHndSwtchIsOnBP);
-	if(_rghtHndSwtchStts.isVoided)
-		prevVal |= ((uint32_t)1) << rghtHndSwtchIsVddBP;
-	else
-		prevVal &= ~(((uint32_t)1) << rghtHndSwtchIsVddBP);
+   return _trnstnRngOvrrnQty.load(std::memory_order_relaxed);
+}
 
-	if(_ftSwtchStts.isEnabled)
-		prevVal |= ((uint32_t)1) << ftSwtchIsEnbldBP;
-	else
-		prevVal &= ~(((uint32_t)1) << ftSwtchIsEnbldBP);
-	if(_ftSwtchStts.isOn)   //! The ftSwtch is a SnglShtMPBttn object, the isOn flag makes no stable signal source!!
-		prevVal |= ((uint32_t)1) << ftSwtchIsOnBP;
-	else
-		prevVal &= ~(((uint32_t)1) << ftSwtchIsOnBP);
+bool LimbsSftyLnFSwtch::getWcetSttRcrd(const uint8_t &fdaStt, lsSwtchWcetRcrd_t &rcrd) const{
+   bool result{false};
 
-   //LimbsSftyLnFSwtch's attribute flags state
-	if(_ltchRlsIsOn)
-		prevVal |= ((uint32_t)1) << LsSwtchLtchRlsIsOnBP;
-	else
-		prevVal &= ~(((uint32_t)1) << LsSwtchLtchRlsIsOnBP);
-	if(_prdCyclIsOn)
-		prevVal |= ((uint32_t)1) << LsSwtchPrdCyclIsOnBP;
-	else
-		prevVal &= ~(((uint32_t)1) << LsSwtchPrdCyclIsOnBP);
+   static_assert(lsSwtchFdaSttsQty == _fdaSttsQty, "lsSwtchFdaSttsQty doesn't match the FDA states quantity");
+#if _lsSwtchPrfInstr
+   if(fdaStt < _fdaSttsQty){
+      taskENTER_CRITICAL(&_lsSwtchMux);
+      rcrd = _wcetStt[fdaStt];
+      taskEXIT_CRITICAL(&_lsSwtchMux);
+      result = true;
+   }
+#endif
 
-   return prevVal;
+   return result;
 }
 
-void LimbsSftyLnFSwtch::lsSwtchPollCb(TimerHandle_t lssTmrCbArg){
-   LimbsSftyLnFSwtch* lsSwtchObj = (LimbsSftyLnFSwtch*)pvTimerGetTimerID(lssTmrCbArg);
-	portMUX_TYPE mux portMUX_INITIALIZER_UNLOCKED;
-
-	taskENTER_CRITICAL(&mux);
-   // Underlying switches status recovery
-   lsSwtchObj->_getUndrlSwtchStts();
-   //------------
-   // Set the time base for Flags, Triggers and Timers calculation & update
- 	lsSwtchObj->_updCurTimeMs();
-   //------------
-	// State machine update
- 	lsSwtchObj->_updFdaState();
- 	taskEXIT_CRITICAL(&mux);
+bool LimbsSftyLnFSwtch::getWcetTrnstnRcrd(const uint8_t &frmStt, const uint8_t &toStt, lsSwtchWcetRcrd_t &rcrd) const{
+   bool result{false};
 
-	//Outputs update, function and tasks executions based on outputs changed generated by the State Machine
-      //---------------->> Tasks related actions
-      //---------------->> Generic Task for output changes related actions
-	if (lsSwtchObj->getLsSwtchOtptsChng()){
-		if(lsSwtchObj->getTskToNtfyLsSwtchOtptsChng() != NULL){
-			xReturned = xTaskNotify(
-				lsSwtchObj->getTskToNtfyLsSwtchOtptsChng(),	// TaskHandle_t of the task receiving notification
-				static_cast<uint32_t>(lsSwtchObj->getLsSwtchOtptsSttsPkgd()),
-				eSetValueWithOverwrite
-			);
-			lsSwtchObj->setLsSwtchOtptsChng(false);
-		}
-	}     
+#if _lsSwtchPrfInstr
+   if((frmStt < _fdaSttsQty) && (toStt < _fdaSttsQty)){
+      taskENTER_CRITICAL(&_lsSwtchMux);
+      rcrd = _wcetTrnstn[frmStt][toStt];
+      taskEXIT_CRITICAL(&_lsSwtchMux);
+      result = true;
+   }
+#endif
 
-	return;
+   return result;
 }
 
-void LimbsSftyLnFSwtch::resetFda(){
-   portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+DbncdMPBttn* LimbsSftyLnFSwtch::_getUndrlSwtchPtr(const uint8_t &inptId){
+   DbncdMPBttn* result{nullptr};
 
-	taskENTER_CRITICAL(&mux);
-	clrStatus();
-	_setSttChng();
-	_lsSwtchFdaState = stOffNotBHP;
-	taskEXIT_CRITICAL(&mux);
+   if(inptId == lftHndInptId)
+      result = _undrlLftHndMPBPtr;
+   else if(inptId == rghtHndInptId)
+      result = _undrlRghtHndMPBPtr;
+   else if(inptId == ftInptId)
+      result = _undrlFtMPBPtr;
 
-   return;
+   return result;
 }
 
-void LimbsSftyLnFSwtch::_rstOtptsChngCnt(){
-   _lsSwtchOtptsChngCnt = 0;
+uint8_t LimbsSftyLnFSwtch::_getNtfySbscrbr(const TaskHandle_t &sbscrbrTsk, const bool &alloc){
+   static_assert(_ntfySbscrbrsQty <= 16, "_ntfySbscrbrsQty exceeds the subscribers slots bitmap size");
+   uint8_t result{_ntfySbscrbrsQty};
+   uint32_t sbscrbrSlts{_ntfySbscrbrSlts};
+   uint32_t freeSlts{0};
+
+   // Executed holding the object lock. Each task has a single entry, the subscriptions limits keep a free entry for every task not yet in the table
+   while((sbscrbrSlts != 0) && (result == _ntfySbscrbrsQty)){
+      if(_ntfySbscrbr[__builtin_ctz(sbscrbrSlts)].sbscrbrTsk == sbscrbrTsk)
+         result = static_cast<uint8_t>(__builtin_ctz(sbscrbrSlts));
+      sbscrbrSlts &= sbscrbrSlts - 1;
+   }
+   if((result == _ntfySbscrbrsQty) && alloc){
+      freeSlts = ~static_cast<uint32_t>(_ntfySbscrbrSlts) & ((1UL << _ntfySbscrbrsQty) - 1);
+      if(freeSlts != 0){
+         result = static_cast<uint8_t>(__builtin_ctz(freeSlts));
+         _ntfySbscrbr[result] = {sbscrbrTsk, 0, 0, 0, 0};
+      }
+   }
 
-   return;
+   return result;
 }
 
-void LimbsSftyLnFSwtch::setFnWhnBthHndsOnMssd(fncVdPtrPrmPtrType &newFnWhnBthHndsOnMssd){
-   if(_fnWhnBthHndsOnMssd != newFnWhnBthHndsOnMssd)
-      _fnWhnBthHndsOnMssd = newFnWhnBthHndsOnMssd;
+void LimbsSftyLnFSwtch::_getUndrlSwtchStts(){   
+   if(_undrlSwtchsMdld){
+      _lftHndSwtchStts.isEnabled = _undrlSwtchsMdl[lftHndInptId].isEnbld;
+      _lftHndSwtchStts.isOn = _undrlSwtchsMdl[lftHndInptId].isOn;
+      _lftHndSwtchStts.isVoided = _undrlSwtchsMdl[lftHndInptId].isVdd;
+      _rghtHndSwtchStts.isEnabled = _undrlSwtchsMdl[rghtHndInptId].isEnbld;
+      _rghtHndSwtchStts.isOn = _undrlSwtchsMdl[rghtHndInptId].isOn;
+      _rghtHndSwtchStts.isVoided = _undrlSwtchsMdl[rghtHndInptId].isVdd;
+      _ftSwtchStts.isEnabled = _undrlSwtchsMdl[ftInptId].isEnbld;
+      _ftSwtchStts.isOn = _undrlSwtchsMdl[ftInptId].isOn;
+      _ftSwtchStts.isVoided = _undrlSwtchsMdl[ftInptId].isVdd;
+   }
+   else{
+      _lftHndSwtchStts = otptsSttsUnpkg(_undrlLftHndMPBPtr->getOtptsSttsPkgd());
+      _rghtHndSwtchStts = otptsSttsUnpkg(_undrlRghtHndMPBPtr->getOtptsSttsPkgd());
+      _ftSwtchStts = otptsSttsUnpkg(_undrlFtMPBPtr->getOtptsSttsPkgd());
+   }
 
    return;
 }
 
-void LimbsSftyLnFSwtch::setFnWhnTrnOffLtchRlsPtr(fncVdPtrPrmPtrType &newFnWhnTrnOff){
-   if(_fnWhnTrnOffLtchRls != newFnWhnTrnOff)
-      _fnWhnTrnOffLtchRls = newFnWhnTrnOff;
+bool LimbsSftyLnFSwtch::injctInptEvnt(const uint8_t &inptId, const bool &isPrssd){
+   bool result{false};
 
-   return;
+   if(_evntDrvn && (_lsSwtchPollTmrHndl != NULL) && (inptId <= ftInptId)){
+      // Same deferred handler and input event encoding used by the GPIO edge ISR
+      if(xTimerPendFunctionCall(_inptEvntCb, this, (static_cast<uint32_t>(inptId) << 1) | (isPrssd?1UL:0UL), 0) == pdPASS)
+         result = true;
+   }
+
+   return result;
 }
 
-void LimbsSftyLnFSwtch::setFnWhnTrnOffPrdCyclPtr(fncVdPtrPrmPtrType &newFnWhnTrnOff){
-   if(_fnWhnTrnOffPrdCycl != newFnWhnTrnOff)
-      _fnWhnTrnOffPrdCycl = newFnWhnTrnOff;
+void LimbsSftyLnFSwtch::_inptEvntCb(void* lsSwtchObjArg, uint32_t inptEvnt){
+   LimbsSftyLnFSwtch* lsSwtchObj = static_cast<LimbsSftyLnFSwtch*>(lsSwtchObjArg);
+
+   // Executed by the timer service task: time stamp the edge and update the object immediately
+   lsSwtchObj->_updCurTimeMs();
+   lsSwtchObj->_setUndrlSwtchInptLvl(static_cast<uint8_t>(inptEvnt >> 1), (inptEvnt & 0x01UL) != 0, lsSwtchObj->_curTimeMs);
+   lsSwtchObj->_updLsSwtch();
 
    return;
 }
 
-void LimbsSftyLnFSwtch::setFnWhnTrnOnLtchRlsPtr(fncVdPtrPrmPtrType &newFnWhnTrnOn){
-   if(_fnWhnTrnOnLtchRls != newFnWhnTrnOn)
-      _fnWhnTrnOnLtchRls = newFnWhnTrnOn;
+void IRAM_ATTR LimbsSftyLnFSwtch::_inptIsr(void* isrArgPtr){
+   lsSwtchInptIsrArg_t* isrArg = static_cast<lsSwtchInptIsrArg_t*>(isrArgPtr);
+   BaseType_t hghrPrtyTskWkn{pdFALSE};
+   const bool inptLvl{_rdInptPinLvl(isrArg->inptPin)};
+
+   // Input event encoding: bit 0 pressed state, bits 1 and up input identification
+   if(xTimerPendFunctionCallFromISR(_inptEvntCb, isrArg->lsSwtchObj, (static_cast<uint32_t>(isrArg->inptId) << 1) | ((inptLvl == isrArg->prssdLvl)?1UL:0UL), &hghrPrtyTskWkn) != pdPASS)
+      isrArg->lsSwtchObj->_inptRsmplPndng = true;   // Edge lost, the inputs levels will be read again by the next update
+   portYIELD_FROM_ISR(hghrPrtyTskWkn);
 
    return;
 }
 
-void LimbsSftyLnFSwtch::setFnWhnTrnOnPrdCyclPtr(fncVdPtrPrmPtrType &newFnWhnTrnOn){
-   if(_fnWhnTrnOnPrdCycl != newFnWhnTrnOn)
-      _fnWhnTrnOnPrdCycl = newFnWhnTrnOn;
+bool LimbsSftyLnFSwtch::_isPhsTmrWt(){
+   bool result{false};
 
-   return;
+   // The FDA is waiting for a phase deadline the armed one-shot timer will signal, the entry code pending -if any- only clears the state change flag
+   if(_phsTmrDrvn && _phsTmrArmd)
+      result = (_lsSwtchFdaState == stEndRls) || (_lsSwtchFdaState == stEndCycl);
+
+   return result;
 }
 
-bool LimbsSftyLnFSwtch::setLtchRlsTtlTm(const unsigned long int &newVal){
-   bool result{true};
+bool LimbsSftyLnFSwtch::_isQscnt(){
+   bool result{false};
 
-   if (_ltchRlsTtlTm != newVal){
-      if((newVal > 0) && (newVal <= _prdCyclTtlTm))
-         _ltchRlsTtlTm = newVal;
-      else
-         result = false;
+   // No output change is possible until the next input edge -or phase deadline timer expiration- if no state entry code is pending, the FDA is waiting for the hands, the foot, a phase deadline or the emergency stop recovery, and every underlying switch is in a stable state: debounced and released, or pressed with no start delay, voiding or single service time pending
+   if((!_sttChng && ((_lsSwtchFdaState == stOffNotBHP) || (_lsSwtchFdaState == stOffBHPNotFP) || (_lsSwtchFdaState == stEmrgncyExcpHndl))) || _isPhsTmrWt()){
+      result = true;
+      for(uint8_t inptId{lftHndInptId}; (inptId <= ftInptId) && result; ++inptId){
+         const undrlSwtchMdl_t &undrlSwtchMdl = _undrlSwtchsMdl[inptId];
+
+         if(undrlSwtchMdl.inptPrssd != undrlSwtchMdl.isPrssd)
+            result = false;
+         else if(undrlSwtchMdl.isPrssd && undrlSwtchMdl.isEnbld && !undrlSwtchMdl.rlsPndng && !undrlSwtchMdl.isVdd)
+            result = false;
+      }
    }
 
    return result;
 }
 
-void LimbsSftyLnFSwtch::setLsSwtchOtptsChng(bool newLsSwtchOtptsChng){
-   portMUX_TYPE mux portMUX_INITIALIZER_UNLOCKED;
+uint32_t LimbsSftyLnFSwtch::_lsSwtchOtptsSttsPkgd(uint32_t prevVal){
+/*
++--+-+--+--+--++--+--+--+--+--+--+--+--+
+|31|~|10|09|08||07|06|05|04|03|02|01|00|
+ ------- -- --  -- -- -- -- -- -- -- --
+       |  |  |   |  |  |  |  |  |  |  |
+       |  |  |   |  |  |  |  |  |  |  lftHndSwtchIsEnbld
+       |  |  |   |  |  |  |  |  |  lftHndSwtchIsOn
+       |  |  |   |  |  |  |  |  lftHndSwtchIsVdd
+       |  |  |   |  |  |  |  rghtHndSwtchIsEnbld
+       |  |  |   |  |  |  rghtHndSwtchIsOn
+       |  |  |   |  |  rghtHndSwtchIsVdd
+       |  |  |   |  ftSwtchIsEnbld
+       |  |  |   ftSwtchIsOn
+       |  |  LsSwtchLtchRlsIsOn
+       |  LsSwtchPrdCyclIsOn
+       N/C
 
-	taskENTER_CRITICAL(&mux);
-	if(newLsSwtchOtptsChng)
-		++_lsSwtchOtptsChngCnt;
-	else
-		if(_lsSwtchOtptsChngCnt)
-			--_lsSwtchOtptsChngCnt;
-	if(_lsSwtchOtptsChngCnt)
-		_lsSwtchOtptsChng = true;
-	else
-		_lsSwtchOtptsChng = false;
-	taskEXIT_CRITICAL(&mux);
+*/   
+   const lsSwtchOtpts_t curStts{
+      .lftHndIsEnbld = _lftHndSwtchStts.isEnabled,
+      .lftHndIsOn = _lftHndSwtchStts.isOn,
+      .lftHndIsVdd = _lftHndSwtchStts.isVoided,
+      .rghtHndIsEnbld = _rghtHndSwtchStts.isEnabled,
+      .rghtHndIsOn = _rghtHndSwtchStts.isOn,
+      .rghtHndIsVdd = _rghtHndSwtchStts.isVoided,
+      .ftSwIsEnbld = _ftSwtchStts.isEnabled,
+      .ftSwIsOn = _ftSwtchStts.isOn,  //! The ftSwtch is a SnglShtMPBttn object, the isOn flag makes no stable signal source!!
+      .ltchRlsIsOn = _ltchRlsIsOn,
+      .prdCyclIsOn = _prdCyclIsOn
+   };
+
+   prevVal = (prevVal & ~lsSwtchOtptsSttsMsk) | lssOtptsSttsPkg(curStts);
 
-   return;
+   return prevVal;
 }
 
-bool LimbsSftyLnFSwtch::setPrdCyclTtlTm(const unsigned long int &newVal){
-   bool result{true};
-
-   if(_prdCyclTtlTm != newVal){
-      if((newVal > 0) && (newVal >= _ltchRlsTtlTm))
-         _prdCyclTtlTm = newVal;
-      else
-         result = false;
+void LimbsSftyLnFSwtch::lsSwtchCbDsptchTsk(void* lsSwtchObjArg){
+   LimbsSftyLnFSwtch* lsSwtchObj = (LimbsSftyLnFSwtch*)lsSwtchObjArg;
+   lsSwtchCbEvnt_t cbEvnt{};
+   uint32_t queDpth{0};
+   int64_t exctStrtTmUs{0};
+   uint32_t exctTmUs{0};
+   uint32_t queWtTmUs{0};
+
+   for(;;){
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      while(lsSwtchObj->_deqCb(cbEvnt, queDpth)){
+         exctStrtTmUs = esp_timer_get_time();
+         cbEvnt.fnToExct(cbEvnt.fnToExctArg);
+         exctTmUs = static_cast<uint32_t>(esp_timer_get_time() - exctStrtTmUs);
+         queWtTmUs = static_cast<uint32_t>(exctStrtTmUs - cbEvnt.enqTmUs);
+
+         taskENTER_CRITICAL(&lsSwtchObj->_lsSwtchMux);
+         ++lsSwtchObj->_cbDsptchStts.dsptchdQty;
+         lsSwtchObj->_cbDsptchStts.ttlExctTmUs += exctTmUs;
+         if(lsSwtchObj->_cbDsptchStts.maxExctTmUs < exctTmUs)
+            lsSwtchObj->_cbDsptchStts.maxExctTmUs = exctTmUs;
+         if(lsSwtchObj->_cbDsptchStts.maxQueWtTmUs < queWtTmUs)
+            lsSwtchObj->_cbDsptchStts.maxQueWtTmUs = queWtTmUs;
+         if(lsSwtchObj->_cbDsptchStts.maxQueDpth < queDpth)
+            lsSwtchObj->_cbDsptchStts.maxQueDpth = queDpth;
+         taskEXIT_CRITICAL(&lsSwtchObj->_lsSwtchMux);
+      }
    }
-   
-   return result;
 }
 
-void LimbsSftyLnFSwtch::_setSttChng(){
-   _sttChng = true;
+#if _lsSwtchStcAlloc
+void LimbsSftyLnFSwtch::lsSwtchPhsTmrCb(TimerHandle_t lssTmrCbArg){
+   LimbsSftyLnFSwtch* lsSwtchObj = (LimbsSftyLnFSwtch*)pvTimerGetTimerID(lssTmrCbArg);
 
-   return;
+   lsSwtchObj->_phsTmrArmd = false;
+   lsSwtchObj->_updLsSwtch();
+
+	return;
 }
+#else
+void LimbsSftyLnFSwtch::lsSwtchPhsTmrCb(void* lsSwtchObjArg){
+   LimbsSftyLnFSwtch* lsSwtchObj = static_cast<LimbsSftyLnFSwtch*>(lsSwtchObjArg);
 
-void LimbsSftyLnFSwtch::setTrnOffLtchRlsArgPtr(void *&newVal){
-   if(_fnWhnTrnOffLtchRlsArg != newVal)
-      _fnWhnTrnOffLtchRlsArg = newVal;
+   // Executed by the esp_timer task, the update is deferred to the timer service task that executes every other update of the object
+   if(xTimerPendFunctionCall(_phsDdlnCb, lsSwtchObj, 0, 0) != pdPASS)
+      esp_timer_start_once(lsSwtchObj->_lsSwtchPhsTmrHndl, portTICK_PERIOD_MS * 1000ULL);   // Timer commands queue full, retried a tick later
 
-   return;
+	return;
 }
+#endif
 
-void LimbsSftyLnFSwtch::setTrnOffPrdCyclArgPtr(void* &newVal){
-   if(_fnWhnTrnOffPrdCyclArg != newVal)
-      _fnWhnTrnOffPrdCyclArg = newVal;
+void LimbsSftyLnFSwtch::lsSwtchPollCb(TimerHandle_t lssTmrCbArg){
+   LimbsSftyLnFSwtch* lsSwtchObj = (LimbsSftyLnFSwtch*)pvTimerGetTimerID(lssTmrCbArg);
+
+   lsSwtchObj->_updLsSwtch();
+
+	return;
+}
+
+void LimbsSftyLnFSwtch::_pblshSttsSnpsht(const bool &isSd){
+   uint32_t seqNum{_sttsSnpshtSeq.load(std::memory_order_relaxed)};
+   const uint32_t otptsSttsPkgd{_lsSwtchOtptsSttsPkgd()};
+   uint64_t phsElpsdUs{0};
+   uint64_t phsDdlnUs{0};
+   uint64_t phsRmngTm64{0};
+   uint32_t phsElpsdTm{0};
+   uint32_t phsRmngTm{0};
+   const uint32_t prvOtptsSttsPkgd{_sttsSnpshtPkgd.load(std::memory_order_relaxed)};
+   uint32_t rsngEdgs{0};
+   uint32_t fllngEdgs{0};
+   uint32_t sbscrbrSlts{0};
+   uint8_t sbscrbrIdx{0};
+
+   if((_lsSwtchFdaState == stEndRls) || (_lsSwtchFdaState == stEndCycl)){
+      phsElpsdUs = _curTimeUs - _prdCyclTmrStrtUs;
+      phsDdlnUs = ((_lsSwtchFdaState == stEndRls)?_ltchRlsTtlTm:_prdCyclTtlTm) * 1000ULL;
+      phsElpsdTm = static_cast<uint32_t>(((phsElpsdUs / 1000ULL) < lsSwtchExtdPhsTmMax)?(phsElpsdUs / 1000ULL):lsSwtchExtdPhsTmMax);
+      if(phsDdlnUs > phsElpsdUs){ // Remaining time rounded up: 0 only when the deadline is reached
+         phsRmngTm64 = (phsDdlnUs - phsElpsdUs + 999ULL) / 1000ULL;
+         phsRmngTm = static_cast<uint32_t>((phsRmngTm64 < lsSwtchExtdPhsTmMax)?phsRmngTm64:lsSwtchExtdPhsTmMax);
+      }
+   }
+
+   // A seed publication sets the initial status: it's not a change, counts no change sequence and produces no pending actions nor transition record
+   if(!isSd && (otptsSttsPkgd != prvOtptsSttsPkgd)){
+      // Executed holding the object lock: the waiters blocked at this moment are unblocked after the lock is released
+      ++_sttsChngSeq;
+      _sttsWtrsToWk |= _sttsWtrsSlts;
+      _pndngActns |= actnOtptsChng;
+      rsngEdgs = otptsSttsPkgd & ~prvOtptsSttsPkgd;
+      fllngEdgs = prvOtptsSttsPkgd & ~otptsSttsPkgd;
+      // The setTskToNtfyLsSwtchOtptsChng() task is notified on any change
+      sbscrbrSlts = _ntfySbscrbrSlts;
+      while(sbscrbrSlts != 0){
+         sbscrbrIdx = static_cast<uint8_t>(__builtin_ctz(sbscrbrSlts));
+         _sttsSbscrbrsToNtfy |= static_cast<uint16_t>((((rsngEdgs & _ntfySbscrbr[sbscrbrIdx].rsngEdgsMsk) | (fllngEdgs & _ntfySbscrbr[sbscrbrIdx].fllngEdgsMsk) | (_ntfySbscrbr[sbscrbrIdx].lgcyEdgsMsk & lsSwtchOtptsChngEdgBit)) != 0) << sbscrbrIdx);
+         sbscrbrSlts &= sbscrbrSlts - 1;
+      }
+   }
+
+   // Seqlock single writer publication: the sequence number is odd while the snapshot is being modified
+   _sttsSnpshtSeq.store(seqNum + 1, std::memory_order_relaxed);
+   std::atomic_thread_fence(std::memory_order_release);
+   _sttsSnpshtPkgd.store(otptsSttsPkgd, std::memory_order_relaxed);
+   _sttsSnpshtTm.store(_curTimeMs, std::memory_order_relaxed);
+   _sttsSnpshtFdaStt.store(static_cast<uint8_t>(_lsSwtchFdaState), std::memory_order_relaxed);
+   _sttsSnpshtPhsElpsdTm.store(phsElpsdTm, std::memory_order_relaxed);
+   _sttsSnpshtPhsRmngTm.store(phsRmngTm, std::memory_order_relaxed);
+   _sttsSnpshtSeq.store(seqNum + 2, std::memory_order_release);
+   if(isSd){
+      _trnstnLstOtptsSttsPkgd = otptsSttsPkgd;
+      _trnstnLstFdaStt = static_cast<uint8_t>(_lsSwtchFdaState);
+   }
+   else if(_trnstnRcrdd && ((otptsSttsPkgd != _trnstnLstOtptsSttsPkgd) || (static_cast<uint8_t>(_lsSwtchFdaState) != _trnstnLstFdaStt))){
+      _pshTrnstnRcrd(otptsSttsPkgd);
+   }
 
    return;
 }
 
-void LimbsSftyLnFSwtch::setTrnOnLtchRlsArgPtr(void* &newVal){
-   if(_fnWhnTrnOnLtchRlsArg != newVal)
-      _fnWhnTrnOnLtchRlsArg = newVal;
+#if !_lsSwtchStcAlloc
+void LimbsSftyLnFSwtch::_phsDdlnCb(void* lsSwtchObjArg, uint32_t ulParameter2){
+   LimbsSftyLnFSwtch* lsSwtchObj = static_cast<LimbsSftyLnFSwtch*>(lsSwtchObjArg);
+
+   lsSwtchObj->_phsTmrArmd = false;
+   lsSwtchObj->_updLsSwtch();
 
    return;
 }
-	
-void LimbsSftyLnFSwtch::setTrnOnPrdCyclArgPtr(void* &newVal){
-   if(_fnWhnTrnOnPrdCyclArg != newVal)
-      _fnWhnTrnOnPrdCyclArg = newVal;
+#endif
+
+#if _lsSwtchPrfInstr
+inline void LimbsSftyLnFSwtch::_prfLap(uint32_t (&prfStgTcks)[_prfStgsQty], uint32_t &prfLapStrtTcks, const uint8_t &prfStgId){
+   const uint32_t prfLapEndTcks{_getPrfTcks()};
+
+   // Adds the ticks elapsed since the previous lap to the update stage just completed, the stage might be timed in several laps
+   prfStgTcks[prfStgId] += prfLapEndTcks - prfLapStrtTcks;
+   prfLapStrtTcks = prfLapEndTcks;
 
    return;
 }
 
-void LimbsSftyLnFSwtch::setTskToNtfyBthHndsOnMssd(const TaskHandle_t &newTaskHandle){
-   portMUX_TYPE mux portMUX_INITIALIZER_UNLOCKED;
-	eTaskState taskToNtfyStt{};
+inline void LimbsSftyLnFSwtch::_prfFdaStp(fdaStpPrf_t* prfFdaStps, uint8_t &prfFdaStpsQty, const uint8_t &prfFdaStpsSz){
+   const uint8_t prfStpFrmStt{static_cast<uint8_t>(_lsSwtchFdaState)};
+   const uint32_t prfStpStrtTcks{_getPrfTcks()};
 
-   taskENTER_CRITICAL(&mux);
-   if(_tskToNtfyBthHndsOnMssd != newTaskHandle){
-      if(_tskToNtfyBthHndsOnMssd != NULL){
-         taskToNtfyStt = eTaskGetState(_tskToNtfyBthHndsOnMssd);
-         if (taskToNtfyStt != eSuspended){
-            if(taskToNtfyStt != eDeleted){
-               vTaskSuspend(_tskToNtfyBthHndsOnMssd);
-               _tskToNtfyBthHndsOnMssd = NULL;
-            }
-         }
-      }
-      if (newTaskHandle != NULL)
-         _tskToNtfyBthHndsOnMssd = newTaskHandle;
+   // Executes a FDA step registering its duration and its starting and ending states for the worst case execution time records
+   _updFdaState();
+   if(prfFdaStpsQty < prfFdaStpsSz){
+      prfFdaStps[prfFdaStpsQty] = {prfStpFrmStt, static_cast<uint8_t>(_lsSwtchFdaState), _getPrfTcks() - prfStpStrtTcks};
+      ++prfFdaStpsQty;
    }
-   taskEXIT_CRITICAL(&mux);
 
-	return;
+   return;
 }
 
-void LimbsSftyLnFSwtch::setTskToNtfyLsSwtchOtptsChng(const TaskHandle_t &newTaskHandle){
-   portMUX_TYPE mux portMUX_INITIALIZER_UNLOCKED;
-	eTaskState taskToNtfyStt{};
-
-   taskENTER_CRITICAL(&mux);
-   if(_tskToNtfyLsSwtchOtptsChng != newTaskHandle){
-      if(_tskToNtfyLsSwtchOtptsChng != NULL){
-         taskToNtfyStt = eTaskGetState(_tskToNtfyLsSwtchOtptsChng);
-         if (taskToNtfyStt != eSuspended){
-            if(taskToNtfyStt != eDeleted){
-               vTaskSuspend(_tskToNtfyLsSwtchOtptsChng);
-               _tskToNtfyLsSwtchOtptsChng = NULL;
-            }
-         }
-      }
-      if (newTaskHandle != NULL)
-         _tskToNtfyLsSwtchOtptsChng = newTaskHandle;
+void LimbsSftyLnFSwtch::_rcrdPrfSmpls(const uint32_t (&prfStgTcks)[_prfStgsQty], const uint8_t &updFrmStt, const fdaStpPrf_t* fdaStps, const uint8_t &fdaStpsQty){
+   uint8_t bcktIdx{0};
+   uint32_t fdaTcks{0};
+   const bool lckHldOvrBnd{(_wcetLckHldBndTcks != 0) && (prfStgTcks[lckHldPrfStgId] > _wcetLckHldBndTcks)};
+
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   for(uint8_t prfStgId{0}; prfStgId < _prfStgsQty; ++prfStgId){
+      lsSwtchPrfHstgrm_t &hstgrm{_prfHstgrm[prfStgId]};
+
+      // Logarithmic bucket: the position of the duration most significant bit set
+      bcktIdx = static_cast<uint8_t>(31 - __builtin_clz(prfStgTcks[prfStgId] | 1U));
+      if(bcktIdx >= _prfHstgrmBcktsQty)
+         bcktIdx = _prfHstgrmBcktsQty - 1;
+      ++hstgrm.bckts[bcktIdx];
+      if((hstgrm.smplsQty == 0) || (hstgrm.minTcks > prfStgTcks[prfStgId]))
+         hstgrm.minTcks = prfStgTcks[prfStgId];
+      if(hstgrm.maxTcks < prfStgTcks[prfStgId])
+         hstgrm.maxTcks = prfStgTcks[prfStgId];
+      hstgrm.ttlTcks += prfStgTcks[prfStgId];
+      ++hstgrm.smplsQty;
    }
-   taskEXIT_CRITICAL(&mux);
+   // Worst case execution time records: the update in its starting state record, each FDA step changing the state in its transition record
+   for(uint8_t fdaStpIdx{0}; fdaStpIdx < fdaStpsQty; ++fdaStpIdx){
+      fdaTcks += fdaStps[fdaStpIdx].tcks;
+      if(fdaStps[fdaStpIdx].frmStt != fdaStps[fdaStpIdx].toStt)
+         _rcrdWcetSmpl(_wcetTrnstn[fdaStps[fdaStpIdx].frmStt][fdaStps[fdaStpIdx].toStt], fdaStps[fdaStpIdx].tcks, prfStgTcks, lckHldOvrBnd);
+   }
+   _rcrdWcetSmpl(_wcetStt[updFrmStt], fdaTcks, prfStgTcks, lckHldOvrBnd);
+   taskEXIT_CRITICAL(&_lsSwtchMux);
 
-	return;
+   return;
 }
 
-void LimbsSftyLnFSwtch::setTskToNtfyTrnOffLtchRls(const TaskHandle_t &newTaskHandle){
-   portMUX_TYPE mux portMUX_INITIALIZER_UNLOCKED;
-	eTaskState taskToNtfyStt{};
+void LimbsSftyLnFSwtch::_rcrdWcetSmpl(lsSwtchWcetRcrd_t &rcrd, const uint32_t &fdaTcks, const uint32_t (&prfStgTcks)[_prfStgsQty], const bool &lckHldOvrBnd){
+   if(rcrd.maxFdaTcks < fdaTcks)
+      rcrd.maxFdaTcks = fdaTcks;
+   if(rcrd.maxLckHldTcks < prfStgTcks[lckHldPrfStgId])
+      rcrd.maxLckHldTcks = prfStgTcks[lckHldPrfStgId];
+   if(rcrd.maxUpdTcks < prfStgTcks[updTtlPrfStgId])
+      rcrd.maxUpdTcks = prfStgTcks[updTtlPrfStgId];
+   if(lckHldOvrBnd)
+      ++rcrd.lckHldOvrBndQty;
+   ++rcrd.smplsQty;
 
-   taskENTER_CRITICAL(&mux);
-   if(_tskToNtfyTrnOffLtchRls != newTaskHandle){
-      if(_tskToNtfyTrnOffLtchRls != NULL){
-         taskToNtfyStt = eTaskGetState(_tskToNtfyTrnOffLtchRls);
-         if (taskToNtfyStt != eSuspended){
-            if(taskToNtfyStt != eDeleted){
-               vTaskSuspend(_tskToNtfyTrnOffLtchRls);
-               _tskToNtfyTrnOffLtchRls = NULL;
-            }
-         }
-      }
-      if (newTaskHandle != NULL)
-         _tskToNtfyTrnOffLtchRls = newTaskHandle;
+   return;
+}
+#endif
+
+void LimbsSftyLnFSwtch::_pshTrnstnRcrd(const uint32_t &otptsSttsPkgd){
+   uint32_t rngHd{_trnstnRngHd.load(std::memory_order_relaxed)};
+
+   // Single producer: the object's update code is the only one advancing the ring head. A full ring drops the record, the producer never waits for the consumer
+   if((rngHd - _trnstnRngTl.load(std::memory_order_acquire)) < _trnstnRngSz){
+      _trnstnRng[rngHd & (_trnstnRngSz - 1)] = {_curTimeUs, otptsSttsPkgd, static_cast<uint8_t>(_lsSwtchFdaState)};
+      _trnstnRngHd.store(rngHd + 1, std::memory_order_release);
    }
-   taskEXIT_CRITICAL(&mux);
+   else{
+      _trnstnRngOvrrnQty.fetch_add(1, std::memory_order_relaxed);
+   }
+   _trnstnLstOtptsSttsPkgd = otptsSttsPkgd;
+   _trnstnLstFdaStt = static_cast<uint8_t>(_lsSwtchFdaState);
 
-	return;
+   return;
 }
 
-void LimbsSftyLnFSwtch::setTskToNtfyTrnOffPrdCycl(const TaskHandle_t &newTaskHandle){
-   portMUX_TYPE mux portMUX_INITIALIZER_UNLOCKED;
-	eTaskState taskToNtfyStt{};
+bool IRAM_ATTR LimbsSftyLnFSwtch::_rdInptPinLvl(const uint8_t &inptPin){
+   bool result{false};
 
-   taskENTER_CRITICAL(&mux);
-   if(_tskToNtfyTrnOffPrdCycl != newTaskHandle){
-      if(_tskToNtfyTrnOffPrdCycl != NULL){
-         taskToNtfyStt = eTaskGetState(_tskToNtfyTrnOffPrdCycl);
-         if (taskToNtfyStt != eSuspended){
-            if(taskToNtfyStt != eDeleted){
-               vTaskSuspend(_tskToNtfyTrnOffPrdCycl);
-               _tskToNtfyTrnOffPrdCycl = NULL;
-            }
-         }
+   // Direct GPIO input registers read, the Arduino API functions are not placed in IRAM
+#if SOC_GPIO_PIN_COUNT > 32
+   if(inptPin >= 32)
+      result = ((REG_READ(GPIO_IN1_REG) >> (inptPin - 32)) & 0x01UL) != 0;
+   else
+#endif
+      result = ((REG_READ(GPIO_IN_REG) >> inptPin) & 0x01UL) != 0;
+
+   return result;
+}
+
+bool LimbsSftyLnFSwtch::rcvrEmrgncyStp(){
+   bool result{false};
+   bool hndsPrssd{false};
+
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   if(_lsSwtchFdaState == stEmrgncyExcpHndl){
+      // The hands switches might be disabled by the FDA when stopped, their isOn flags don't reflect the inputs: the input levels are checked instead
+      for(uint8_t inptId{lftHndInptId}; inptId <= rghtHndInptId; ++inptId){
+         if(_undrlSwtchsMdld)
+            hndsPrssd = hndsPrssd || _undrlSwtchsMdl[inptId].isPrssd || _undrlSwtchsMdl[inptId].inptPrssd;
+         else if(_inptIsrArg[inptId].inptPin <= _maxValidPinNum)  // Unconnected inputs are skipped, as LsSwtchGrp::addLsSwtch() does
+            hndsPrssd = hndsPrssd || (_rdInptPinLvl(_inptIsrArg[inptId].inptPin) == _inptIsrArg[inptId].prssdLvl);
+      }
+      if(!_emrgncyStpPndng && !_emrgncyStpInptActv && !hndsPrssd){
+         // The start state entry code restores the underlying switches, a foot press registered while stopped is discarded
+         _ltchRlsPndng = false;
+         _lsSwtchFdaState = stOffNotBHP;
+         _setSttChng();
+         ++_emrgncyStpStts.rcvrQty;
+         _emrgncyStpStts.lstHltTmUs = static_cast<uint64_t>(esp_timer_get_time() - _emrgncyStpEntryTmUs);
+         result = true;
+      }
+      else{
+         ++_emrgncyStpStts.rcvrRfsdQty;
       }
-      if (newTaskHandle != NULL)
-         _tskToNtfyTrnOffPrdCycl = newTaskHandle;
    }
-   taskEXIT_CRITICAL(&mux);
+   taskEXIT_CRITICAL(&_lsSwtchMux);
+   // The periodic timer might be stopped while in the emergency stop state, restart it to execute the start state entry code
+   if(result && (_evntDrvn || _phsTmrDrvn) && (_lsSwtchPollTmrHndl != NULL)){
+      if(xTimerStart(_lsSwtchPollTmrHndl, portMAX_DELAY) != pdPASS)
+         errorFlag = pdTRUE;
+   }
 
-	return;
+   return result;
 }
 
-void LimbsSftyLnFSwtch::setTskToNtfyTrnOnLtchRls(const TaskHandle_t &newTaskHandle){
-   portMUX_TYPE mux portMUX_INITIALIZER_UNLOCKED;
-	eTaskState taskToNtfyStt{};
+void LimbsSftyLnFSwtch::_rdUndrlSwtchsInpts(){
+   _inptRsmplPndng = false;
+   for(uint8_t inptId{lftHndInptId}; inptId <= ftInptId; ++inptId)
+      _setUndrlSwtchInptLvl(inptId, (digitalRead(_inptIsrArg[inptId].inptPin) == HIGH) == _inptIsrArg[inptId].prssdLvl, _curTimeMs);
 
-   taskENTER_CRITICAL(&mux);
-   if(_tskToNtfyTrnOnLtchRls != newTaskHandle){
-      if(_tskToNtfyTrnOnLtchRls != NULL){
-         taskToNtfyStt = eTaskGetState(_tskToNtfyTrnOnLtchRls);
-         if (taskToNtfyStt != eSuspended){
-            if(taskToNtfyStt != eDeleted){
-               vTaskSuspend(_tskToNtfyTrnOnLtchRls);
-               _tskToNtfyTrnOnLtchRls = NULL;
-            }
-         }
-      }
-      if (newTaskHandle != NULL)
-         _tskToNtfyTrnOnLtchRls = newTaskHandle;
+   return;
+}
+
+void LimbsSftyLnFSwtch::resetFda(){
+   bool fdaRst{false};
+
+	taskENTER_CRITICAL(&_lsSwtchMux);
+   // The emergency stop state is left only by the rcvrEmrgncyStp() recovery
+   if((_lsSwtchFdaState != stEmrgncyExcpHndl) && !_emrgncyStpPndng){
+      clrStatus();
+      _setSttChng();
+      _lsSwtchFdaState = stOffNotBHP;
+      _updOtptPins();
+      fdaRst = true;
+   }
+	taskEXIT_CRITICAL(&_lsSwtchMux);
+   // The periodic timer might be stopped while waiting for an input edge or a phase deadline, restart it to execute the start state entry code
+   if(fdaRst && (_evntDrvn || _phsTmrDrvn) && (_lsSwtchPollTmrHndl != NULL)){
+      if(xTimerStart(_lsSwtchPollTmrHndl, portMAX_DELAY) != pdPASS)
+         errorFlag = pdTRUE;
    }
-   taskEXIT_CRITICAL(&mux);
 
-	return;
+   return;
 }
 
-void LimbsSftyLnFSwtch::setTskToNtfyTrnOnPrdCycl(const TaskHandle_t &newTaskHandle){
-   portMUX_TYPE mux portMUX_INITIALIZER_UNLOCKED;
-	eTaskState taskToNtfyStt{};
-
-   taskENTER_CRITICAL(&mux);
-   if(_tskToNtfyTrnOnPrdCycl != newTaskHandle){
-      if(_tskToNtfyTrnOnPrdCycl != NULL){
-         taskToNtfyStt = eTaskGetState(_tskToNtfyTrnOnPrdCycl);
-         if (taskToNtfyStt != eSuspended){
-            if(taskToNtfyStt != eDeleted){
-               vTaskSuspend(_tskToNtfyTrnOnPrdCycl);
-               _tskToNtfyTrnOnPrdCycl = NULL;
-            }
-         }
+bool LimbsSftyLnFSwtch::rmvEdgsSbscrbr(const TaskHandle_t &sbscrbrTsk){
+   bool result{false};
+   uint8_t sbscrbrIdx{_ntfySbscrbrsQty};
+
+   if(sbscrbrTsk != NULL){
+      taskENTER_CRITICAL(&_lsSwtchMux);
+      sbscrbrIdx = _getNtfySbscrbr(sbscrbrTsk, false);
+      if((sbscrbrIdx < _ntfySbscrbrsQty) && (_ntfySbscrbr[sbscrbrIdx].edgsMsk != 0)){
+         _ntfySbscrbr[sbscrbrIdx].edgsMsk = 0;
+         _updNtfySbscrbr(sbscrbrIdx);
+         --_edgsSbscrbrsQty;
+         result = true;
       }
-      if (newTaskHandle != NULL)
-         _tskToNtfyTrnOnPrdCycl = newTaskHandle;
+      taskEXIT_CRITICAL(&_lsSwtchMux);
    }
-   taskEXIT_CRITICAL(&mux);
 
-	return;
+   return result;
 }
 
-bool LimbsSftyLnFSwtch::setUndrlSwtchsPollDelay(const unsigned long int &newVal){
+bool LimbsSftyLnFSwtch::rmvSttsSbscrbr(const TaskHandle_t &sbscrbrTsk){
    bool result{false};
-   
-   if(_minPollDelay <= newVal){
-      _undrlSwtchsPollDelay = newVal;
-      result = true;
+   uint8_t sbscrbrIdx{_ntfySbscrbrsQty};
+
+   if(sbscrbrTsk != NULL){
+      taskENTER_CRITICAL(&_lsSwtchMux);
+      sbscrbrIdx = _getNtfySbscrbr(sbscrbrTsk, false);
+      if((sbscrbrIdx < _ntfySbscrbrsQty) && ((_ntfySbscrbr[sbscrbrIdx].rsngEdgsMsk | _ntfySbscrbr[sbscrbrIdx].fllngEdgsMsk) != 0)){
+         _ntfySbscrbr[sbscrbrIdx].rsngEdgsMsk = 0;
+         _ntfySbscrbr[sbscrbrIdx].fllngEdgsMsk = 0;
+         _sttsSbscrbrsToNtfy &= ~static_cast<uint16_t>(1 << sbscrbrIdx);
+         _updNtfySbscrbr(sbscrbrIdx);
+         --_sttsSbscrbrsQty;
+         result = true;
+      }
+      taskEXIT_CRITICAL(&_lsSwtchMux);
    }
 
    return result;
 }
 
-void LimbsSftyLnFSwtch::_turnOffLtchRls(){
-   portMUX_TYPE mux portMUX_INITIALIZER_UNLOCKED;
-   
-   if(_ltchRlsIsOn){
-      //---------------->> Tasks related actions
-      //---------------->> Specific Task for Latch Release turned off related actions
-      if(getTskToNtfyTrnOffLtchRls() != NULL){
-         xReturned = xTaskNotify(
-            getTskToNtfyTrnOffLtchRls(),	// TaskHandle_t of the task receiving notification
-            static_cast<uint32_t>(0x00),
-            eSetValueWithOverwrite	// In this specific case using eSetBits is also a valid option
-         );
-         if (xReturned != pdPASS)
-            errorFlag = pdTRUE;
-      }
-		//---------------->> Functions related actions
-		if(_fnWhnTrnOffLtchRls != nullptr)
-			_fnWhnTrnOffLtchRls(_fnWhnTrnOffLtchRlsArg);
-	   //---------------->> Flags related actions
-		taskENTER_CRITICAL(&mux);
-      _ltchRlsIsOn = false;
-		setLsSwtchOtptsChng(true);
-		taskEXIT_CRITICAL(&mux);
-	} 
+void LimbsSftyLnFSwtch::rstCbDsptchStts(){
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   _cbDsptchStts = {};
+   taskEXIT_CRITICAL(&_lsSwtchMux);
 
    return;
 }
 
-void LimbsSftyLnFSwtch::_turnOffPrdCycl(){
-   portMUX_TYPE mux portMUX_INITIALIZER_UNLOCKED;
-   
-   if(_prdCyclIsOn){
-      //---------------->> Tasks related actions
-      //---------------->> Specific Task for Latch Release turned off related actions
-      if(getTskToNtfyTrnOffPrdCycl() != NULL){
-         xReturned = xTaskNotify(
-            getTskToNtfyTrnOffPrdCycl(),	// TaskHandle_t of the task receiving notification
-            static_cast<uint32_t>(0x00),
-            eSetValueWithOverwrite	// In this specific case using eSetBits is also a valid option
-         );
-         if (xReturned != pdPASS)
-            errorFlag = pdTRUE;
-      }
-		//---------------->> Functions related actions
-		if(_fnWhnTrnOffPrdCycl != nullptr)
-			_fnWhnTrnOffPrdCycl(_fnWhnTrnOffPrdCyclArg);
-	   //---------------->> Flags related actions
-		taskENTER_CRITICAL(&mux);
-      _prdCyclIsOn = false;
-		setLsSwtchOtptsChng(true);
-		taskEXIT_CRITICAL(&mux);
-	}
+void LimbsSftyLnFSwtch::rstEmrgncyStts(){
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   _emrgncyStpStts = {};
+   taskEXIT_CRITICAL(&_lsSwtchMux);
 
    return;
 }
 
-void LimbsSftyLnFSwtch::_turnOnLtchRls(){
-   portMUX_TYPE mux portMUX_INITIALIZER_UNLOCKED;
-   
-   if(!_ltchRlsIsOn){
-      //---------------->> Tasks related actions
-      //---------------->> Specific Task for Latch Release turned off related actions
-      if(getTskToNtfyTrnOnLtchRls() != NULL){
-         xReturned = xTaskNotify(
-            getTskToNtfyTrnOnLtchRls(),	// TaskHandle_t of the task receiving notification
-            static_cast<uint32_t>(0x00),
-            eSetValueWithOverwrite	// In this specific case using eSetBits is also a valid option
-         );
-         if (xReturned != pdPASS)
-            errorFlag = pdTRUE;
+void IRAM_ATTR LimbsSftyLnFSwtch::_rqstEmrgncyStp(const bool &frmIsr){
+   const int64_t rqstTmUs{esp_timer_get_time()};
+   uint64_t otptPinsHghMsk{0};
+   uint32_t otptsOffTmUs{0};
+
+   // Executed holding the object lock, from the emergency stop input ISR or from a task
+   if(!_emrgncyStpPndng && (_lsSwtchFdaState != stEmrgncyExcpHndl)){
+      _emrgncyStpRqstTmUs = rqstTmUs;
+      _emrgncyStpPndng = true;   // From now on the output stage keeps the pins inactive
+      // The emergency stop input and a writer function are mutually exclusive, the frmIsr check keeps the ISR from executing a function not placed in IRAM anyway
+      if((_otptPinsMsk != 0) && (!frmIsr || (_otptPinsWrtFnPtr == nullptr))){
+         // Inactive levels: high for the active low pins, low for the active high pins
+         otptPinsHghMsk = _otptPinsMsk & ~_otptPinsActHghMsk;
+         _wrtOtptPins(otptPinsHghMsk, _otptPinsMsk & ~otptPinsHghMsk);
+         _otptPinsActvMsk = 0;
+         _otptPinsWrttn = true;
+         // Registered only when the pins were written by the request, otherwise there's no reaction to measure
+         otptsOffTmUs = static_cast<uint32_t>(esp_timer_get_time() - rqstTmUs);
+         if(_emrgncyStpStts.maxOtptsOffTmUs < otptsOffTmUs)
+            _emrgncyStpStts.maxOtptsOffTmUs = otptsOffTmUs;
       }
-		//---------------->> Functions related actions
-		if(_fnWhnTrnOnLtchRls != nullptr)
-			_fnWhnTrnOnLtchRls(_fnWhnTrnOnLtchRlsArg);
-	   //---------------->> Flags related actions
-		taskENTER_CRITICAL(&mux);
-      _ltchRlsIsOn = true;
-		setLsSwtchOtptsChng(true);
-		taskEXIT_CRITICAL(&mux);
-	} 
+   }
 
    return;
 }
 
-void LimbsSftyLnFSwtch::_turnOnPrdCycl(){
-   portMUX_TYPE mux portMUX_INITIALIZER_UNLOCKED;
-   
-   if(!_prdCyclIsOn){
-      //---------------->> Tasks related actions
-      //---------------->> Specific Task for Latch Release turned off related actions
-      if(getTskToNtfyTrnOnPrdCycl() != NULL){
-         xReturned = xTaskNotify(
-            getTskToNtfyTrnOnPrdCycl(),	// TaskHandle_t of the task receiving notification
-            static_cast<uint32_t>(0x00),
-            eSetValueWithOverwrite	// In this specific case using eSetBits is also a valid option
-         );
-         if (xReturned != pdPASS)
-            errorFlag = pdTRUE;
-      }
-		//---------------->> Functions related actions
-		if(_fnWhnTrnOnPrdCycl != nullptr)
-			_fnWhnTrnOnPrdCycl(_fnWhnTrnOnPrdCyclArg);
-	   //---------------->> Flags related actions
-		taskENTER_CRITICAL(&mux);
-      _prdCyclIsOn = true;
-		setLsSwtchOtptsChng(true);
-		taskEXIT_CRITICAL(&mux);
-	}
+void LimbsSftyLnFSwtch::rstPrdSttstcs(){
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   _prdCyclsQty = 0;
+   _prdBthHndsMssdQty = 0;
+   _prdCyclStrtd = false;
+   _prdSmpls = {};
+   taskEXIT_CRITICAL(&_lsSwtchMux);
+   taskENTER_CRITICAL(&_prdSttstcsMux);
+   _prdCyclPrdSttstc.rst();
+   _prdIdleTmSttstc.rst();
+   _prdRctnTmSttstc.rst();
+   taskEXIT_CRITICAL(&_prdSttstcsMux);
 
    return;
 }
 
-unsigned long int LimbsSftyLnFSwtch::_updCurTimeMs(){
-   _curTimeMs = xTaskGetTickCount() / portTICK_RATE_MS;
+void LimbsSftyLnFSwtch::rstPrfHstgrms(){
+#if _lsSwtchPrfInstr
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   for(uint8_t prfStgId{0}; prfStgId < _prfStgsQty; ++prfStgId)
+      _prfHstgrm[prfStgId] = {};
+   for(uint8_t frmStt{0}; frmStt < _fdaSttsQty; ++frmStt){
+      _wcetStt[frmStt] = {};
+      for(uint8_t toStt{0}; toStt < _fdaSttsQty; ++toStt)
+         _wcetTrnstn[frmStt][toStt] = {};
+   }
+   taskEXIT_CRITICAL(&_lsSwtchMux);
+#endif
 
-   return _curTimeMs;
+   return;
 }
 
-void LimbsSftyLnFSwtch::_updFdaState(){
-   portMUX_TYPE mux portMUX_INITIALIZER_UNLOCKED;
+void LimbsSftyLnFSwtch::_rstOtptsChngCnt(){
+   _lsSwtchOtptsChngCnt = 0;
 
-	taskENTER_CRITICAL(&mux);
-	switch(_lsSwtchFdaState){
-		case stOffNotBHP:
-			//In: >>---------------------------------->>
-			if(_sttChng){
-				clrStatus();
-				_clrSttChng();
-			}	// Execute this code only ONCE, when entering this state
-			//Do: >>---------------------------------->>         
-			if(_lftHndSwtchStts.isOn && _rghtHndSwtchStts.isOn){
-            _lsSwtchFdaState = stOffBHPNotFP;
-				_setSttChng();	//Set flag to execute exiting OUT code
-			}
-			//Out: >>---------------------------------->>
-			if(_sttChng){
-            _undrlFtMPBPtr->enable(); // Enable FtSwitch
-         }	// Execute this code only ONCE, when exiting this state
-			break;
+   return;
+}
 
-		case stOffBHPNotFP:
-			//In: >>---------------------------------->>
-			if(_sttChng){
-            _clrSttChng();}	// Execute this code only ONCE, when entering this state
-			//Do: >>---------------------------------->>
-			if(!(_lftHndSwtchStts.isOn && _rghtHndSwtchStts.isOn)){
-            _undrlFtMPBPtr->disable(); // Disable FtSwitch
-            _ackBthHndsOnMssd();
-            _lsSwtchFdaState = stOffNotBHP;
-            _setSttChng();
-         }
-         else{
-            // Check the foot switch release signal ok flag
-            if(_ltchRlsPndng){
-               _ltchRlsPndng = false;
-               _undrlLftHndMPBPtr->setIsOnDisabled(false);
-               if(_lftHndBhvrCfg.swtchIsEnbld)
-                  _undrlLftHndMPBPtr->disable();
-               _undrlRghtHndMPBPtr->setIsOnDisabled(false);
-               if(_rghtHndBhvrCfg.swtchIsEnbld)
-                  _undrlRghtHndMPBPtr->disable();
-               _undrlFtMPBPtr->disable();
-               _lsSwtchFdaState = stStrtRlsStrtCycl;
-               _setSttChng();
-            }
-         }
-			//Out: >>---------------------------------->>
+void LimbsSftyLnFSwtch::_rstTmSrcWrp(){
+   taskENTER_CRITICAL(&_tmSrcMux);
+   _tmSrcLstMs = 0;
+   _tmSrcMsHgh = 0;
+   taskEXIT_CRITICAL(&_tmSrcMux);
+
+   return;
+}
+
+bool LimbsSftyLnFSwtch::setCbDsptchd(const bool &newVal, const limbSftyFwConf_t &dsptchTskCnfg){
+   bool result{false};
+
+   if(_lsSwtchPollTmrHndl == NULL){
+      _cbDsptchd = newVal;
+      _cbDsptchTskCnfg = dsptchTskCnfg;
+      result = true;
+   }
+
+   return result;
+}
+
+bool LimbsSftyLnFSwtch::setEmrgncyStpPin(const swtchInptHwCfg_t &emrgncyStpInptCfg){
+   bool result{false};
+
+   if((_lsSwtchPollTmrHndl == NULL) && !_emrgncyStpIsrAttchd && (_otptPinsWrtFnPtr == nullptr) && (emrgncyStpInptCfg.inptPin >= 0) && (emrgncyStpInptCfg.inptPin <= _maxValidPinNum)){
+      // The active level is the opposite of the idle level set by the pull resistor and switch type
+      _emrgncyStpIsrArg = {this, emrgncyStpInptId, static_cast<uint8_t>(emrgncyStpInptCfg.inptPin), emrgncyStpInptCfg.pulledUp != emrgncyStpInptCfg.typeNO, emrgncyStpInptCfg.pulledUp};
+      result = true;
+   }
+
+   return result;
+}
+
+bool LimbsSftyLnFSwtch::setEvntDrvn(const bool &newVal){
+   bool result{false};
+
+   if((_lsSwtchPollTmrHndl == NULL) && !_lsSwtchGrpd){
+      _evntDrvn = newVal;
+      _undrlSwtchsMdld = newVal;
+      result = true;
+   }
+
+   return result;
+}
+
+void LimbsSftyLnFSwtch::setFnWhnBthHndsOnMssd(fncVdPtrPrmPtrType &newFnWhnBthHndsOnMssd){
+   if(_fnWhnBthHndsOnMssd != newFnWhnBthHndsOnMssd)
+      _fnWhnBthHndsOnMssd = newFnWhnBthHndsOnMssd;
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::setFnWhnTrnOffLtchRlsPtr(fncVdPtrPrmPtrType &newFnWhnTrnOff){
+   if(_fnWhnTrnOffLtchRls != newFnWhnTrnOff)
+      _fnWhnTrnOffLtchRls = newFnWhnTrnOff;
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::setFnWhnTrnOffPrdCyclPtr(fncVdPtrPrmPtrType &newFnWhnTrnOff){
+   if(_fnWhnTrnOffPrdCycl != newFnWhnTrnOff)
+      _fnWhnTrnOffPrdCycl = newFnWhnTrnOff;
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::setFnWhnTrnOnLtchRlsPtr(fncVdPtrPrmPtrType &newFnWhnTrnOn){
+   if(_fnWhnTrnOnLtchRls != newFnWhnTrnOn)
+      _fnWhnTrnOnLtchRls = newFnWhnTrnOn;
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::setFnWhnTrnOnPrdCyclPtr(fncVdPtrPrmPtrType &newFnWhnTrnOn){
+   if(_fnWhnTrnOnPrdCycl != newFnWhnTrnOn)
+      _fnWhnTrnOnPrdCycl = newFnWhnTrnOn;
+
+   return;
+}
+
+bool LimbsSftyLnFSwtch::setLtchRlsTtlTm(const unsigned long int &newVal){
+   bool result{true};
+
+   if (_ltchRlsTtlTm != newVal){
+      if((newVal > 0) && (newVal <= _prdCyclTtlTm))
+         _ltchRlsTtlTm = newVal;
+      else
+         result = false;
+   }
+
+   return result;
+}
+
+void LimbsSftyLnFSwtch::setLsSwtchOtptsChng(bool newLsSwtchOtptsChng){
+	taskENTER_CRITICAL(&_lsSwtchMux);
+	if(newLsSwtchOtptsChng)
+		++_lsSwtchOtptsChngCnt;
+	else
+		if(_lsSwtchOtptsChngCnt)
+			--_lsSwtchOtptsChngCnt;
+	if(_lsSwtchOtptsChngCnt)
+		_lsSwtchOtptsChng = true;
+	else
+		_lsSwtchOtptsChng = false;
+	taskEXIT_CRITICAL(&_lsSwtchMux);
+
+   return;
+}
+
+bool LimbsSftyLnFSwtch::setOtptPins(const gpioPinOtptHwCfg_t &ltchRlsIsOnPin, const gpioPinOtptHwCfg_t &prdCyclIsOnPin){
+   bool result{false};
+   const gpioPinOtptHwCfg_t otptPins[2]{ltchRlsIsOnPin, prdCyclIsOnPin};
+   uint64_t otptPinMsk[2]{0, 0};
+   uint64_t otptPinsActHghMsk{0};
+
+   if(_lsSwtchPollTmrHndl == NULL){
+      result = true;
+      for(uint8_t otptIdx{0}; otptIdx < 2; ++otptIdx){
+         if(otptPins[otptIdx].gpioOtptPin != _InvalidPinNum){
+            if((otptPins[otptIdx].gpioOtptPin < 0) || (otptPins[otptIdx].gpioOtptPin > _maxValidPinNum)){
+               result = false;
+            }
+            else{
+               otptPinMsk[otptIdx] = static_cast<uint64_t>(1) << otptPins[otptIdx].gpioOtptPin;
+               if(otptPins[otptIdx].gpioOtptActHgh)
+                  otptPinsActHghMsk |= otptPinMsk[otptIdx];
+            }
+         }
+      }
+      if((otptPinMsk[0] & otptPinMsk[1]) != 0)
+         result = false;
+      if(result){
+         if(_otptPinsWrtFnPtr == nullptr){
+            for(uint8_t otptIdx{0}; otptIdx < 2; ++otptIdx){
+               if(otptPinMsk[otptIdx] != 0){
+                  // The inactive level is set before the output driver is enabled, so the pin never shows a spurious active level
+                  pinMode(otptPins[otptIdx].gpioOtptPin, INPUT);
+                  digitalWrite(otptPins[otptIdx].gpioOtptPin, (otptPins[otptIdx].gpioOtptActHgh)?LOW:HIGH);
+                  pinMode(otptPins[otptIdx].gpioOtptPin, OUTPUT);
+               }
+            }
+         }
+         taskENTER_CRITICAL(&_lsSwtchMux);
+         _ltchRlsOtptPinMsk = otptPinMsk[0];
+         _prdCyclOtptPinMsk = otptPinMsk[1];
+         _otptPinsMsk = otptPinMsk[0] | otptPinMsk[1];
+         _otptPinsActHghMsk = otptPinsActHghMsk;
+         _otptPinsWrttn = false;
+         _updOtptPins();
+         taskEXIT_CRITICAL(&_lsSwtchMux);
+      }
+   }
+
+   return result;
+}
+
+bool LimbsSftyLnFSwtch::setOtptPinsWrtr(fncOtptPinsWrtPtrType newOtptPinsWrtr, void* newOtptPinsWrtrArg){
+   bool result{false};
+
+   // The emergency stop ISR writes the GPIO registers directly, a writer function can't be set while the emergency stop input is set
+   if((newOtptPinsWrtr == nullptr) || (_emrgncyStpIsrArg.lsSwtchObj == nullptr)){
+      taskENTER_CRITICAL(&_lsSwtchMux);
+      _otptPinsWrtFnPtr = newOtptPinsWrtr;
+      _otptPinsWrtArgPtr = newOtptPinsWrtrArg;
+      taskEXIT_CRITICAL(&_lsSwtchMux);
+      result = true;
+   }
+
+   return result;
+}
+
+bool LimbsSftyLnFSwtch::setPhsTmrDrvn(const bool &newVal){
+   bool result{false};
+
+   if((_lsSwtchPollTmrHndl == NULL) && !_lsSwtchGrpd){
+      _phsTmrDrvn = newVal;
+      result = true;
+   }
+
+   return result;
+}
+
+bool LimbsSftyLnFSwtch::setPrdCyclTtlTm(const unsigned long int &newVal){
+   bool result{true};
+
+   if(_prdCyclTtlTm != newVal){
+      if((newVal > 0) && (newVal >= _ltchRlsTtlTm))
+         _prdCyclTtlTm = newVal;
+      else
+         result = false;
+   }
+   
+   return result;
+}
+
+void LimbsSftyLnFSwtch::_setSttChng(){
+   _sttChng = true;
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::setTmSrc(fncTmSrcPtrType newTmSrc, void* newTmSrcArg){
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   _tmSrcFnPtr = newTmSrc;
+   _tmSrcUsFnPtr = nullptr;
+   _tmSrcArgPtr = newTmSrcArg;
+   _rstTmSrcWrp();
+   taskEXIT_CRITICAL(&_lsSwtchMux);
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::setTmSrcUs(fncTmSrcUsPtrType newTmSrcUs, void* newTmSrcArg){
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   _tmSrcUsFnPtr = newTmSrcUs;
+   _tmSrcFnPtr = nullptr;
+   _tmSrcArgPtr = newTmSrcArg;
+   taskEXIT_CRITICAL(&_lsSwtchMux);
+
+   return;
+}
+
+bool LimbsSftyLnFSwtch::setTrnstnRcrdd(const bool &newVal){
+   bool result{false};
+
+   if(_lsSwtchPollTmrHndl == NULL){
+      _trnstnRcrdd = newVal;
+      result = true;
+   }
+
+   return result;
+}
+
+void LimbsSftyLnFSwtch::setTrnOffLtchRlsArgPtr(void *&newVal){
+   if(_fnWhnTrnOffLtchRlsArg != newVal)
+      _fnWhnTrnOffLtchRlsArg = newVal;
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::setTrnOffPrdCyclArgPtr(void* &newVal){
+   if(_fnWhnTrnOffPrdCyclArg != newVal)
+      _fnWhnTrnOffPrdCyclArg = newVal;
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::setTrnOnLtchRlsArgPtr(void* &newVal){
+   if(_fnWhnTrnOnLtchRlsArg != newVal)
+      _fnWhnTrnOnLtchRlsArg = newVal;
+
+   return;
+}
+	
+void LimbsSftyLnFSwtch::setTrnOnPrdCyclArgPtr(void* &newVal){
+   if(_fnWhnTrnOnPrdCyclArg != newVal)
+      _fnWhnTrnOnPrdCyclArg = newVal;
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_setTskToNtfy(TaskHandle_t &tskToNtfy, const TaskHandle_t &newTaskHandle, const uint32_t &edgBit){
+   TaskHandle_t prvTskToNtfy{NULL};
+	eTaskState taskToNtfyStt{};
+   uint8_t sbscrbrIdx{_ntfySbscrbrsQty};
+
+   // Only the handle swap is done holding the lock, the replaced task is suspended after releasing it
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   if(tskToNtfy != newTaskHandle){
+      prvTskToNtfy = tskToNtfy;
+      tskToNtfy = newTaskHandle;
+      // The task is notified through its subscribers table entry, that holds the event edge bit
+      if(prvTskToNtfy != NULL){
+         sbscrbrIdx = _getNtfySbscrbr(prvTskToNtfy, false);
+         if(sbscrbrIdx < _ntfySbscrbrsQty){
+            _ntfySbscrbr[sbscrbrIdx].lgcyEdgsMsk &= ~edgBit;
+            _updNtfySbscrbr(sbscrbrIdx);
+         }
+      }
+      if(newTaskHandle != NULL){
+         sbscrbrIdx = _getNtfySbscrbr(newTaskHandle, true);
+         if(sbscrbrIdx < _ntfySbscrbrsQty){
+            _ntfySbscrbr[sbscrbrIdx].lgcyEdgsMsk |= edgBit;
+            _updNtfySbscrbr(sbscrbrIdx);
+         }
+      }
+   }
+   taskEXIT_CRITICAL(&_lsSwtchMux);
+   if(prvTskToNtfy != NULL){
+      taskToNtfyStt = eTaskGetState(prvTskToNtfy);
+      if (taskToNtfyStt != eSuspended){
+         if(taskToNtfyStt != eDeleted)
+            vTaskSuspend(prvTskToNtfy);
+      }
+   }
+
+	return;
+}
+
+void LimbsSftyLnFSwtch::setTskToNtfyBthHndsOnMssd(const TaskHandle_t &newTaskHandle){
+   _setTskToNtfy(_tskToNtfyBthHndsOnMssd, newTaskHandle, bthHndsOnMssdEdgBit);
+
+	return;
+}
+
+void LimbsSftyLnFSwtch::setTskToNtfyLsSwtchOtptsChng(const TaskHandle_t &newTaskHandle){
+   _setTskToNtfy(_tskToNtfyLsSwtchOtptsChng, newTaskHandle, lsSwtchOtptsChngEdgBit);
+
+	return;
+}
+
+void LimbsSftyLnFSwtch::setTskToNtfyTrnOffLtchRls(const TaskHandle_t &newTaskHandle){
+   _setTskToNtfy(_tskToNtfyTrnOffLtchRls, newTaskHandle, ltchRlsTrnOffEdgBit);
+
+	return;
+}
+
+void LimbsSftyLnFSwtch::setTskToNtfyTrnOffPrdCycl(const TaskHandle_t &newTaskHandle){
+   _setTskToNtfy(_tskToNtfyTrnOffPrdCycl, newTaskHandle, prdCyclTrnOffEdgBit);
+
+	return;
+}
+
+void LimbsSftyLnFSwtch::setTskToNtfyTrnOnLtchRls(const TaskHandle_t &newTaskHandle){
+   _setTskToNtfy(_tskToNtfyTrnOnLtchRls, newTaskHandle, ltchRlsTrnOnEdgBit);
+
+	return;
+}
+
+void LimbsSftyLnFSwtch::setTskToNtfyTrnOnPrdCycl(const TaskHandle_t &newTaskHandle){
+   _setTskToNtfy(_tskToNtfyTrnOnPrdCycl, newTaskHandle, prdCyclTrnOnEdgBit);
+
+	return;
+}
+
+void LimbsSftyLnFSwtch::_setUndrlSwtchEnbld(const uint8_t &inptId, const bool &newVal){
+   DbncdMPBttn* undrlSwtchPtr{_getUndrlSwtchPtr(inptId)};
+
+   if(undrlSwtchPtr != nullptr){
+      if(newVal)
+         undrlSwtchPtr->enable();
+      else
+         undrlSwtchPtr->disable();
+      // Keep the behavior model commanded state updated, a switch re-enabled while pressed requires an effective release
+      if(newVal && !_undrlSwtchsMdl[inptId].isEnbld && _undrlSwtchsMdl[inptId].isPrssd)
+         _undrlSwtchsMdl[inptId].rlsPndng = true;
+      _undrlSwtchsMdl[inptId].isEnbld = newVal;
+   }
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_setUndrlSwtchInptLvl(const uint8_t &inptId, const bool &isPrssd, const unsigned long int &evntTm){
+   if(inptId <= ftInptId){
+      if(_undrlSwtchsMdl[inptId].inptPrssd != isPrssd){
+         _undrlSwtchsMdl[inptId].inptPrssd = isPrssd;
+         _undrlSwtchsMdl[inptId].inptChngTm = evntTm;
+      }
+   }
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_setUndrlSwtchIsOnDsbld(const uint8_t &inptId, const bool &newVal){
+   DbncdMPBttn* undrlSwtchPtr{_getUndrlSwtchPtr(inptId)};
+
+   if(undrlSwtchPtr != nullptr){
+      undrlSwtchPtr->setIsOnDisabled(newVal);
+      _undrlSwtchsMdl[inptId].isOnDsbld = newVal;
+   }
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_setUndrlSwtchPrssd(const uint8_t &inptId, const bool &isPrssd, const unsigned long int &evntTm){
+   if(inptId <= ftInptId){
+      if(_undrlSwtchsMdl[inptId].isPrssd != isPrssd){
+         _undrlSwtchsMdl[inptId].isPrssd = isPrssd;
+         if(isPrssd)
+            _undrlSwtchsMdl[inptId].prssdTm = evntTm;
+      }
+      // A debounced level overrides any input level change still pending
+      _undrlSwtchsMdl[inptId].inptPrssd = isPrssd;
+   }
+
+   return;
+}
+
+bool LimbsSftyLnFSwtch::setUndrlSwtchsPollDelay(const unsigned long int &newVal){
+   bool result{false};
+   
+   if(_minPollDelay <= newVal){
+      _undrlSwtchsPollDelay = newVal;
+      result = true;
+   }
+
+   return result;
+}
+
+bool LimbsSftyLnFSwtch::setWcetLckHldBndUs(const uint32_t &bndUs){
+   bool result{false};
+
+#if _lsSwtchPrfInstr
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   _wcetLckHldBndTcks = bndUs * getPrfTcksPerUs();
+   taskEXIT_CRITICAL(&_lsSwtchMux);
+   result = true;
+#endif
+
+   return result;
+}
+
+bool LimbsSftyLnFSwtch::trgrEmrgncyStp(){
+   bool result{true};
+
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   _rqstEmrgncyStp(false);
+   taskEXIT_CRITICAL(&_lsSwtchMux);
+   // Objects not started are stopped by their next update
+   if((_lsSwtchPollTmrHndl != NULL) || _lsSwtchGrpd){
+      if(xTimerPendFunctionCall(_emrgncyStpCb, this, 0, 0) != pdPASS)
+         result = false;
+   }
+
+   return result;
+}
+
+void LimbsSftyLnFSwtch::_turnOffLtchRls(){
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   if(_ltchRlsIsOn){
+      _ltchRlsIsOn = false;
+      setLsSwtchOtptsChng(true);
+      // Tasks notification and function execution deferred until the object lock is released
+      _pndngActns |= actnTrnOffLtchRls;
+   }
+   taskEXIT_CRITICAL(&_lsSwtchMux);
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_turnOffPrdCycl(){
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   if(_prdCyclIsOn){
+      _prdCyclIsOn = false;
+      _updPrdSttstcsCyclEnd();
+      setLsSwtchOtptsChng(true);
+      // Tasks notification and function execution deferred until the object lock is released
+      _pndngActns |= actnTrnOffPrdCycl;
+   }
+   taskEXIT_CRITICAL(&_lsSwtchMux);
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_turnOnLtchRls(){
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   if(!_ltchRlsIsOn){
+      _ltchRlsIsOn = true;
+      setLsSwtchOtptsChng(true);
+      // Tasks notification and function execution deferred until the object lock is released
+      _pndngActns |= actnTrnOnLtchRls;
+   }
+   taskEXIT_CRITICAL(&_lsSwtchMux);
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_turnOnPrdCycl(){
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   if(!_prdCyclIsOn){
+      _prdCyclIsOn = true;
+      _updPrdSttstcsCyclStrt();
+      setLsSwtchOtptsChng(true);
+      // Tasks notification and function execution deferred until the object lock is released
+      _pndngActns |= actnTrnOnPrdCycl;
+   }
+   taskEXIT_CRITICAL(&_lsSwtchMux);
+
+   return;
+}
+
+unsigned long int LimbsSftyLnFSwtch::_updCurTimeMs(){
+   uint32_t tmSrcMs{0};
+
+   // The FDA phases are timed in microseconds, the milliseconds time base is kept for the underlying switches behavior model
+   if(_tmSrcUsFnPtr != nullptr)
+      _curTimeUs = _tmSrcUsFnPtr(_tmSrcArgPtr);
+   else if(_tmSrcFnPtr != nullptr){
+      // The 32 bits milliseconds counter wraps around every 49.7 days, it's extended to 64 bits so the time base never goes backwards. The source is read and the wrap tracked under their own lock, the method is executed by the update and the timer service tasks
+      taskENTER_CRITICAL(&_tmSrcMux);
+      tmSrcMs = static_cast<uint32_t>(_tmSrcFnPtr(_tmSrcArgPtr));
+      if(tmSrcMs < _tmSrcLstMs)
+         _tmSrcMsHgh += 0x100000000ULL;
+      _tmSrcLstMs = tmSrcMs;
+      _curTimeUs = (_tmSrcMsHgh + tmSrcMs) * 1000ULL;
+      taskEXIT_CRITICAL(&_tmSrcMux);
+   }
+   else
+      _curTimeUs = static_cast<uint64_t>(esp_timer_get_time());
+   _curTimeMs = static_cast<unsigned long int>(_curTimeUs / 1000ULL);
+
+   return _curTimeMs;
+}
+
+void LimbsSftyLnFSwtch::_updFdaState(){
+	taskENTER_CRITICAL(&_lsSwtchMux);
+   // An emergency stop request not yet served by its deferred call is served before any other transition
+   _entrEmrgncyStp();
+   switch(_lsSwtchFdaState){
+		case stOffNotBHP:
+			//In: >>---------------------------------->>
+			if(_sttChng){
+				clrStatus();
+				_clrSttChng();
+			}	// Execute this code only ONCE, when entering this state
+			//Do: >>---------------------------------->>         
+			if(_lftHndSwtchStts.isOn && _rghtHndSwtchStts.isOn){
+            _lsSwtchFdaState = stOffBHPNotFP;
+				_setSttChng();	//Set flag to execute exiting OUT code
+			}
+			//Out: >>---------------------------------->>
+			if(_sttChng){
+            _bthHndsOnTmUs = _curTimeUs;
+            _setUndrlSwtchEnbld(ftInptId, true); // Enable FtSwitch
+         }	// Execute this code only ONCE, when exiting this state
+			break;
+
+		case stOffBHPNotFP:
+			//In: >>---------------------------------->>
+			if(_sttChng){
+            _clrSttChng();}	// Execute this code only ONCE, when entering this state
+			//Do: >>---------------------------------->>
+			if(!(_lftHndSwtchStts.isOn && _rghtHndSwtchStts.isOn)){
+            _setUndrlSwtchEnbld(ftInptId, false); // Disable FtSwitch
+            _ackBthHndsOnMssd();
+            _lsSwtchFdaState = stOffNotBHP;
+            _setSttChng();
+         }
+         else{
+            // Check the foot switch release signal ok flag
+            if(_ltchRlsPndng){
+               _ltchRlsPndng = false;
+               _setUndrlSwtchIsOnDsbld(lftHndInptId, false);
+               if(_lftHndBhvrCfg.swtchIsEnbld)
+                  _setUndrlSwtchEnbld(lftHndInptId, false);
+               _setUndrlSwtchIsOnDsbld(rghtHndInptId, false);
+               if(_rghtHndBhvrCfg.swtchIsEnbld)
+                  _setUndrlSwtchEnbld(rghtHndInptId, false);
+               _setUndrlSwtchEnbld(ftInptId, false);
+               _lsSwtchFdaState = stStrtRlsStrtCycl;
+               _setSttChng();
+            }
+         }
+			//Out: >>---------------------------------->>
+			if(_sttChng){}	// Execute this code only ONCE, when exiting this state
+			break;
+
+		case stStrtRlsStrtCycl:
+			//In: >>---------------------------------->>
+			if(_sttChng){
+            _prdCyclTmrStrtUs = _curTimeUs;
+            _clrSttChng();}	// Execute this code only ONCE, when entering this state
+			//Do: >>---------------------------------->>
+			_turnOnLtchRls();
+         _turnOnPrdCycl();
+         _lsSwtchFdaState = stEndRls;
+			_setSttChng();
+			//Out: >>---------------------------------->>
+			if(_sttChng){}	// Execute this code only ONCE, when exiting this state
+         break;
+
+		case stEndRls:
+			//In: >>---------------------------------->>
+			if(_sttChng){_clrSttChng();}	// Execute this code only ONCE, when entering this state
+			//Do: >>---------------------------------->>
+         if((_curTimeUs - _prdCyclTmrStrtUs) >= (_ltchRlsTtlTm * 1000ULL)){
+            _turnOffLtchRls();
+            _lsSwtchFdaState = stEndCycl;
+			   _setSttChng();
+         }
+			//Out: >>---------------------------------->>
+			if(_sttChng){}	// Execute this code only ONCE, when exiting this state
+			break;
+
+		case stEndCycl:
+			//In: >>---------------------------------->>
+			if(_sttChng){_clrSttChng();}	// Execute this code only ONCE, when entering this state
+			//Do: >>---------------------------------->>
+         if((_curTimeUs - _prdCyclTmrStrtUs) >= (_prdCyclTtlTm * 1000ULL)){
+            _turnOffPrdCycl();
+            // Restore modified isOnDisabled, isEnabled for the underlying switches
+            _setUndrlSwtchIsOnDsbld(lftHndInptId, true);
+            if(_lftHndBhvrCfg.swtchIsEnbld)
+               _setUndrlSwtchEnbld(lftHndInptId, true);
+            _setUndrlSwtchIsOnDsbld(rghtHndInptId, true);
+            if(_rghtHndBhvrCfg.swtchIsEnbld)
+               _setUndrlSwtchEnbld(rghtHndInptId, true);
+            _lsSwtchFdaState = stOffNotBHP;
+            _setSttChng();
+         }
+			//Out: >>---------------------------------->>
+			if(_sttChng){}	// Execute this code only ONCE, when exiting this state
+			break;
+
+		case stEmrgncyExcpHndl:
+			//In: >>---------------------------------->>
+			if(_sttChng){_clrSttChng();}	// Execute this code only ONCE, when entering this state
+			//Do: >>---------------------------------->>
+         // Outputs kept off until the rcvrEmrgncyStp() recovery moves the FDA to the stOffNotBHP state
+			//Out: >>---------------------------------->>
 			if(_sttChng){}	// Execute this code only ONCE, when exiting this state
 			break;
 
-		case stStrtRlsStrtCycl:
-			//In: >>---------------------------------->>
-			if(_sttChng){
-            _prdCyclTmrStrt= _curTimeMs;
-            _clrSttChng();}	// Execute this code only ONCE, when entering this state
-			//Do: >>---------------------------------->>
-			_turnOnLtchRls();
-         _turnOnPrdCycl();
-         _lsSwtchFdaState = stEndRls;
-			_setSttChng();
-			//Out: >>---------------------------------->>
-			if(_sttChng){}	// Execute this code only ONCE, when exiting this state
-         break;
+      default:
+         break;
+   }
+	taskEXIT_CRITICAL(&_lsSwtchMux);
+
+	return;
+}
+
+void LimbsSftyLnFSwtch::_updGrpdLsSwtch(const uint64_t &gpioInptsLvl, const bool &inptsDbncd){
+   bool inptPrssd{false};
+
+   // The inputs levels are sampled once for all the group's objects, only the pins bits are extracted here
+   _updCurTimeMs();
+   for(uint8_t inptId{lftHndInptId}; inptId <= ftInptId; ++inptId){
+      inptPrssd = (((gpioInptsLvl >> _inptIsrArg[inptId].inptPin) & 1) != 0) == _inptIsrArg[inptId].prssdLvl;
+      if(inptsDbncd)
+         _setUndrlSwtchPrssd(inptId, inptPrssd, _curTimeMs);
+      else
+         _setUndrlSwtchInptLvl(inptId, inptPrssd, _curTimeMs);
+   }
+   _updLsSwtch();
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_updLsSwtch(){
+#if _lsSwtchPrfInstr
+   uint32_t prfStgTcks[_prfStgsQty]{};
+   const uint32_t prfUpdStrtTcks{_getPrfTcks()};
+   uint32_t prfLapStrtTcks{prfUpdStrtTcks};
+   fdaStpPrf_t prfFdaStps[_maxFdaStpsPerUpd]{};
+   uint8_t prfFdaStpsQty{0};
+#endif
+
+   if(_evntDrvn && _inptRsmplPndng){
+      _updCurTimeMs();
+      _lsSwtchPrfLap(curTmPrfStgId);
+      _rdUndrlSwtchsInpts();
+      _lsSwtchPrfLap(undrlSwtchsPrfStgId);
+   }
+	taskENTER_CRITICAL(&_lsSwtchMux);
+#if _lsSwtchPrfInstr
+   // The lock acquisition wait is timed only as part of the whole update
+   const uint32_t prfLckStrtTcks{_getPrfTcks()};
+   const uint8_t prfUpdFrmStt{static_cast<uint8_t>(_lsSwtchFdaState)};
+   prfLapStrtTcks = prfLckStrtTcks;
+#endif
+   if(_undrlSwtchsMdld){
+      // Set the time base for Flags, Triggers and Timers calculation & update
+      _updCurTimeMs();
+      _lsSwtchPrfLap(curTmPrfStgId);
+      //------------
+      // Underlying switches status computed by the behavior model from the inputs levels
+      _updUndrlSwtchsDbnc();
+      _updUndrlSwtchsMdl();
+      _getUndrlSwtchStts();
+      _lsSwtchPrfLap(undrlSwtchsPrfStgId);
+   }
+   else{
+      // Underlying switches status recovery
+      _getUndrlSwtchStts();
+      _lsSwtchPrfLap(undrlSwtchsPrfStgId);
+      //------------
+      // Set the time base for Flags, Triggers and Timers calculation & update
+      _updCurTimeMs();
+      _lsSwtchPrfLap(curTmPrfStgId);
+   }
+   //------------
+	// State machine update
+ 	_lsSwtchPrfFdaStp();
+   // In the event driven mode the FDA is run to completion, the state transitions are not delayed to the next timer expiration
+   for(uint8_t fdaStpsQty{1}; _evntDrvn && _sttChng && (fdaStpsQty < _maxFdaStpsPerUpd); ++fdaStpsQty){
+      _getUndrlSwtchStts();
+      _lsSwtchPrfFdaStp();
+   }
+   // Output stage written right after the FDA step, still holding the object lock
+   _updOtptPins();
+   _lsSwtchPrfLap(fdaPrfStgId);
+   // Underlying switches commanded states might have been changed by the State machine
+   _getUndrlSwtchStts();
+   _lsSwtchPrfLap(undrlSwtchsPrfStgId);
+   _pblshSttsSnpsht();
+   _lsSwtchPrfLap(sttsPblshPrfStgId);
+#if _lsSwtchPrfInstr
+   prfStgTcks[lckHldPrfStgId] = prfLapStrtTcks - prfLckStrtTcks;
+#endif
+ 	taskEXIT_CRITICAL(&_lsSwtchMux);
+   // Tasks notifications and functions executions produced by the State machine, executed without holding the object lock
+   _exctPndngActns();
+   if(_phsTmrDrvn)
+      _updPhsTmrStt();
+   if(_evntDrvn || _phsTmrDrvn)
+      _updPollTmrStt();
+
+	//Outputs update, function and tasks executions based on outputs changed generated by the State Machine
+      //---------------->> Generic Task for output changes related actions, notified with the subscribers by _exctPndngActns()
+	if (getLsSwtchOtptsChng() && (getTskToNtfyLsSwtchOtptsChng() != NULL))
+		setLsSwtchOtptsChng(false);
+   _lsSwtchPrfLap(ntfctnPrfStgId);
+#if _lsSwtchPrfInstr
+   prfStgTcks[updTtlPrfStgId] = prfLapStrtTcks - prfUpdStrtTcks;
+   _rcrdPrfSmpls(prfStgTcks, prfUpdFrmStt, prfFdaStps, prfFdaStpsQty);
+#endif
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_updNtfySbscrbr(const uint8_t &sbscrbrIdx){
+   const lsSwtchSbscrbr_t &sbscrbr{_ntfySbscrbr[sbscrbrIdx]};
+
+   // Executed holding the object lock, after an entry masks change: an entry with no mask set is freed
+   if((sbscrbr.edgsMsk | sbscrbr.lgcyEdgsMsk | sbscrbr.rsngEdgsMsk | sbscrbr.fllngEdgsMsk) != 0)
+      _ntfySbscrbrSlts |= static_cast<uint16_t>(1 << sbscrbrIdx);
+   else
+      _ntfySbscrbrSlts &= ~static_cast<uint16_t>(1 << sbscrbrIdx);
+   if(((sbscrbr.rsngEdgsMsk | sbscrbr.fllngEdgsMsk) == 0) && ((sbscrbr.lgcyEdgsMsk & lsSwtchOtptsChngEdgBit) == 0))
+      _sttsSbscrbrsToNtfy &= ~static_cast<uint16_t>(1 << sbscrbrIdx);
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_updOtptPins(){
+   uint64_t otptPinsActvMsk{0};
+   uint64_t otptPinsHghMsk{0};
+
+   if(_otptPinsMsk != 0){
+      otptPinsActvMsk = (_ltchRlsOtptPinMsk & (0 - static_cast<uint64_t>(_ltchRlsIsOn))) | (_prdCyclOtptPinMsk & (0 - static_cast<uint64_t>(_prdCyclIsOn)));
+      // A pending emergency stop request keeps the pins inactive until the FDA turns the outputs off
+      otptPinsActvMsk &= 0 - static_cast<uint64_t>(!_emrgncyStpPndng);
+      if(!_otptPinsWrttn || (otptPinsActvMsk != _otptPinsActvMsk)){
+         // High level for the active high pins when active and for the active low pins when inactive
+         otptPinsHghMsk = ~(otptPinsActvMsk ^ _otptPinsActHghMsk) & _otptPinsMsk;
+         _wrtOtptPins(otptPinsHghMsk, _otptPinsMsk & ~otptPinsHghMsk);
+         _otptPinsActvMsk = otptPinsActvMsk;
+         _otptPinsWrttn = true;
+      }
+   }
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_updPhsTmrStt(){
+   uint64_t phsDdlnUs{0};
+   uint64_t phsTmLftUs{1};
+
+   // Executed from the timer service task, the timer commands must not block
+   if(_lsSwtchPhsTmrHndl != NULL){
+      if((_lsSwtchFdaState == stEndRls) || (_lsSwtchFdaState == stEndCycl)){
+         phsDdlnUs = _prdCyclTmrStrtUs + (((_lsSwtchFdaState == stEndRls)?_ltchRlsTtlTm:_prdCyclTtlTm) * 1000ULL);
+         if(!_phsTmrArmd || (_phsTmrDdlnUs != phsDdlnUs)){
+            if(phsDdlnUs > _curTimeUs)
+               phsTmLftUs = phsDdlnUs - _curTimeUs;
+#if _lsSwtchStcAlloc
+            // The period is the time left to the deadline rounded up to the next tick, so the expiration never precedes the deadline
+            if(xTimerChangePeriod(_lsSwtchPhsTmrHndl, static_cast<TickType_t>((phsTmLftUs + (portTICK_PERIOD_MS * 1000ULL) - 1) / (portTICK_PERIOD_MS * 1000ULL)), 0) == pdPASS){
+#else
+            esp_timer_stop(_lsSwtchPhsTmrHndl);   // Fails harmlessly if the timer is not running
+            if(esp_timer_start_once(_lsSwtchPhsTmrHndl, phsTmLftUs) == ESP_OK){
+#endif
+               _phsTmrDdlnUs = phsDdlnUs;
+               _phsTmrArmd = true;
+            }
+            else
+               errorFlag = pdTRUE;
+         }
+      }
+      else if(_phsTmrArmd){
+         // The production cycle was ended before the deadline (i.e. resetFda())
+#if _lsSwtchStcAlloc
+         if(xTimerStop(_lsSwtchPhsTmrHndl, 0) != pdPASS)
+            errorFlag = pdTRUE;
+#else
+         esp_timer_stop(_lsSwtchPhsTmrHndl);
+#endif
+         _phsTmrArmd = false;
+      }
+   }
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_updPollTmrStt(){
+   bool pollRqrd{true};
+
+   // Executed from the timer service task, the timer commands must not block
+   if(_lsSwtchPollTmrHndl != NULL){
+      if(_evntDrvn)
+         pollRqrd = !_isQscnt();
+      else
+         pollRqrd = !_isPhsTmrWt();
+      if(!pollRqrd){
+         if(xTimerIsTimerActive(_lsSwtchPollTmrHndl) != pdFALSE){
+            if(xTimerStop(_lsSwtchPollTmrHndl, 0) != pdPASS)
+               errorFlag = pdTRUE;
+         }
+      }
+      else if(xTimerIsTimerActive(_lsSwtchPollTmrHndl) == pdFALSE){
+         if(xTimerStart(_lsSwtchPollTmrHndl, 0) != pdPASS)
+            errorFlag = pdTRUE;
+      }
+   }
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_updPrdSttstcsCyclEnd(){
+   // A production cycle started before the last statistics reset is not counted
+   if(_prdCyclStrtd){
+      ++_prdCyclsQty;
+      _prdCyclEndTmUs = _curTimeUs;
+   }
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_updPrdSttstcsCyclStrt(){
+   // Executed by the FDA when the production cycle starts under the object lock, the durations are only captured here and added to the summaries by _exctPndngActns() after the lock release
+   _prdSmpls.cyclPrdVld = _prdCyclStrtd;
+   if(_prdCyclStrtd)
+      _prdSmpls.cyclPrdUs = _curTimeUs - _prdLstCyclStrtTmUs;
+   _prdSmpls.idleTmVld = (_prdCyclsQty > 0);
+   if(_prdCyclsQty > 0)
+      _prdSmpls.idleTmUs = _curTimeUs - _prdCyclEndTmUs;
+   _prdSmpls.rctnTmUs = _curTimeUs - _bthHndsOnTmUs;
+   _prdSmpls.pndng = true;
+   _prdLstCyclStrtTmUs = _curTimeUs;
+   _prdCyclStrtd = true;
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_updUndrlSwtchsDbnc(){
+   unsigned long int dbncTm{0};
+
+   for(uint8_t inptId{lftHndInptId}; inptId <= ftInptId; ++inptId){
+      undrlSwtchMdl_t &undrlSwtchMdl = _undrlSwtchsMdl[inptId];
+
+      // The input level is accepted once it was kept stable for the debounce time
+      dbncTm = (inptId == lftHndInptId)?_lftHndInpCfg.dbncTime:((inptId == rghtHndInptId)?_rghtHndInpCfg.dbncTime:_ftInpCfg.dbncTime);
+      if((undrlSwtchMdl.inptPrssd != undrlSwtchMdl.isPrssd) && ((_curTimeMs - undrlSwtchMdl.inptChngTm) >= dbncTm))
+         _setUndrlSwtchPrssd(inptId, undrlSwtchMdl.inptPrssd, undrlSwtchMdl.inptChngTm + dbncTm);
+   }
+
+   return;
+}
+
+void LimbsSftyLnFSwtch::_updUndrlSwtchsMdl(){
+   unsigned long int strtDlyTm{0};
+
+   for(uint8_t inptId{lftHndInptId}; inptId <= ftInptId; ++inptId){
+      undrlSwtchMdl_t &undrlSwtchMdl = _undrlSwtchsMdl[inptId];
+
+      if(!undrlSwtchMdl.isPrssd)
+         undrlSwtchMdl.rlsPndng = false;
+      if(!undrlSwtchMdl.isEnbld){
+         undrlSwtchMdl.isOn = undrlSwtchMdl.isOnDsbld;
+         undrlSwtchMdl.isVdd = false;
+      }
+      else if(!undrlSwtchMdl.isPrssd || undrlSwtchMdl.rlsPndng){
+         undrlSwtchMdl.isOn = false;
+         undrlSwtchMdl.isVdd = false;
+      }
+      else{
+         strtDlyTm = (inptId == lftHndInptId)?_lftHndBhvrCfg.swtchStrtDlyTm:((inptId == rghtHndInptId)?_rghtHndBhvrCfg.swtchStrtDlyTm:_ftBhvrCfg.swtchStrtDlyTm);
+         if((_curTimeMs - undrlSwtchMdl.prssdTm) < strtDlyTm){
+            undrlSwtchMdl.isOn = false;
+            undrlSwtchMdl.isVdd = false;
+         }
+         else if(inptId == ftInptId){
+            // SnglSrvcVdblMPBttn: the isOn state is kept for one update only, then the switch stays voided until released
+            if(!undrlSwtchMdl.isOn && !undrlSwtchMdl.isVdd){
+               undrlSwtchMdl.isOn = true;
+               _setLtchRlsPndng();
+            }
+            else{
+               undrlSwtchMdl.isOn = false;
+               undrlSwtchMdl.isVdd = true;
+            }
+         }
+         else{
+            // TmVdblMPBttn: the isOn state is voided after the voiding time is consumed, until released
+            if((_curTimeMs - undrlSwtchMdl.prssdTm - strtDlyTm) >= ((inptId == lftHndInptId)?_lftHndBhvrCfg.swtchVdTm:_rghtHndBhvrCfg.swtchVdTm)){
+               undrlSwtchMdl.isOn = false;
+               undrlSwtchMdl.isVdd = true;
+            }
+            else{
+               undrlSwtchMdl.isOn = true;
+               undrlSwtchMdl.isVdd = false;
+            }
+         }
+      }
+   }
+
+   return;
+}
+
+void IRAM_ATTR LimbsSftyLnFSwtch::_wrtOtptPins(const uint64_t &stPinsMsk, const uint64_t &clrPinsMsk){
+   if(_otptPinsWrtFnPtr != nullptr){
+      _otptPinsWrtFnPtr(stPinsMsk, clrPinsMsk, _otptPinsWrtArgPtr);
+   }
+   else{
+      // Write 1 to set/write 1 to clear registers: every pin of a bank changes with a single store, no read-modify-write of the output register
+      if(static_cast<uint32_t>(stPinsMsk) != 0)
+         REG_WRITE(GPIO_OUT_W1TS_REG, static_cast<uint32_t>(stPinsMsk));
+      if(static_cast<uint32_t>(clrPinsMsk) != 0)
+         REG_WRITE(GPIO_OUT_W1TC_REG, static_cast<uint32_t>(clrPinsMsk));
+#if SOC_GPIO_PIN_COUNT > 32
+      if((stPinsMsk >> 32) != 0)
+         REG_WRITE(GPIO_OUT1_W1TS_REG, static_cast<uint32_t>(stPinsMsk >> 32));
+      if((clrPinsMsk >> 32) != 0)
+         REG_WRITE(GPIO_OUT1_W1TC_REG, static_cast<uint32_t>(clrPinsMsk >> 32));
+#endif
+   }
+
+   return;
+}
+
+bool LimbsSftyLnFSwtch::wtLsSwtchOtptsChng(uint32_t &otptsSttsPkgd, uint32_t &chngSeqNum, const TickType_t &tmOut){
+   bool result{false};
+   bool wtEnd{false};
+   uint8_t wtrSltIdx{_maxSttsWtrsQty};
+   const TickType_t wtStrtTm{xTaskGetTickCount()};
+   TickType_t wtElpsdTm{0};
+
+   if(_sttsWtrsEvntGrpHndl != NULL){
+      while(!wtEnd){
+         // The change check and the waiter slot claim are atomic with the publication, so a change can't be missed between them
+         taskENTER_CRITICAL(&_lsSwtchMux);
+         if(_sttsChngSeq != chngSeqNum){
+            otptsSttsPkgd = _sttsSnpshtPkgd.load(std::memory_order_relaxed);
+            chngSeqNum = _sttsChngSeq;
+            result = true;
+         }
+         else if(wtrSltIdx == _maxSttsWtrsQty){
+            for(uint8_t sltIdx{0}; (sltIdx < _maxSttsWtrsQty) && (wtrSltIdx == _maxSttsWtrsQty); ++sltIdx){
+               if(!(_sttsWtrsSlts & (1 << sltIdx))){
+                  wtrSltIdx = sltIdx;
+                  _sttsWtrsSlts |= (1 << sltIdx);
+               }
+            }
+         }
+         taskEXIT_CRITICAL(&_lsSwtchMux);
+
+         wtElpsdTm = xTaskGetTickCount() - wtStrtTm;
+         if(result || (wtrSltIdx == _maxSttsWtrsQty) || (wtElpsdTm >= tmOut))
+            wtEnd = true;
+         else  // A wake up left from a previous slot owner is harmless, the change check is repeated
+            xEventGroupWaitBits(_sttsWtrsEvntGrpHndl, static_cast<EventBits_t>(1 << wtrSltIdx), pdTRUE, pdFALSE, (tmOut == portMAX_DELAY)?portMAX_DELAY:(tmOut - wtElpsdTm));
+      }
+      if(wtrSltIdx < _maxSttsWtrsQty){
+         taskENTER_CRITICAL(&_lsSwtchMux);
+         _sttsWtrsSlts &= ~(1 << wtrSltIdx);
+         taskEXIT_CRITICAL(&_lsSwtchMux);
+      }
+   }
+
+   return result;
+}
+
+void LimbsSftyLnFSwtch::_setLtchRlsPndng(){
+   _ltchRlsPndng = true;
 
-		case stEndRls:
-			//In: >>---------------------------------->>
-			if(_sttChng){_clrSttChng();}	// Execute this code only ONCE, when entering this state
-			//Do: >>---------------------------------->>
-         if((_curTimeMs - _prdCyclTmrStrt) >= _ltchRlsTtlTm){
-            _turnOffLtchRls();
-            _lsSwtchFdaState = stEndCycl;
-			   _setSttChng();
+   return;
+}
+
+
+//=========================================================================> Class methods delimiter
+
+LsSwtchRplyr::LsSwtchRplyr(swtchInptHwCfg_t lftHndInpCfg, swtchBhvrCfg_t lftHndBhvrCfg, swtchInptHwCfg_t rghtHndInpCfg, swtchBhvrCfg_t rghtHndBhvrCfg, swtchInptHwCfg_t ftInpCfg, swtchBhvrCfg_t ftBhvrCfg, lsSwtchSwCfg_t lsSwtchWrkngCnfg)
+:LimbsSftyLnFSwtch(lftHndInpCfg, lftHndBhvrCfg, rghtHndInpCfg, rghtHndBhvrCfg, ftInpCfg, ftBhvrCfg, lsSwtchWrkngCnfg)
+{
+   _undrlSwtchsMdld = true;
+   setTmSrc(_vrtlClkRd, this);
+   _sdRplySttsSnpsht();
+}
+
+unsigned long int LsSwtchRplyr::getVrtlClkMs(){
+
+   return _vrtlClkMs;
+}
+
+uint32_t LsSwtchRplyr::rplyTrc(const lsSwtchTrcEvnt_t* trcEvnts, const size_t &trcEvntsQty, const unsigned long int &rplyEndTm){
+   uint32_t otptsChngQty{0};
+   size_t evntIdx{0};
+   unsigned long int nxtStpTm{0};
+   unsigned long int trgtTm{0};
+   bool trgtVld{false};
+   uint32_t curOtptsSttsPkgd{0};
+
+   while((evntIdx < trcEvntsQty) || (_vrtlClkMs < rplyEndTm)){
+      nxtStpTm = _vrtlClkMs + _rplyStpTm;
+      // Skip the virtual poll instants that can't produce any output change
+      trgtVld = false;
+      if(_lsSwtchFdaState == stEndRls){
+         trgtTm = static_cast<unsigned long int>(_prdCyclTmrStrtUs / 1000ULL) + _ltchRlsTtlTm;
+         trgtVld = true;
+      }
+      else if(_lsSwtchFdaState == stEndCycl){
+         trgtTm = static_cast<unsigned long int>(_prdCyclTmrStrtUs / 1000ULL) + _prdCyclTtlTm;
+         trgtVld = true;
+      }
+      else if(_isQscnt()){
+         trgtTm = (evntIdx < trcEvntsQty)?trcEvnts[evntIdx].evntTm:rplyEndTm;
+         trgtVld = true;
+      }
+      if(trgtVld){
+         if((evntIdx == trcEvntsQty) && (trgtTm > rplyEndTm))
+            trgtTm = rplyEndTm;
+         if(trgtTm > nxtStpTm)
+            nxtStpTm += ((trgtTm - nxtStpTm + _rplyStpTm - 1) / _rplyStpTm) * _rplyStpTm;
+      }
+      // Apply the input edges registered up to the virtual poll instant
+      while((evntIdx < trcEvntsQty) && (trcEvnts[evntIdx].evntTm <= nxtStpTm)){
+         _setUndrlSwtchPrssd(trcEvnts[evntIdx].inptId, trcEvnts[evntIdx].isPrssd, trcEvnts[evntIdx].evntTm);
+         ++evntIdx;
+      }
+      _vrtlClkMs = nxtStpTm;
+      _rplyStp();
+      curOtptsSttsPkgd = getLsSwtchOtptsSttsPkgd();
+      if(curOtptsSttsPkgd != _lstOtptsSttsPkgd){
+         _lstOtptsSttsPkgd = curOtptsSttsPkgd;
+         ++otptsChngQty;
+         if(_fnWhnRplyOtptsChng != nullptr)
+            _fnWhnRplyOtptsChng(_vrtlClkMs, _lstOtptsSttsPkgd, _fnWhnRplyOtptsChngArg);
+      }
+   }
+
+   return otptsChngQty;
+}
+
+void LsSwtchRplyr::_rplyStp(){
+#if _lsSwtchPrfInstr
+   uint32_t prfStgTcks[_prfStgsQty]{};
+   const uint32_t prfUpdStrtTcks{_getPrfTcks()};
+   uint32_t prfLapStrtTcks{prfUpdStrtTcks};
+   const uint8_t prfUpdFrmStt{static_cast<uint8_t>(_lsSwtchFdaState)};
+   fdaStpPrf_t prfFdaStps[1]{};
+   uint8_t prfFdaStpsQty{0};
+#endif
+
+   // Set the time base for Flags, Triggers and Timers calculation & update
+   _updCurTimeMs();
+   _lsSwtchPrfLap(curTmPrfStgId);
+   // Underlying switches status recovery from the behavior model
+   _updUndrlSwtchsMdl();
+   _getUndrlSwtchStts();
+   _lsSwtchPrfLap(undrlSwtchsPrfStgId);
+   // State machine update
+   _lsSwtchPrfFdaStp();
+   _updOtptPins();
+   _lsSwtchPrfLap(fdaPrfStgId);
+   // Underlying switches commanded states might have been changed by the State machine
+   _getUndrlSwtchStts();
+   _lsSwtchPrfLap(undrlSwtchsPrfStgId);
+   _pblshSttsSnpsht();
+   _lsSwtchPrfLap(sttsPblshPrfStgId);
+#if _lsSwtchPrfInstr
+   // No lock is taken by the replayer, the span the object's update holds the lock for is timed instead
+   prfStgTcks[lckHldPrfStgId] = prfLapStrtTcks - prfUpdStrtTcks;
+#endif
+   _exctPndngActns();
+   _rstOtptsChngCnt();
+   setLsSwtchOtptsChng(false);
+   _lsSwtchPrfLap(ntfctnPrfStgId);
+#if _lsSwtchPrfInstr
+   prfStgTcks[updTtlPrfStgId] = prfLapStrtTcks - prfUpdStrtTcks;
+   _rcrdPrfSmpls(prfStgTcks, prfUpdFrmStt, prfFdaStps, prfFdaStpsQty);
+#endif
+
+   return;
+}
+
+void LsSwtchRplyr::rstRply(){
+   _vrtlClkMs = 0;
+   _rstTmSrcWrp();   // The virtual clock restart is not a time source wrap around
+   for(uint8_t inptId{lftHndInptId}; inptId <= ftInptId; ++inptId){
+      _undrlSwtchsMdl[inptId].isPrssd = false;
+      _undrlSwtchsMdl[inptId].inptPrssd = false;
+      _undrlSwtchsMdl[inptId].rlsPndng = false;
+      _undrlSwtchsMdl[inptId].isOn = false;
+      _undrlSwtchsMdl[inptId].isVdd = false;
+   }
+   _ltchRlsPndng = false;
+   _emrgncyStpPndng = false;
+   _emrgncyStpInptActv = false;
+   if(_lsSwtchFdaState == stEmrgncyExcpHndl)
+      _lsSwtchFdaState = stOffNotBHP;
+   resetFda();
+   _sdRplySttsSnpsht();
+
+   return;
+}
+
+void LsSwtchRplyr::_sdRplySttsSnpsht(){
+   // The published status and the replay changes reference are seeded with the behavior model initial status, a fresh and a restarted replayer report the same status before the first step
+   taskENTER_CRITICAL(&_lsSwtchMux);
+   _getUndrlSwtchStts();
+   _pblshSttsSnpsht(true);
+   _lstOtptsSttsPkgd = _sttsSnpshtPkgd.load(std::memory_order_relaxed);
+   taskEXIT_CRITICAL(&_lsSwtchMux);
+
+   return;
+}
+
+void LsSwtchRplyr::setFnWhnRplyOtptsChng(fncRplyOtptPtrType newFnWhnRplyOtptsChng, void* newFnWhnRplyOtptsChngArg){
+   _fnWhnRplyOtptsChng = newFnWhnRplyOtptsChng;
+   _fnWhnRplyOtptsChngArg = newFnWhnRplyOtptsChngArg;
+
+   return;
+}
+
+bool LsSwtchRplyr::setRplyStpTm(const unsigned long int &newVal){
+   bool result{false};
+
+   if(newVal > 0){
+      _rplyStpTm = newVal;
+      result = true;
+   }
+
+   return result;
+}
+
+unsigned long int LsSwtchRplyr::_vrtlClkRd(void* rplyrArg){
+
+   return static_cast<LsSwtchRplyr*>(rplyrArg)->_vrtlClkMs;
+}
+
+//=========================================================================> Class methods delimiter
+
+LsSwtchGrp::LsSwtchGrp()
+{
+}
+
+LsSwtchGrp::~LsSwtchGrp(){
+   if(_lsSwtchGrpPollTmrHndl != NULL){
+      xTimerStop(_lsSwtchGrpPollTmrHndl, portMAX_DELAY);
+      xTimerDelete(_lsSwtchGrpPollTmrHndl, portMAX_DELAY);
+   }
+   for(uint8_t lsSwtchIdx{0}; lsSwtchIdx < _lsSwtchsQty; ++lsSwtchIdx){
+      _lsSwtchsPtrs[lsSwtchIdx]->_lsSwtchGrpd = false;
+      _lsSwtchsPtrs[lsSwtchIdx]->_undrlSwtchsMdld = false;
+   }
+}
+
+bool LsSwtchGrp::addLsSwtch(LimbsSftyLnFSwtch* lsSwtchPtr){
+   bool result{false};
+   bool pinsVld{true};
+
+   if((lsSwtchPtr != nullptr) && (_lsSwtchsQty < _maxLsSwtchGrpSz) && (_lsSwtchGrpPollTmrHndl == NULL)){
+      // The inputs levels are extracted from the GPIO input registers sample, every input must be connected to a valid pin
+      for(uint8_t inptId{lftHndInptId}; inptId <= ftInptId; ++inptId){
+         if(lsSwtchPtr->_inptIsrArg[inptId].inptPin > _maxValidPinNum)
+            pinsVld = false;
+      }
+      if(pinsVld && (lsSwtchPtr->_lsSwtchPollTmrHndl == NULL) && !lsSwtchPtr->_lsSwtchGrpd && !lsSwtchPtr->_evntDrvn && !lsSwtchPtr->_phsTmrDrvn){
+         // The underlying switches outputs are computed by the behavior model from the inputs levels sampled by the group
+         lsSwtchPtr->_lsSwtchGrpd = true;
+         lsSwtchPtr->_undrlSwtchsMdld = true;
+         _lsSwtchsPtrs[_lsSwtchsQty++] = lsSwtchPtr;
+         result = true;
+      }
+   }
+
+   return result;
+}
+
+bool LsSwtchGrp::begin(unsigned long int pollDelayMs){
+   bool result{false};
+
+   if((pollDelayMs >= _minPollDelay) && (_lsSwtchsQty > 0) && (_lsSwtchGrpPollTmrHndl == NULL)){
+      result = true;
+      if(_vrtclDbnc)
+         result = _cnfgVrtclDbnc(pollDelayMs);
+      for(uint8_t lsSwtchIdx{0}; result && (lsSwtchIdx < _lsSwtchsQty); ++lsSwtchIdx)
+         result = _lsSwtchsPtrs[lsSwtchIdx]->_bgnCbDsptchTsk() && _lsSwtchsPtrs[lsSwtchIdx]->_bgnSttsWtrs() && _lsSwtchsPtrs[lsSwtchIdx]->_bgnEmrgncyStpInpt();
+      if(result){
+#if _lsSwtchStcAlloc
+         _lsSwtchGrpPollTmrHndl = xTimerCreateStatic(
+            _lsSwtchGrpPollTmrName,  // Timer name
+            pdMS_TO_TICKS(pollDelayMs),  // Timer period in ticks
+            pdTRUE,     // Auto-reload true
+            this,       // TimerID: the data passed as parameter to the callback function is this same object
+            lsSwtchGrpPollCb,	  //Callback function
+            &_lsSwtchGrpPollTmrBuf  // Timer control block, held by the object
+         );
+#else
+         _lsSwtchGrpPollTmrHndl = xTimerCreate(
+            _lsSwtchGrpPollTmrName,  // Timer name
+            pdMS_TO_TICKS(pollDelayMs),  // Timer period in ticks
+            pdTRUE,     // Auto-reload true
+            this,       // TimerID: the data passed as parameter to the callback function is this same object
+            lsSwtchGrpPollCb	  //Callback function
+         );
+#endif
+         if (_lsSwtchGrpPollTmrHndl != NULL){
+            if(xTimerStart(_lsSwtchGrpPollTmrHndl, portMAX_DELAY) != pdPASS)
+               result = false;
          }
-			//Out: >>---------------------------------->>
-			if(_sttChng){}	// Execute this code only ONCE, when exiting this state
-			break;
+         else
+            result = false;
+      }
+   }
 
-		case stEndCycl:
-			//In: >>---------------------------------->>
-			if(_sttChng){_clrSttChng();}	// Execute this code only ONCE, when entering this state
-			//Do: >>---------------------------------->>
-         if((_curTimeMs - _prdCyclTmrStrt) >= _prdCyclTtlTm){
-            _turnOffPrdCycl();
-            // Restore modified isOnDisabled, isEnabled for the underlying switches
-            _undrlLftHndMPBPtr->setIsOnDisabled(true);
-            if(_lftHndBhvrCfg.swtchIsEnbld)
-               _undrlLftHndMPBPtr->enable();
-            _undrlRghtHndMPBPtr->setIsOnDisabled(true);
-            if(_rghtHndBhvrCfg.swtchIsEnbld)
-               _undrlRghtHndMPBPtr->enable();
-            _lsSwtchFdaState = stOffNotBHP;
-            _setSttChng();
+   return result;
+}
+
+bool LsSwtchGrp::_cnfgVrtclDbnc(const unsigned long int &pollDelayMs){
+   bool result{true};
+   uint8_t inptPin{0};
+   unsigned long int dbncTm{0};
+   uint32_t pinThrshld{0};
+   uint32_t pinsThrshld[SOC_GPIO_PIN_COUNT]{};
+
+   // Each pin threshold is the consecutive samples quantity covering its debounce time, the greatest one if the pin is shared
+   _inptsMsk = 0;
+   for(uint8_t lsSwtchIdx{0}; lsSwtchIdx < _lsSwtchsQty; ++lsSwtchIdx){
+      for(uint8_t inptId{lftHndInptId}; inptId <= ftInptId; ++inptId){
+         inptPin = _lsSwtchsPtrs[lsSwtchIdx]->_inptIsrArg[inptId].inptPin;
+         dbncTm = (inptId == lftHndInptId)?_lsSwtchsPtrs[lsSwtchIdx]->_lftHndInpCfg.dbncTime:((inptId == rghtHndInptId)?_lsSwtchsPtrs[lsSwtchIdx]->_rghtHndInpCfg.dbncTime:_lsSwtchsPtrs[lsSwtchIdx]->_ftInpCfg.dbncTime);
+         pinThrshld = ((dbncTm + pollDelayMs - 1) / pollDelayMs) + 1;
+         if((inptPin >= SOC_GPIO_PIN_COUNT) || (pinThrshld >= (1UL << _vrtclDbncCntrBits)))
+            result = false;
+         else{
+            _inptsMsk |= (static_cast<uint64_t>(1) << inptPin);
+            if(pinsThrshld[inptPin] < pinThrshld)
+               pinsThrshld[inptPin] = pinThrshld;
          }
-			//Out: >>---------------------------------->>
-			if(_sttChng){}	// Execute this code only ONCE, when exiting this state
-			break;
+      }
+   }
+   if(result){
+      // The thresholds are stored as bit planes, as the counters
+      for(uint8_t cntrBit{0}; cntrBit < _vrtclDbncCntrBits; ++cntrBit){
+         _dbncCntr[cntrBit] = 0;
+         _dbncThrshld[cntrBit] = 0;
+         for(inptPin = 0; inptPin < SOC_GPIO_PIN_COUNT; ++inptPin){
+            if(pinsThrshld[inptPin] & (1UL << cntrBit))
+               _dbncThrshld[cntrBit] |= (static_cast<uint64_t>(1) << inptPin);
+         }
+      }
+      // The debouncing process starts from the present levels, as the DbncdMPBttn objects do when started
+      _dbncdInptsLvl = _rdGpioInptsLvl() & _inptsMsk;
+   }
 
-		case stEmrgncyExcpHndl:
-			//In: >>---------------------------------->>
-			if(_sttChng){_clrSttChng();}	// Execute this code only ONCE, when entering this state
-			//Do: >>---------------------------------->>
-         // Keep eternal loop
-			//_setSttChng();
-			//Out: >>---------------------------------->>
-			if(_sttChng){}	// Execute this code only ONCE, when exiting this state
-			break;
+   return result;
+}
 
-      default:
-         break;
+const bool LsSwtchGrp::getIsVrtclDbnc() const{
+
+   return _vrtclDbnc;
+}
+
+LimbsSftyLnFSwtch* LsSwtchGrp::getLsSwtchPtr(const uint8_t &lsSwtchIdx){
+   LimbsSftyLnFSwtch* result{nullptr};
+
+   if(lsSwtchIdx < _lsSwtchsQty)
+      result = _lsSwtchsPtrs[lsSwtchIdx];
+
+   return result;
+}
+
+uint8_t LsSwtchGrp::getLsSwtchsQty() const{
+
+   return _lsSwtchsQty;
+}
+
+void LsSwtchGrp::lsSwtchGrpPollCb(TimerHandle_t lssGrpTmrCbArg){
+   LsSwtchGrp* lsSwtchGrpObj = (LsSwtchGrp*)pvTimerGetTimerID(lssGrpTmrCbArg);
+
+   lsSwtchGrpObj->_updLsSwtchGrp();
+
+   return;
+}
+
+uint64_t LsSwtchGrp::_rdGpioInptsLvl(){
+   uint64_t result{REG_READ(GPIO_IN_REG)};
+
+#if SOC_GPIO_PIN_COUNT > 32
+   result |= (static_cast<uint64_t>(REG_READ(GPIO_IN1_REG)) << 32);
+#endif
+
+   return result;
+}
+
+bool LsSwtchGrp::setVrtclDbnc(const bool &newVal){
+   bool result{false};
+
+   if(_lsSwtchGrpPollTmrHndl == NULL){
+      _vrtclDbnc = newVal;
+      result = true;
    }
-	taskEXIT_CRITICAL(&mux);
 
-	return;
+   return result;
 }
 
-void LimbsSftyLnFSwtch::_setLtchRlsPndng(){
-   _ltchRlsPndng = true;
+void LsSwtchGrp::_updLsSwtchGrp(){
+   uint64_t gpioInptsLvl{_rdGpioInptsLvl()};
+
+   // A single inputs sample for all the stations, then each station FDA is stepped with it
+   if(_vrtclDbnc)
+      gpioInptsLvl = _updVrtclDbnc(gpioInptsLvl);
+   for(uint8_t lsSwtchIdx{0}; lsSwtchIdx < _lsSwtchsQty; ++lsSwtchIdx)
+      _lsSwtchsPtrs[lsSwtchIdx]->_updGrpdLsSwtch(gpioInptsLvl, _vrtclDbnc);
 
    return;
 }
 
+uint64_t LsSwtchGrp::_updVrtclDbnc(const uint64_t &gpioInptsLvl){
+   uint64_t inptsChng{(gpioInptsLvl ^ _dbncdInptsLvl) & _inptsMsk};
+   uint64_t cntrCarry{inptsChng};
+   uint64_t cntrBitCarry{0};
+   uint64_t thrshldRchd{inptsChng};
+
+   for(uint8_t cntrBit{0}; cntrBit < _vrtclDbncCntrBits; ++cntrBit){
+      // Counters of the pins back to the debounced level are reset, the rest are incremented by 1
+      _dbncCntr[cntrBit] &= inptsChng;
+      cntrBitCarry = _dbncCntr[cntrBit] & cntrCarry;
+      _dbncCntr[cntrBit] ^= cntrCarry;
+      cntrCarry = cntrBitCarry;
+      // A pin reaches its threshold when every counter bit equals the threshold bit
+      thrshldRchd &= ~(_dbncCntr[cntrBit] ^ _dbncThrshld[cntrBit]);
+   }
+   // The pins reaching their threshold get the new level accepted and their counters reset
+   _dbncdInptsLvl ^= thrshldRchd;
+   for(uint8_t cntrBit{0}; cntrBit < _vrtclDbncCntrBits; ++cntrBit)
+      _dbncCntr[cntrBit] &= ~thrshldRchd;
+
+   return _dbncdInptsLvl;
+}
 
 //=========================================================================> Class methods delimiter
+LsSwtchLgEncdr::LsSwtchLgEncdr(const uint32_t &tmRsltnUs)
+:_tmRsltnUs{(tmRsltnUs > 0)?tmRsltnUs:1}
+{
+}
 
-lsSwtchOtpts_t lssOtptsSttsUnpkg(uint32_t pkgOtpts){
-	lsSwtchOtpts_t lssCurSttsDcdd {0};
+size_t LsSwtchLgEncdr::encdHdr(uint8_t* bfr, const size_t &bfrSz) const{
+   size_t result{0};
 
-   //Underlying DbncdMPBttns' attribute flags state
-	if(pkgOtpts & (((uint32_t)1) << lftHndSwtchIsEnbldBP))
-		lssCurSttsDcdd.lftHndIsEnbld = true;
-	else
-		lssCurSttsDcdd.lftHndIsEnbld = false;
-	if(pkgOtpts & (((uint32_t)1) << lftHndSwtchIsOnBP))
-		lssCurSttsDcdd.lftHndIsOn = true;
-	else
-		lssCurSttsDcdd.lftHndIsOn = false;
-	if(pkgOtpts & (((uint32_t)1) << lftHndSwtchIsVddBP))
-		lssCurSttsDcdd.lftHndIsVdd = true;
-	else
-		lssCurSttsDcdd.lftHndIsVdd = false;
+   if((bfr != nullptr) && (bfrSz >= _lgHdrMaxSz)){
+      bfr[0] = 'L';
+      bfr[1] = 'S';
+      bfr[2] = 'L';
+      bfr[3] = 0x01;
+      result = 4 + _encdVrnt(_tmRsltnUs, bfr + 4);
+   }
 
-	if(pkgOtpts & (((uint32_t)1) << rghtHndSwtchIsEnbldBP))
-		lssCurSttsDcdd.rghtHndIsEnbld = true;
-	else
-		lssCurSttsDcdd.rghtHndIsEnbld = false;
-	if(pkgOtpts & (((uint32_t)1) << rghtHndSwtchIsOnBP))
-		lssCurSttsDcdd.rghtHndIsOn = true;
-	else
-		lssCurSttsDcdd.rghtHndIsOn = false;
+   return result;
+}
 
-	if(pkgOtpts & (((uint32_t)1) << rghtHndSwtchIsVddBP))
-		lssCurSttsDcdd.rghtHndIsVdd = true;
-	else
-		lssCurSttsDcdd.rghtHndIsVdd = false;
+size_t LsSwtchLgEncdr::encdTrnstn(const uint64_t &tmUs, const uint32_t &otptsSttsPkgd, uint8_t* bfr, const size_t &bfrSz){
+   size_t result{0};
+   const uint64_t curTm{tmUs / _tmRsltnUs};
+
+   if((bfr != nullptr) && (bfrSz >= _lgEncdMaxSz)){
+      if(_kyFrmPndng || (curTm < _lstTm)){
+         // Key frame: a no change record -never produced by a real change- followed by the absolute values
+         bfr[result++] = 0x00;
+         bfr[result++] = 0x00;
+         result += _encdVrnt(curTm, bfr + result);
+         result += _encdVrnt(otptsSttsPkgd, bfr + result);
+         _kyFrmPndng = false;
+      }
+      else if(otptsSttsPkgd != _lstOtptsSttsPkgd){
+         result += _encdVrnt(curTm - _lstTm, bfr + result);
+         result += _encdVrnt(otptsSttsPkgd ^ _lstOtptsSttsPkgd, bfr + result);
+      }
+      if(result > 0){
+         _lstTm = curTm;
+         _lstOtptsSttsPkgd = otptsSttsPkgd;
+         ++_rcrdsQty;
+      }
+   }
 
-   if(pkgOtpts & (((uint32_t)1) << ftSwtchIsEnbldBP))
-		lssCurSttsDcdd.ftSwIsEnbld = true;
-	else
-		lssCurSttsDcdd.ftSwIsEnbld = false;
+   return result;
+}
 
-   if(pkgOtpts & (((uint32_t)1) << ftSwtchIsOnBP))
-		lssCurSttsDcdd.ftSwIsOn = true;
-	else
-		lssCurSttsDcdd.ftSwIsOn = false;
+size_t LsSwtchLgEncdr::_encdVrnt(uint64_t val, uint8_t* bfr){
+   size_t result{0};
 
-   //LimbsSftyLnFSwtch's attribute flags state
-	if(pkgOtpts & (((uint32_t)1) << LsSwtchLtchRlsIsOnBP))
-		lssCurSttsDcdd.ltchRlsIsOn = true;
-	else
-		lssCurSttsDcdd.ltchRlsIsOn = false;
-	if(pkgOtpts & (((uint32_t)1) << LsSwtchPrdCyclIsOnBP))
-		lssCurSttsDcdd.prdCyclIsOn = true;
-	else
-		lssCurSttsDcdd.prdCyclIsOn = false;
+   while(val >= 0x80){
+      bfr[result++] = static_cast<uint8_t>(val | 0x80);
+      val >>= 7;
+   }
+   bfr[result++] = static_cast<uint8_t>(val);
+
+   return result;
+}
+
+uint32_t LsSwtchLgEncdr::getRcrdsQty() const{
+
+   return _rcrdsQty;
+}
+
+void LsSwtchLgEncdr::rst(){
+   _kyFrmPndng = true;
+   _lstOtptsSttsPkgd = 0;
+   _lstTm = 0;
+   _rcrdsQty = 0;
+
+   return;
+}
+
+//=========================================================================> Class methods delimiter
+void LsSwtchStrmSttstc::addSmpl(const float &smpl){
+   float dlt{0.0};
+
+   // Welford online algorithm: exact mean and variance with no samples storage
+   ++_smplsQty;
+   dlt = smpl - _mean;
+   _mean += dlt / _smplsQty;
+   _m2 += dlt * (smpl - _mean);
+   if((_smplsQty == 1) || (smpl < _min))
+      _min = smpl;
+   if((_smplsQty == 1) || (smpl > _max))
+      _max = smpl;
+   for(uint8_t qntlIdx{0}; qntlIdx < _sttstcQntlsQty; ++qntlIdx)
+      _updQntl(qntlIdx, smpl);
+
+   return;
+}
+
+float LsSwtchStrmSttstc::_getQntl(const uint8_t &qntlIdx) const{
+   float result{0.0};
+
+   if(_smplsQty >= 5)
+      result = _qntlMrkrHght[qntlIdx][2];
+   else if(_smplsQty > 0)
+      result = _qntlMrkrHght[qntlIdx][static_cast<uint8_t>(_qntlsPrbblty[qntlIdx] * (_smplsQty - 1) + 0.5)];   // The markers hold the sorted samples
+
+   return result;
+}
+
+void LsSwtchStrmSttstc::getSmmry(lsSwtchSttstcSmmry_t &smmry) const{
+   smmry = {};
+   if(_smplsQty > 0){
+      smmry.smplsQty = _smplsQty;
+      smmry.min = _min;
+      smmry.max = _max;
+      smmry.mean = _mean;
+      if(_smplsQty > 1)
+         smmry.stdDev = sqrtf(_m2 / (_smplsQty - 1));
+      smmry.p50 = _getQntl(0);
+      smmry.p90 = _getQntl(1);
+      smmry.p99 = _getQntl(2);
+   }
+
+   return;
+}
+
+uint32_t LsSwtchStrmSttstc::getSmplsQty() const{
+
+   return _smplsQty;
+}
+
+void LsSwtchStrmSttstc::rst(){
+   // The quantiles markers are rebuilt from the first five samples
+   _smplsQty = 0;
+   _mean = 0.0;
+   _m2 = 0.0;
+   _min = 0.0;
+   _max = 0.0;
+
+   return;
+}
+
+void LsSwtchStrmSttstc::_updQntl(const uint8_t &qntlIdx, const float &smpl){
+   float (&mrkrHght)[5] = _qntlMrkrHght[qntlIdx];
+   int32_t (&mrkrPos)[5] = _qntlMrkrPos[qntlIdx];
+   float (&mrkrDsrdPos)[5] = _qntlMrkrDsrdPos[qntlIdx];
+   const float prbblty{_qntlsPrbblty[qntlIdx]};
+   const float mrkrDsrdPosIncr[5]{0.0, prbblty / 2, prbblty, (1 + prbblty) / 2, 1.0};
+   uint8_t mrkrIdx{0};
+   float posDlt{0.0};
+   int32_t posDir{0};
+   float prbHght{0.0};
+
+   if(_smplsQty <= 5){
+      // The first five samples are kept sorted as the initial markers heights
+      mrkrIdx = _smplsQty - 1;
+      while((mrkrIdx > 0) && (mrkrHght[mrkrIdx - 1] > smpl)){
+         mrkrHght[mrkrIdx] = mrkrHght[mrkrIdx - 1];
+         --mrkrIdx;
+      }
+      mrkrHght[mrkrIdx] = smpl;
+      if(_smplsQty == 5){
+         for(mrkrIdx = 0; mrkrIdx < 5; ++mrkrIdx){
+            mrkrPos[mrkrIdx] = mrkrIdx;
+            mrkrDsrdPos[mrkrIdx] = 4 * mrkrDsrdPosIncr[mrkrIdx];
+         }
+      }
+   }
+   else{
+      // P-square algorithm: find the cell holding the sample, shift the markers positions and adjust the middle markers heights
+      if(smpl < mrkrHght[0]){
+         mrkrHght[0] = smpl;
+         mrkrIdx = 0;
+      }
+      else if(smpl >= mrkrHght[4]){
+         mrkrHght[4] = smpl;
+         mrkrIdx = 3;
+      }
+      else{
+         while(smpl >= mrkrHght[mrkrIdx + 1])
+            ++mrkrIdx;
+      }
+      for(++mrkrIdx; mrkrIdx < 5; ++mrkrIdx)
+         ++mrkrPos[mrkrIdx];
+      for(mrkrIdx = 0; mrkrIdx < 5; ++mrkrIdx)
+         mrkrDsrdPos[mrkrIdx] += mrkrDsrdPosIncr[mrkrIdx];
+      for(mrkrIdx = 1; mrkrIdx < 4; ++mrkrIdx){
+         posDlt = mrkrDsrdPos[mrkrIdx] - mrkrPos[mrkrIdx];
+         if(((posDlt >= 1) && ((mrkrPos[mrkrIdx + 1] - mrkrPos[mrkrIdx]) > 1)) || ((posDlt <= -1) && ((mrkrPos[mrkrIdx - 1] - mrkrPos[mrkrIdx]) < -1))){
+            posDir = (posDlt >= 0)?1:-1;
+            // Piecewise parabolic prediction, replaced by the linear one if it breaks the markers heights order
+            prbHght = mrkrHght[mrkrIdx] + static_cast<float>(posDir) / (mrkrPos[mrkrIdx + 1] - mrkrPos[mrkrIdx - 1]) *
+               ((mrkrPos[mrkrIdx] - mrkrPos[mrkrIdx - 1] + posDir) * (mrkrHght[mrkrIdx + 1] - mrkrHght[mrkrIdx]) / (mrkrPos[mrkrIdx + 1] - mrkrPos[mrkrIdx]) +
+               (mrkrPos[mrkrIdx + 1] - mrkrPos[mrkrIdx] - posDir) * (mrkrHght[mrkrIdx] - mrkrHght[mrkrIdx - 1]) / (mrkrPos[mrkrIdx] - mrkrPos[mrkrIdx - 1]));
+            if((mrkrHght[mrkrIdx - 1] < prbHght) && (prbHght < mrkrHght[mrkrIdx + 1]))
+               mrkrHght[mrkrIdx] = prbHght;
+            else
+               mrkrHght[mrkrIdx] += posDir * (mrkrHght[mrkrIdx + posDir] - mrkrHght[mrkrIdx]) / (mrkrPos[mrkrIdx + posDir] - mrkrPos[mrkrIdx]);
+            mrkrPos[mrkrIdx] += posDir;
+         }
+      }
+   }
+
+   return;
+}
+
+//=========================================================================> Class methods delimiter
+
+// The lsSwtchOtpts_t flags are one byte each, in the same order as their bit positions in the packed value: packing gathers the least significant bit of each byte into consecutive bits, unpacking spreads them back
+static_assert((lftHndSwtchIsEnbldBP == 0) && (lftHndSwtchIsOnBP == 1) && (lftHndSwtchIsVddBP == 2) && (rghtHndSwtchIsEnbldBP == 3) && (rghtHndSwtchIsOnBP == 4) &&
+   (rghtHndSwtchIsVddBP == 5) && (ftSwtchIsEnbldBP == 6) && (ftSwtchIsOnBP == 7) && (LsSwtchLtchRlsIsOnBP == 8) && (LsSwtchPrdCyclIsOnBP == 9) && (lsSwtchOtptsSttsMsk == 0x03FF),
+   "The packed status bit positions must match the lsSwtchOtpts_t members order");
+static_assert((sizeof(bool) == 1) && (sizeof(lsSwtchOtpts_t) == 10) && (offsetof(lsSwtchOtpts_t, ltchRlsIsOn) == 8) && (offsetof(lsSwtchOtpts_t, prdCyclIsOn) == 9),
+   "The lsSwtchOtpts_t members must be consecutive one byte flags");
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "The packed status byte gathering and spreading are written for little endian targets");
+
+uint32_t lssOtptsSttsPkg(const lsSwtchOtpts_t &otpts){
+   uint64_t lwrFlgs{0};
+   uint16_t uprFlgs{0};
+
+   memcpy(&lwrFlgs, &otpts, sizeof(lwrFlgs));
+   memcpy(&uprFlgs, &otpts.ltchRlsIsOn, sizeof(uprFlgs));
+   // Gather bit 0 of each of the 8 lower bytes into bits 0..7
+   lwrFlgs &= 0x0101010101010101ULL;
+   lwrFlgs = (lwrFlgs | (lwrFlgs >> 7)) & 0x0003000300030003ULL;
+   lwrFlgs = (lwrFlgs | (lwrFlgs >> 14)) & 0x0000000F0000000FULL;
+   lwrFlgs = (lwrFlgs | (lwrFlgs >> 28)) & 0x00000000000000FFULL;
+   // Gather bit 0 of each of the 2 upper bytes into bits 8..9
+   uprFlgs &= 0x0101;
+   uprFlgs = (uprFlgs | (uprFlgs >> 7)) & 0x0003;
+
+   return static_cast<uint32_t>(lwrFlgs) | (static_cast<uint32_t>(uprFlgs) << LsSwtchLtchRlsIsOnBP);
+}
+
+uint16_t lssExtdSeqNumDlt(uint16_t newSeqNum, uint16_t oldSeqNum){
+
+   return static_cast<uint16_t>(newSeqNum - oldSeqNum) & lsSwtchExtdSeqNumMsk;
+}
+
+lsSwtchOtptsExtd_t lssOtptsSttsExtdUnpkg(uint64_t pkgOtptsExtd){
+   lsSwtchOtptsExtd_t lssCurSttsExtdDcdd {};
+
+   lssCurSttsExtdDcdd.otpts = lssOtptsSttsUnpkg(static_cast<uint32_t>(pkgOtptsExtd) & lsSwtchOtptsSttsMsk);
+   lssCurSttsExtdDcdd.fdaStt = static_cast<uint8_t>((pkgOtptsExtd >> lsSwtchExtdFdaSttBP) & 0x07);
+   lssCurSttsExtdDcdd.phsElpsdTm = static_cast<uint32_t>((pkgOtptsExtd >> lsSwtchExtdPhsElpsdBP) & lsSwtchExtdPhsTmMax);
+   lssCurSttsExtdDcdd.phsRmngTm = static_cast<uint32_t>((pkgOtptsExtd >> lsSwtchExtdPhsRmngBP) & lsSwtchExtdPhsTmMax);
+   lssCurSttsExtdDcdd.seqNum = static_cast<uint16_t>((pkgOtptsExtd >> lsSwtchExtdSeqNumBP) & lsSwtchExtdSeqNumMsk);
+
+   return lssCurSttsExtdDcdd;
+}
+
+lsSwtchOtpts_t lssOtptsSttsUnpkg(uint32_t pkgOtpts){
+	lsSwtchOtpts_t lssCurSttsDcdd {0};
+   uint64_t lwrFlgs{pkgOtpts & 0x00FFUL};
+   uint16_t uprFlgs{static_cast<uint16_t>((pkgOtpts >> LsSwtchLtchRlsIsOnBP) & 0x0003UL)};
+
+   // Spread bits 0..7 to bit 0 of each of the 8 lower bytes
+   lwrFlgs = (lwrFlgs | (lwrFlgs << 28)) & 0x0000000F0000000FULL;
+   lwrFlgs = (lwrFlgs | (lwrFlgs << 14)) & 0x0003000300030003ULL;
+   lwrFlgs = (lwrFlgs | (lwrFlgs << 7)) & 0x0101010101010101ULL;
+   // Spread bits 8..9 to bit 0 of each of the 2 upper bytes
+   uprFlgs = (uprFlgs | (uprFlgs << 7)) & 0x0101;
+   memcpy(&lssCurSttsDcdd, &lwrFlgs, sizeof(lwrFlgs));
+   memcpy(&lssCurSttsDcdd.ltchRlsIsOn, &uprFlgs, sizeof(uprFlgs));
    
 	return lssCurSttsDcdd;
 }
@@ -47,6 +47,10 @@
 
 #include <Arduino.h>
 #include <stdint.h>
+#include <atomic>
+#include <esp_timer.h>
+#include <soc/gpio_reg.h>
+#include <soc/soc_caps.h>
 #include <ButtonToSwitch_ESP32.h>
 
 //==============================================>> BEGIN User defined constants
@@ -63,6 +67,28 @@
 #define _stdTVMPBttnDelayTime 0UL
 #define _stdSSVMPBttnDelayTime 0UL
 #define _minPollDelay 20UL
+#define _maxFdaStpsPerUpd 4   // Event driven mode limit of FDA steps executed by a single update
+#define _maxSnpshtRdTries 8   // Status snapshot read tries limit when overlapping publications
+#define _cbDsptchQueSz 16  // Callback dispatch queue entries, must be a power of 2
+#define _cbDsptchRsrvdEntrs 2 // Callback dispatch queue entries reserved to the turn off requests, one for each output
+#define _maxEdgsSbscrbrsQty 4 // Tasks quantity limit for the batched edges notification subscribers of a LimbsSftyLnFSwtch object
+#define _maxSttsSbscrbrsQty 4 // Tasks quantity limit for the filtered status change notification subscribers of a LimbsSftyLnFSwtch object
+#define _maxSttsWtrsQty 4  // Tasks quantity limit simultaneously blocked in the wtLsSwtchOtptsChng() method of a LimbsSftyLnFSwtch object
+#define _maxLsSwtchGrpSz 16  // LimbsSftyLnFSwtch objects quantity limit for a LsSwtchGrp object
+#define _lgEncdMaxSz 32 // Worst case bytes written by a single LsSwtchLgEncdr::encdTrnstn() execution, the smallest buffer size it accepts
+#define _lgHdrMaxSz 9   // Worst case bytes written by LsSwtchLgEncdr::encdHdr()
+#define _vrtclDbncCntrBits 4  // LsSwtchGrp vertical counters bit planes, the debounce time limit is (2^_vrtclDbncCntrBits - 2) poll periods
+#define _trnstnRngSz 32  // Transitions ring records, must be a power of 2
+#define _cbDsptchTskStckSz 4096  // Callback dispatch task stack size, the callback functions are executed in this stack
+#define _sttstcQntlsQty 3  // Quantiles estimated by each LsSwtchStrmSttstc object: 50th, 90th and 99th percentiles
+#ifndef _lsSwtchStcAlloc
+   #define _lsSwtchStcAlloc 0 // 1: Zero heap construction, the underlying switches, timers and dispatch task are allocated inside each object. Must be set as a project wide build flag (-D_lsSwtchStcAlloc=1), as it changes the class layout
+#endif
+#ifndef _lsSwtchPrfInstr
+   #define _lsSwtchPrfInstr 0 // 1: Update stages timing instrumentation compiled in. Must be set as a project wide build flag (-D_lsSwtchPrfInstr=1), as it changes the class layout
+#endif
+#define _prfStgsQty 7   // Update stages timed by the instrumentation, see the update stages timing identification constants
+#define _prfHstgrmBcktsQty 24 // Update stages timing histograms buckets, bucket n counts the durations in the [2^n, 2^(n+1)) ticks range, the last one counts every longer duration
 
 /*---------------- xTaskNotify() mechanism related constants BEGIN -------*/
 const uint8_t lftHndSwtchIsEnbldBP{0x00};
@@ -75,6 +101,48 @@ const uint8_t ftSwtchIsEnbldBP{0x06};
 const uint8_t ftSwtchIsOnBP{0x07};
 const uint8_t LsSwtchLtchRlsIsOnBP{0x08};
 const uint8_t LsSwtchPrdCyclIsOnBP{0x09};
+const uint32_t lsSwtchOtptsSttsMsk{0x03FF};  // Packed status bits owned by the LimbsSftyLnFSwtch status, the rest are left untouched by the packing
+
+// Batched edges notification value bits, a single notification might carry several edges produced by the same update
+const uint32_t bthHndsOnMssdEdgBit{0x01};
+const uint32_t ltchRlsTrnOnEdgBit{0x02};
+const uint32_t prdCyclTrnOnEdgBit{0x04};
+const uint32_t ltchRlsTrnOffEdgBit{0x08};
+const uint32_t prdCyclTrnOffEdgBit{0x10};
+const uint32_t lsSwtchOtptsChngEdgBit{0x20};  // Packed status changed, notified only when selected by the subscription edges mask
+const uint32_t lsSwtchTrnstnsEdgsMsk{0x1F};   // Edges produced by the FDA transitions, the default subscription edges mask
+const uint32_t lsSwtchEdgsMsk{0x3F};   // All the batched edges notification value bits
+/*---------------- xTaskNotify() mechanism related constants END -------*/
+
+/*---------------- Extended status word fields constants BEGIN -------*/
+const uint8_t lsSwtchExtdFdaSttBP{10};  // 3 bits FDA state
+const uint8_t lsSwtchExtdPhsElpsdBP{13};  // 18 bits phase elapsed time
+const uint8_t lsSwtchExtdPhsRmngBP{31};   // 18 bits phase remaining time
+const uint8_t lsSwtchExtdSeqNumBP{49}; // 15 bits publication sequence number
+const uint32_t lsSwtchExtdPhsTmMax{0x3FFFF};  // Phase times saturation value, in milliseconds
+const uint16_t lsSwtchExtdSeqNumMsk{0x7FFF};
+/*---------------- Extended status word fields constants END -------*/
+
+/*---------------- Underlying switches identification constants BEGIN -------*/
+const uint8_t lftHndInptId{0x00};
+const uint8_t rghtHndInptId{0x01};
+const uint8_t ftInptId{0x02};
+const uint8_t emrgncyStpInptId{0x03};  // Emergency stop input, not an underlying switch: used only by its Interrupt Service Routine argument
+/*---------------- Underlying switches identification constants END -------*/
+
+/*---------------- Update stages timing identification constants BEGIN -------*/
+const uint8_t undrlSwtchsPrfStgId{0x00};  // Underlying switches status recovery, or inputs reading and behavior model update
+const uint8_t curTmPrfStgId{0x01};  // Time base update
+const uint8_t fdaPrfStgId{0x02}; // FDA update, including the event driven mode run to completion steps
+const uint8_t sttsPblshPrfStgId{0x03}; // Status snapshot publication
+const uint8_t ntfctnPrfStgId{0x04}; // Pending actions execution, phase and poll timers maintenance and output changes task notification
+const uint8_t lckHldPrfStgId{0x05}; // Object lock held: the interrupts are masked in the executing core for this time
+const uint8_t updTtlPrfStgId{0x06}; // Whole update, including the lock acquisition wait
+/*---------------- Update stages timing identification constants END -------*/
+
+/*---------------- FDA states identification constants BEGIN -------*/
+const uint8_t lsSwtchFdaSttsQty{0x06};   // FDA states quantity: 0 Switch off, not both hands pressed; 1 Switch off, both hands pressed, foot not pressed; 2 Start latch release and production cycle; 3 Latch release phase; 4 Production cycle phase; 5 Emergency stop
+/*---------------- FDA states identification constants END -------*/
 //=================================================>> END User defined constants
 
 // Definition workaround to let a function/method return value to be a function pointer to a function that receives no arguments and returns no values: void (funcName*)()
@@ -98,6 +166,18 @@ ptrToTrnFncVdPtr getFunctionPointer() {
 typedef void (*fncVdPtrPrmPtrType)(void*);
 typedef fncVdPtrPrmPtrType (*ptrToTrnFncVdPtr)(void*);
 
+// Definition workaround to let a function/method be used as the time base source: unsigned long int (funcName*)(void*), returning the current time in milliseconds
+typedef unsigned long int (*fncTmSrcPtrType)(void*);
+
+// Definition workaround to let a function/method be used as the high resolution time base source: uint64_t (funcName*)(void*), returning the current monotonic time in microseconds
+typedef uint64_t (*fncTmSrcUsPtrType)(void*);
+
+// Definition workaround to let a function/method receive each output change produced by a trace replay: void (funcName*)(unsigned long int chngTm, uint32_t otptsSttsPkgd, void*)
+typedef void (*fncRplyOtptPtrType)(unsigned long int, uint32_t, void*);
+
+// Definition workaround to let a function/method replace the output stage GPIO registers writes: void (funcName*)(uint64_t stPinsMsk, uint64_t clrPinsMsk, void*), each mask bit n set for the GPIO pin n to be set to high level or cleared to low level
+typedef void (*fncOtptPinsWrtPtrType)(uint64_t, uint64_t, void*);
+
 //===================================================>> BEGIN User defined types
 /**
  * @struct gpioPinOtptHwCfg_t
@@ -245,6 +325,311 @@ struct lsSwtchSwCfg_t{
    unsigned long int ltchRlsActvTm = 1500UL;
    unsigned long int prdCyclActvTm = 6000UL;  
 };
+
+/**
+ * @struct lsSwtchTrcEvnt_t
+ * 
+ * @brief Input trace event data structure
+ * 
+ * Holds one timestamped edge of one of the three LimbsSftyLnFSwtch inputs, as registered by a production line input logger. A sequence of these elements ordered by ascending time makes an **input trace** that can be replayed by a LsSwtchRplyr class object.
+ * 
+ * @param evntTm Time -in milliseconds- at which the edge took place, relative to the start of the trace
+ * @param inptId Input identification: lftHndInptId, rghtHndInptId or ftInptId
+ * @param isPrssd Input state after the edge: true for pressed, false for released
+ * 
+ * @note The input states are expected to be already debounced, as they are expected to be logged from the debounced switches.
+ */
+struct lsSwtchTrcEvnt_t{
+   unsigned long int evntTm;
+   uint8_t inptId;
+   bool isPrssd;
+};
+
+/**
+ * @struct undrlSwtchMdl_t
+ * 
+ * @brief Underlying switch behavior model data structure
+ * 
+ * Holds the state needed to compute an underlying switch outputs from its debounced input level without the DbncdMPBttn subclass object timers, reproducing the start delay, voiding and single service behaviors. Used when the underlying switches inputs are not provided by the DbncdMPBttn subclasses objects (i.e. input traces replay, event driven inputs processing).
+ * 
+ * @param isPrssd Debounced input level, true if the switch is pressed
+ * @param prssdTm Time -in milliseconds- of the last press edge
+ * @param isEnbld Commanded isEnabled attribute flag value
+ * @param isOnDsbld Commanded isOnDisabled attribute flag value
+ * @param isOn Computed isOn attribute flag value
+ * @param isVdd Computed isVoided attribute flag value
+ * @param rlsPndng An effective release is required before a press is accepted again
+ * @param inptPrssd Last input level registered, not yet debounced, true if the switch is pressed
+ * @param inptChngTm Time -in milliseconds- of the last input level change registered
+ */
+struct undrlSwtchMdl_t{
+   bool isPrssd = false;
+   unsigned long int prssdTm = 0;
+   bool isEnbld = true;
+   bool isOnDsbld = false;
+   bool isOn = false;
+   bool isVdd = false;
+   bool rlsPndng = false;
+   bool inptPrssd = false;
+   unsigned long int inptChngTm = 0;
+};
+
+/**
+ * @struct lsSwtchSttsSnpsht_t
+ * 
+ * @brief Published status snapshot data structure
+ * 
+ * Holds a consistent copy of the status published by a LimbsSftyLnFSwtch object at the end of one of its updates, as returned by getLsSwtchSttsSnpsht().
+ * 
+ * @param otptsSttsPkgd Packed status value, encoded as documented in lssOtptsSttsUnpkg(uint32_t)
+ * @param sttsTm Time -in milliseconds, object's time base- of the update that published the status
+ * @param seqNum Sequence number of the publication, incremented by each update. Two snapshots with the same seqNum hold the same status
+ */
+struct lsSwtchSttsSnpsht_t{
+   uint32_t otptsSttsPkgd;
+   unsigned long int sttsTm;
+   uint32_t seqNum;
+};
+
+/**
+ * @struct lsSwtchOtptsExtd_t
+ * 
+ * @brief Extended status data structure
+ * 
+ * Holds the fields of an extended status word as returned by getLsSwtchOtptsSttsExtd(), decoded by lssOtptsSttsExtdUnpkg(uint64_t).
+ * 
+ * @param otpts Attribute flags values, as decoded by lssOtptsSttsUnpkg(uint32_t)
+ * @param fdaStt FDA state: 0 Switch off, not both hands pressed; 1 Switch off, both hands pressed, foot not pressed; 2 Start latch release and production cycle; 3 Latch release phase; 4 Production cycle phase; 5 Emergency stop
+ * @param phsElpsdTm Time -in milliseconds- elapsed since the production cycle start, for the latch release and production cycle phases, 0 for the rest of the states. Saturates at lsSwtchExtdPhsTmMax
+ * @param phsRmngTm Time -in milliseconds- left to the end of the current phase, 0 for the states without a phase deadline. Saturates at lsSwtchExtdPhsTmMax
+ * @param seqNum Publication sequence number, the 15 least significant bits of the lsSwtchSttsSnpsht_t seqNum. Compare sequence numbers with lssExtdSeqNumDlt(uint16_t, uint16_t), as they wrap around
+ */
+struct lsSwtchOtptsExtd_t{
+   lsSwtchOtpts_t otpts;
+   uint8_t fdaStt;
+   uint32_t phsElpsdTm;
+   uint32_t phsRmngTm;
+   uint16_t seqNum;
+};
+
+/**
+ * @struct lsSwtchCbEvnt_t
+ * 
+ * @brief Callback dispatch queue entry data structure
+ * 
+ * Holds a callback function execution request issued by the FDA to the callback dispatch task.
+ * 
+ * @param fnToExct Function to execute
+ * @param fnToExctArg Argument to pass to the function to execute
+ * @param enqTmUs Time -in microseconds, esp_timer time base- the request was queued
+ */
+struct lsSwtchCbEvnt_t{
+   fncVdPtrPrmPtrType fnToExct;
+   void* fnToExctArg;
+   int64_t enqTmUs;
+};
+
+/**
+ * @struct lsSwtchSbscrbr_t
+ * 
+ * @brief Notifications subscribers table entry data structure
+ * 
+ * Holds a task notified by the object updates and the notifications it gets: the batched edges it's subscribed to by addEdgsSbscrbr(const TaskHandle_t&, const uint32_t&), the edges it's set for by the setTskToNtfy* methods and the packed status bits edges it's subscribed to by addSttsSbscrbr(const TaskHandle_t&, const uint32_t&, const uint32_t&). An entry whose masks are all 0 is free.
+ * 
+ * @param sbscrbrTsk Subscribed task
+ * @param edgsMsk Batched edges notification bits the task is subscribed to
+ * @param lgcyEdgsMsk Batched edges notification bits of the setTskToNtfy* methods the task is set by, lsSwtchOtptsChngEdgBit selecting the packed status value notification of setTskToNtfyLsSwtchOtptsChng(const TaskHandle_t&)
+ * @param rsngEdgsMsk Packed status bits whose false to true change notifies the task
+ * @param fllngEdgsMsk Packed status bits whose true to false change notifies the task
+ */
+struct lsSwtchSbscrbr_t{
+   TaskHandle_t sbscrbrTsk;
+   uint32_t edgsMsk;
+   uint32_t lgcyEdgsMsk;
+   uint32_t rsngEdgsMsk;
+   uint32_t fllngEdgsMsk;
+};
+
+/**
+ * @struct lsSwtchCbDsptchStts_t
+ * 
+ * @brief Callback dispatch statistics data structure
+ * 
+ * Holds the statistics kept by a LimbsSftyLnFSwtch object about its callback dispatch task, as returned by getCbDsptchStts().
+ * 
+ * @param dsptchdQty Quantity of callback functions executed by the dispatch task
+ * @param ovrflwQty Quantity of callback function execution requests that found the queue full, each one forced an emergency stop. The turn off requests were executed by the update code, the rest were dropped
+ * @param maxQueDpth Maximum quantity of entries found in the queue when an entry was taken for execution, the entry taken included
+ * @param maxQueWtTmUs Maximum time -in microseconds- an entry waited in the queue before its function execution started
+ * @param maxExctTmUs Maximum callback function execution time -in microseconds-
+ * @param ttlExctTmUs Added up execution time -in microseconds- of all the callback functions executed, the mean execution time is ttlExctTmUs / dsptchdQty
+ */
+struct lsSwtchCbDsptchStts_t{
+   uint32_t dsptchdQty;
+   uint32_t ovrflwQty;
+   uint32_t maxQueDpth;
+   uint32_t maxQueWtTmUs;
+   uint32_t maxExctTmUs;
+   uint64_t ttlExctTmUs;
+};
+
+/**
+ * @struct lsSwtchEmrgncyStts_t
+ * 
+ * @brief Emergency stop statistics data structure
+ * 
+ * Holds the statistics kept by a LimbsSftyLnFSwtch object about its emergency stops and recoveries, as returned by getEmrgncyStts(). The reaction times are measured from the emergency stop request -the emergency stop input Interrupt Service Routine or the trgrEmrgncyStp() execution-, in the esp_timer time base.
+ * 
+ * @param emrgncyStpQty Quantity of emergency stops that moved the FDA to the stEmrgncyExcpHndl state
+ * @param maxOtptsOffTmUs Maximum time -in microseconds- from the request to the output stage pins set to their inactive levels, registered only by the requests that wrote the pins
+ * @param maxFdaEntryTmUs Maximum time -in microseconds- from the request to the FDA entering the stEmrgncyExcpHndl state
+ * @param lstFdaEntryTmUs Time -in microseconds- from the last request to the FDA entering the stEmrgncyExcpHndl state
+ * @param rcvrQty Quantity of successful recoveries executed by rcvrEmrgncyStp()
+ * @param rcvrRfsdQty Quantity of recoveries refused by rcvrEmrgncyStp() while in the stEmrgncyExcpHndl state
+ * @param lstHltTmUs Time -in microseconds- the FDA was held in the stEmrgncyExcpHndl state before the last recovery
+ */
+struct lsSwtchEmrgncyStts_t{
+   uint32_t emrgncyStpQty;
+   uint32_t maxOtptsOffTmUs;
+   uint32_t maxFdaEntryTmUs;
+   uint32_t lstFdaEntryTmUs;
+   uint32_t rcvrQty;
+   uint32_t rcvrRfsdQty;
+   uint64_t lstHltTmUs;
+};
+
+/**
+ * @struct lsSwtchSttstcSmmry_t
+ * 
+ * @brief Streaming statistic summary data structure
+ * 
+ * Holds the summary of a series of samples computed by a LsSwtchStrmSttstc object, with constant memory use regardless of the quantity of samples.
+ * 
+ * @param smplsQty Quantity of samples added to the series
+ * @param min Minimum sample value
+ * @param max Maximum sample value
+ * @param mean Mean of the samples values
+ * @param stdDev Standard deviation of the samples values
+ * @param p50 Estimated 50th percentile (median) of the samples values
+ * @param p90 Estimated 90th percentile of the samples values
+ * @param p99 Estimated 99th percentile of the samples values
+ */
+struct lsSwtchSttstcSmmry_t{
+   uint32_t smplsQty;
+   float min;
+   float max;
+   float mean;
+   float stdDev;
+   float p50;
+   float p90;
+   float p99;
+};
+
+/**
+ * @struct lsSwtchPrdSttstcs_t
+ * 
+ * @brief Production statistics data structure
+ * 
+ * Holds the production statistics kept by a LimbsSftyLnFSwtch object since its instantiation or since the last rstPrdSttstcs() execution, as returned by getPrdSttstcs(). All the times are in milliseconds.
+ * 
+ * @param cyclsQty Quantity of production cycles completed
+ * @param bthHndsMssdQty Quantity of times both hands were pressed and one of them was released before the foot switch press
+ * @param cyclsPerHr Production cycles per hour, computed from the mean cycle period
+ * @param cyclPrd Summary of the cycle periods: time from a production cycle start to the next one, including the idle time
+ * @param idleTm Summary of the idle times: time from a production cycle end to the next production cycle start
+ * @param rctnTm Summary of the operator reaction times: time from both hands pressed to the foot switch press starting the production cycle
+ */
+struct lsSwtchPrdSttstcs_t{
+   uint32_t cyclsQty;
+   uint32_t bthHndsMssdQty;
+   float cyclsPerHr;
+   lsSwtchSttstcSmmry_t cyclPrd;
+   lsSwtchSttstcSmmry_t idleTm;
+   lsSwtchSttstcSmmry_t rctnTm;
+};
+
+/**
+ * @struct lsSwtchPrfHstgrm_t
+ * 
+ * @brief Update stage timing histogram data structure
+ * 
+ * Holds the durations distribution of one of the update stages of a LimbsSftyLnFSwtch object, as returned by getPrfHstgrm(). The durations are measured in ticks of the performance counter: CPU clock cycles on target, getPrfTcksPerUs() ticks make a microsecond.
+ * 
+ * @param smplsQty Quantity of updates timed
+ * @param minTcks Minimum duration
+ * @param maxTcks Maximum duration
+ * @param ttlTcks Added up duration of all the updates timed, the mean duration is ttlTcks / smplsQty
+ * @param bckts Logarithmic histogram, bckts[n] is the quantity of durations in the [2^n, 2^(n+1)) ticks range, bckts[0] includes the 0 ticks durations and bckts[_prfHstgrmBcktsQty - 1] includes every duration longer than its range
+ */
+struct lsSwtchPrfHstgrm_t{
+   uint32_t smplsQty;
+   uint32_t minTcks;
+   uint32_t maxTcks;
+   uint64_t ttlTcks;
+   uint32_t bckts[_prfHstgrmBcktsQty];
+};
+
+/**
+ * @struct lsSwtchWcetRcrd_t
+ * 
+ * @brief Worst case execution time record data structure
+ * 
+ * Holds the longest durations observed for the object updates executed from a FDA state, or for the FDA steps producing a FDA transition, as returned by getWcetSttRcrd() and getWcetTrnstnRcrd(). The durations are measured in ticks of the performance counter: CPU clock cycles on target, getPrfTcksPerUs() ticks make a microsecond.
+ * 
+ * @param smplsQty Quantity of updates -state records- or FDA steps -transition records- timed
+ * @param maxFdaTcks Longest FDA duration: every FDA step of the update for a state record, the transition's own FDA step for a transition record
+ * @param maxLckHldTcks Longest object lock hold time of the updates, the time the interrupts stay masked in the executing core
+ * @param maxUpdTcks Longest whole update duration, including the tasks notifications and functions executions
+ * @param lckHldOvrBndQty Quantity of updates whose lock hold time exceeded the bound set by setWcetLckHldBndUs(const uint32_t&), always 0 with no bound set
+ */
+struct lsSwtchWcetRcrd_t{
+   uint32_t smplsQty;
+   uint32_t maxFdaTcks;
+   uint32_t maxLckHldTcks;
+   uint32_t maxUpdTcks;
+   uint32_t lckHldOvrBndQty;
+};
+
+/**
+ * @struct lsSwtchTrnstnRcrd_t
+ * 
+ * @brief Transition record data structure
+ * 
+ * Holds a status change registered by a LimbsSftyLnFSwtch object in its transitions ring, as returned by getTrnstnRcrds().
+ * 
+ * @param tmUs Time -in microseconds, object's time base- of the update that produced the change
+ * @param otptsSttsPkgd Packed status value after the change, encoded as documented in lssOtptsSttsUnpkg(uint32_t)
+ * @param fdaStt FDA state after the change: 0 Switch off, not both hands pressed; 1 Switch off, both hands pressed, foot not pressed; 2 Start latch release and production cycle; 3 Latch release phase; 4 Production cycle phase; 5 Emergency stop
+ */
+struct lsSwtchTrnstnRcrd_t{
+   uint64_t tmUs;
+   uint32_t otptsSttsPkgd;
+   uint8_t fdaStt;
+};
+
+class LimbsSftyLnFSwtch;
+class LsSwtchGrp;
+
+/**
+ * @struct lsSwtchInptIsrArg_t
+ * 
+ * @brief Input edge interrupt argument data structure
+ * 
+ * Holds the data the GPIO edge Interrupt Service Routine needs to identify the input that produced the interrupt and to compute its level, as no object method can be executed from the ISR.
+ * 
+ * @param lsSwtchObj Pointer to the LimbsSftyLnFSwtch object the input belongs to
+ * @param inptId Input identification: lftHndInptId, rghtHndInptId or ftInptId
+ * @param inptPin GPIO pin number connected to the switch
+ * @param prssdLvl GPIO pin level corresponding to the pressed switch, computed from the typeNO and pulledUp hardware attributes
+ * @param pulledUp Internal pull-up circuit configuration, as set in the swtchInptHwCfg_t::pulledUp hardware attribute
+ */
+struct lsSwtchInptIsrArg_t{
+   LimbsSftyLnFSwtch* lsSwtchObj;
+   uint8_t inptId;
+   uint8_t inptPin;
+   bool prssdLvl;
+   bool pulledUp;
+};
 //===================================================>> END User defined types
 
 //======================================>> BEGIN General use function prototypes
@@ -274,6 +659,51 @@ struct lsSwtchSwCfg_t{
  * @return A lsSwtchOtpts_t type element containing the information decoded
  */
 lsSwtchOtpts_t lssOtptsSttsUnpkg(uint32_t pkgOtpts);
+
+/**
+ * @brief Packs a LimbsSftyLnFSwtch status into a 32-bit value.
+ * 
+ * Inverse of lssOtptsSttsUnpkg(uint32_t), the 32-bit value is encoded as documented there, the bits not related to the status are set to 0.
+ * 
+ * @param otpts A lsSwtchOtpts_t type element containing the status to encode
+ * @return A 32-bit value holding the status encoded
+ * 
+ * @note Both functions move all the flags in a fixed sequence of shift and mask operations, without a conditional branch per flag, as they are executed in every update and every status consumer read
+ */
+uint32_t lssOtptsSttsPkg(const lsSwtchOtpts_t &otpts);
+
+/**
+ * @brief Unpacks a LimbsSftyLnFSwtch extended status word.
+ * 
+ * The 64-bit extended status word adds to the 32-bit packed status the FDA state, the current phase times and the publication sequence number.
+ * <pre>
+ * `+--+-+--++--+-+--++--+-+--++--+--+--+-+--+`  
+ * `|63|~|49||48|~|31||30|~|13||12|11|10|~|00|`  
+ * ` ------   ------   ------   --------  ----`  
+ * `   |        |        |         |       |`  
+ * `   |        |        |         |       Packed status bits, as in lssOtptsSttsUnpkg(uint32_t)`  
+ * `   |        |        |         fdaStt`  
+ * `   |        |        phsElpsdTm`  
+ * `   |        phsRmngTm`  
+ * `   seqNum`  
+ * </pre>
+ * An HMI might render the current phase progress as phsElpsdTm / (phsElpsdTm + phsRmngTm) from a single getLsSwtchOtptsSttsExtd() read.
+ * 
+ * @param pkgOtptsExtd A 64-bit value holding a LimbsSftyLnFSwtch extended status encoded
+ * @return A lsSwtchOtptsExtd_t type element containing the information decoded
+ */
+lsSwtchOtptsExtd_t lssOtptsSttsExtdUnpkg(uint64_t pkgOtptsExtd);
+
+/**
+ * @brief Returns the quantity of publications between two extended status sequence numbers.
+ * 
+ * The extended status sequence number wraps around every 32768 publications, the difference is computed modulo 32768.
+ * 
+ * @param newSeqNum Sequence number of the later read
+ * @param oldSeqNum Sequence number of the earlier read
+ * @return The quantity of publications from oldSeqNum to newSeqNum. 0 means no new status was published between the reads
+ */
+uint16_t lssExtdSeqNumDlt(uint16_t newSeqNum, uint16_t oldSeqNum);
 //========================================>> END General use function prototypes
 
 //===========================>> BEGIN General use Static variables and constants
@@ -282,6 +712,51 @@ static BaseType_t errorFlag {pdFALSE};
 //=============================>> END General use Static variables and constants
 
 //=================================================>> BEGIN Classes declarations
+/**
+ * @class LsSwtchStrmSttstc
+ * 
+ * @brief Models a constant memory streaming statistic estimator for a series of samples.
+ * 
+ * The minimum, maximum, mean and variance are computed exactly by the Welford online algorithm. The 50th, 90th and 99th percentiles are estimated by the P-square algorithm, which keeps five markers for each quantile instead of the samples. The estimation is exact up to five samples and converges as the samples are added.
+ */
+class LsSwtchStrmSttstc{
+protected:
+   float _m2{0.0};
+   float _max{0.0};
+   float _mean{0.0};
+   float _min{0.0};
+   float _qntlMrkrDsrdPos[_sttstcQntlsQty][5]{};
+   float _qntlMrkrHght[_sttstcQntlsQty][5]{};
+   int32_t _qntlMrkrPos[_sttstcQntlsQty][5]{};
+   uint32_t _smplsQty{0};
+
+   static const float _qntlsPrbblty[_sttstcQntlsQty];
+
+   float _getQntl(const uint8_t &qntlIdx) const;
+   void _updQntl(const uint8_t &qntlIdx, const float &smpl);
+public:
+   /**
+    * @brief Adds a sample to the series
+    * 
+    * @param smpl Value of the sample to add
+    */
+   void addSmpl(const float &smpl);
+   /**
+    * @brief Gets the summary of the series
+    * 
+    * @param smmry Reference to the lsSwtchSttstcSmmry_t structure to copy the summary to. If no sample was added all its values are set to 0
+    */
+   void getSmmry(lsSwtchSttstcSmmry_t &smmry) const;
+   /**
+    * @brief Returns the quantity of samples added to the series
+    */
+   uint32_t getSmplsQty() const;
+   /**
+    * @brief Discards the series, the estimator restarts with no samples
+    */
+   void rst();
+};
+
 /**
  * @class LimbsSftyLnFSwtch
  * 
@@ -299,6 +774,10 @@ static BaseType_t errorFlag {pdFALSE};
 class LimbsSftyLnFSwtch{
 private:
   const unsigned long int _minVoidTime{1000};
+
+  friend class LsSwtchGrp;
+
+protected:
   enum fdaLsSwtchStts {
 		stOffNotBHP,   /*State: Switch off, NOT both hands pressed*/
 		stOffBHPNotFP, /*State: Switch off, both hands pressed, NOT foot press*/
@@ -307,8 +786,32 @@ private:
       stEndCycl,   /*State: End production cycle, restart FDA*/
       stEmrgncyExcpHndl   /*State: Handle received Emergency Exception signal*/
 	};
+#if _lsSwtchPrfInstr
+   struct fdaStpPrf_t{
+      uint8_t frmStt;
+      uint8_t toStt;
+      uint32_t tcks;
+   };
+#endif
+   static const uint8_t _fdaSttsQty{stEmrgncyExcpHndl + 1};
+   enum lsSwtchPndngActn : uint8_t {
+      actnBthHndsOnMssd = 0x01,  /*Both hands on missed tasks notification and function execution pending*/
+      actnTrnOnLtchRls = 0x02,   /*Latch release turned on tasks notification and function execution pending*/
+      actnTrnOnPrdCycl = 0x04,   /*Production cycle turned on tasks notification and function execution pending*/
+      actnTrnOffLtchRls = 0x08,  /*Latch release turned off tasks notification and function execution pending*/
+      actnTrnOffPrdCycl = 0x10,  /*Production cycle turned off tasks notification and function execution pending*/
+      actnOtptsChng = 0x20 /*Packed status changed, subscribers notification pending*/
+   };
+   struct prdSmpls_t{
+      bool pndng;          // Durations captured by the FDA, pending to be added to the production statistics summaries
+      bool cyclPrdVld;
+      bool idleTmVld;
+      uint64_t cyclPrdUs;
+      uint64_t idleTmUs;
+      uint64_t rctnTmUs;
+   };
+   static const uint8_t _ntfySbscrbrsQty{_maxEdgsSbscrbrsQty + _maxSttsSbscrbrsQty + 6};   // Notifications subscribers table entries: the subscriptions and the six setTskToNtfy* methods tasks
 
-protected:
    swtchInptHwCfg_t _lftHndInpCfg{};
    swtchBhvrCfg_t _lftHndBhvrCfg{};
    swtchInptHwCfg_t _rghtHndInpCfg{};
@@ -318,21 +821,32 @@ protected:
 
    MpbOtpts_t _lftHndSwtchStts{};
    TmVdblMPBttn* _undrlLftHndMPBPtr{nullptr};
+#if _lsSwtchStcAlloc
+   alignas(TmVdblMPBttn) uint8_t _undrlLftHndMPBBuf[sizeof(TmVdblMPBttn)];
+#endif
 
    MpbOtpts_t _rghtHndSwtchStts{};
    TmVdblMPBttn* _undrlRghtHndMPBPtr{nullptr};
+#if _lsSwtchStcAlloc
+   alignas(TmVdblMPBttn) uint8_t _undrlRghtHndMPBBuf[sizeof(TmVdblMPBttn)];
+#endif
 
    MpbOtpts_t _ftSwtchStts{};
    SnglSrvcVdblMPBttn* _undrlFtMPBPtr{nullptr};   
+#if _lsSwtchStcAlloc
+   alignas(SnglSrvcVdblMPBttn) uint8_t _undrlFtMPBBuf[sizeof(SnglSrvcVdblMPBttn)];
+#endif
 
    unsigned long int _undrlSwtchsPollDelay{_minPollDelay};
 
    unsigned long int _curTimeMs{0};
+   uint64_t _curTimeUs{0};
    bool _ltchRlsIsOn{false};
-   static bool _ltchRlsPndng;
+   bool _ltchRlsPndng{false};
+   uint64_t _bthHndsOnTmUs{0};
    unsigned long int _ltchRlsTtlTm{0};
    bool _prdCyclIsOn{false};
-   unsigned long int _prdCyclTmrStrt{0};
+   uint64_t _prdCyclTmrStrtUs{0};
    unsigned long int _prdCyclTtlTm{0};  
 	
    fncVdPtrPrmPtrType _fnWhnBthHndsOnMssd{nullptr};
@@ -347,12 +861,109 @@ protected:
    void* _fnWhnTrnOnLtchRlsArg {nullptr};
 	void* _fnWhnTrnOnPrdCyclArg {nullptr};
 
+   bool _cbDsptchd{false};
+   lsSwtchCbEvnt_t _cbDsptchQue[_cbDsptchQueSz]{};
+   std::atomic<uint32_t> _cbDsptchQueHd{0};
+   std::atomic<uint32_t> _cbDsptchQueTl{0};
+   lsSwtchCbDsptchStts_t _cbDsptchStts{};
+   limbSftyFwConf_t _cbDsptchTskCnfg{};
+   TaskHandle_t _cbDsptchTskHndl{NULL};
+   const char* _cbDsptchTskName{"lsSwtchCbDsptchTsk"};
+#if _lsSwtchStcAlloc
+   StaticTask_t _cbDsptchTskBuf{};
+   StackType_t _cbDsptchTskStck[_cbDsptchTskStckSz / sizeof(StackType_t)]{};
+#endif
+   uint8_t _edgsSbscrbrsQty{0};
+   int64_t _emrgncyStpEntryTmUs{0};
+   volatile bool _emrgncyStpInptActv{false};
+   bool _emrgncyStpIsrAttchd{false};
+   lsSwtchInptIsrArg_t _emrgncyStpIsrArg{};
+   volatile bool _emrgncyStpPndng{false};
+   int64_t _emrgncyStpRqstTmUs{0};
+   lsSwtchEmrgncyStts_t _emrgncyStpStts{};
+   bool _evntDrvn{false};
+   lsSwtchInptIsrArg_t _inptIsrArg[3]{};
+   volatile bool _inptRsmplPndng{false};
    fdaLsSwtchStts _lsSwtchFdaState {stOffNotBHP};
+   bool _lsSwtchGrpd{false};
    bool _lsSwtchOtptsChng{false};
    uint32_t _lsSwtchOtptsChngCnt{0};
+   mutable portMUX_TYPE _lsSwtchMux portMUX_INITIALIZER_UNLOCKED;
+#if _lsSwtchStcAlloc
+   TimerHandle_t _lsSwtchPhsTmrHndl {NULL};
+#else
+   esp_timer_handle_t _lsSwtchPhsTmrHndl {NULL};
+#endif
    TimerHandle_t _lsSwtchPollTmrHndl {NULL};
+#if _lsSwtchStcAlloc
+   StaticTimer_t _lsSwtchPhsTmrBuf{};
+   StaticTimer_t _lsSwtchPollTmrBuf{};
+#endif
+   lsSwtchSbscrbr_t _ntfySbscrbr[_ntfySbscrbrsQty]{};
+   uint16_t _ntfySbscrbrSlts{0};
+   uint64_t _otptPinsActHghMsk{0};
+   uint64_t _otptPinsActvMsk{0};
+   uint64_t _otptPinsMsk{0};
+   fncOtptPinsWrtPtrType _otptPinsWrtFnPtr{nullptr};
+   void* _otptPinsWrtArgPtr{nullptr};
+   bool _otptPinsWrttn{false};
+   uint64_t _ltchRlsOtptPinMsk{0};
+   uint64_t _prdCyclOtptPinMsk{0};
+   bool _phsTmrArmd{false};
+   uint64_t _phsTmrDdlnUs{0};
+   bool _phsTmrDrvn{false};
+   uint8_t _pndngActns{0};
+   uint32_t _prdBthHndsMssdQty{0};
+#if _lsSwtchPrfInstr
+   lsSwtchPrfHstgrm_t _prfHstgrm[_prfStgsQty]{};
+#endif
+   uint64_t _prdCyclEndTmUs{0};
+   LsSwtchStrmSttstc _prdCyclPrdSttstc{};
+   uint32_t _prdCyclsQty{0};
+   bool _prdCyclStrtd{false};
+   LsSwtchStrmSttstc _prdIdleTmSttstc{};
+   uint64_t _prdLstCyclStrtTmUs{0};
+   LsSwtchStrmSttstc _prdRctnTmSttstc{};
+   prdSmpls_t _prdSmpls{};
+   mutable portMUX_TYPE _prdSttstcsMux portMUX_INITIALIZER_UNLOCKED;  // Protects the production statistics summaries, kept out of the object lock
    bool _sttChng{true};
-   String _swtchPollTmrName{"lsSwtchPollTmr"};
+   uint32_t _sttsChngSeq{1};  // Sequence number of the seeded initial status, incremented by each published change
+   std::atomic<uint8_t> _sttsSnpshtFdaStt{0};
+   std::atomic<uint32_t> _sttsSnpshtPhsElpsdTm{0};
+   std::atomic<uint32_t> _sttsSnpshtPhsRmngTm{0};
+   std::atomic<uint32_t> _sttsSnpshtPkgd{0};
+   std::atomic<uint32_t> _sttsSnpshtSeq{0};
+   std::atomic<unsigned long int> _sttsSnpshtTm{0};
+   uint8_t _sttsSbscrbrsQty{0};
+   uint16_t _sttsSbscrbrsToNtfy{0};
+   EventGroupHandle_t _sttsWtrsEvntGrpHndl{NULL};
+#if _lsSwtchStcAlloc
+   StaticEventGroup_t _sttsWtrsEvntGrpBuf{};
+#endif
+   uint8_t _sttsWtrsSlts{0};
+   uint8_t _sttsWtrsToWk{0};
+   const char* _swtchPhsTmrName{"lsSwtchPhsTmr"};
+   const char* _swtchPollTmrName{"lsSwtchPollTmr"};
+   fncTmSrcPtrType _tmSrcFnPtr{nullptr};
+   fncTmSrcUsPtrType _tmSrcUsFnPtr{nullptr};
+   void* _tmSrcArgPtr{nullptr};
+   uint32_t _tmSrcLstMs{0};
+   uint64_t _tmSrcMsHgh{0};   // Milliseconds time source extension to 64 bits, 2^32 ms added at each wrap around of the source's 32 bits counter
+   portMUX_TYPE _tmSrcMux portMUX_INITIALIZER_UNLOCKED;
+   uint8_t _trnstnLstFdaStt{0xFF};
+   uint32_t _trnstnLstOtptsSttsPkgd{0};
+   bool _trnstnRcrdd{false};
+   lsSwtchTrnstnRcrd_t _trnstnRng[_trnstnRngSz]{};
+   std::atomic<uint32_t> _trnstnRngHd{0};
+   std::atomic<uint32_t> _trnstnRngOvrrnQty{0};
+   std::atomic<uint32_t> _trnstnRngTl{0};
+   bool _undrlSwtchsMdld{false};
+   undrlSwtchMdl_t _undrlSwtchsMdl[3]{};
+#if _lsSwtchPrfInstr
+   uint32_t _wcetLckHldBndTcks{0};
+   lsSwtchWcetRcrd_t _wcetStt[_fdaSttsQty]{};
+   lsSwtchWcetRcrd_t _wcetTrnstn[_fdaSttsQty][_fdaSttsQty]{};
+#endif
 
    TaskHandle_t _tskToNtfyBthHndsOnMssd{NULL};
    TaskHandle_t _tskToNtfyLsSwtchOtptsChng{NULL};
@@ -361,22 +972,77 @@ protected:
    TaskHandle_t _tskToNtfyTrnOnLtchRls{NULL};
    TaskHandle_t _tskToNtfyTrnOnPrdCycl{NULL};
 
+   static void lsSwtchCbDsptchTsk(void* lsSwtchObjArg);
+#if _lsSwtchStcAlloc
+	static void lsSwtchPhsTmrCb(TimerHandle_t lssTmrCbArg);
+#else
+   static void lsSwtchPhsTmrCb(void* lsSwtchObjArg);
+   static void _phsDdlnCb(void* lsSwtchObjArg, uint32_t ulParameter2);
+#endif
 	static void lsSwtchPollCb(TimerHandle_t lssTmrCbArg);
+   static void _ftSwtchTrnOnCb(void* lsSwtchObjArg);
+   static uint32_t _getPrfTcks();
+   static void _emrgncyStpCb(void* lsSwtchObjArg, uint32_t ulParameter2);
+   static void _emrgncyStpIsr(void* isrArgPtr);
+   static void _inptEvntCb(void* lsSwtchObjArg, uint32_t inptEvnt);
+   static void _inptIsr(void* isrArgPtr);
+   static bool _rdInptPinLvl(const uint8_t &inptPin);
 
    void _ackBthHndsOnMssd();
+   bool _attchInptIsrs();
+   bool _bgnCbDsptchTsk();
+   bool _bgnEmrgncyStpInpt();
+   bool _bgnSttsWtrs();
    void _clrSttChng();
    bool _cnfgHndSwtch(const bool &isLeft, const swtchBhvrCfg_t &newCfg);
+   bool _deqCb(lsSwtchCbEvnt_t &cbEvnt, uint32_t &queDpth);
+   bool _enqCb(fncVdPtrPrmPtrType fnToExct, void* fnToExctArg, const bool &isTrnOff);
+   void _entrEmrgncyStp();
+   void _exctActn(fncVdPtrPrmPtrType fnToExct, void* fnToExctArg, const bool &isTrnOff);
+   void _addPrdSmpls(const prdSmpls_t &prdSmpls);
+   void _exctPndngActns();
+   uint8_t _getNtfySbscrbr(const TaskHandle_t &sbscrbrTsk, const bool &alloc);
    void _getUndrlSwtchStts();
+   DbncdMPBttn* _getUndrlSwtchPtr(const uint8_t &inptId);
+   bool _isPhsTmrWt();
+   bool _isQscnt();
    uint32_t _lsSwtchOtptsSttsPkgd(uint32_t prevVal = 0);
+   void _pblshSttsSnpsht(const bool &isSd = false);
+   void _pshTrnstnRcrd(const uint32_t &otptsSttsPkgd);
+#if _lsSwtchPrfInstr
+   void _prfFdaStp(fdaStpPrf_t* prfFdaStps, uint8_t &prfFdaStpsQty, const uint8_t &prfFdaStpsSz);
+   static void _prfLap(uint32_t (&prfStgTcks)[_prfStgsQty], uint32_t &prfLapStrtTcks, const uint8_t &prfStgId);
+   void _rcrdPrfSmpls(const uint32_t (&prfStgTcks)[_prfStgsQty], const uint8_t &updFrmStt, const fdaStpPrf_t* fdaStps, const uint8_t &fdaStpsQty);
+   static void _rcrdWcetSmpl(lsSwtchWcetRcrd_t &rcrd, const uint32_t &fdaTcks, const uint32_t (&prfStgTcks)[_prfStgsQty], const bool &lckHldOvrBnd);
+#endif
+   void _rdUndrlSwtchsInpts();
+   void _rqstEmrgncyStp(const bool &frmIsr);
 	void _rstOtptsChngCnt();
-   static void _setLtchRlsPndng();
+   void _rstTmSrcWrp();
+   void _setLtchRlsPndng();
    void _setSttChng();
+   void _setTskToNtfy(TaskHandle_t &tskToNtfy, const TaskHandle_t &newTaskHandle, const uint32_t &edgBit);
+   void _setUndrlSwtchEnbld(const uint8_t &inptId, const bool &newVal);
+   void _setUndrlSwtchInptLvl(const uint8_t &inptId, const bool &isPrssd, const unsigned long int &evntTm);
+   void _setUndrlSwtchIsOnDsbld(const uint8_t &inptId, const bool &newVal);
+   void _setUndrlSwtchPrssd(const uint8_t &inptId, const bool &isPrssd, const unsigned long int &evntTm);
    void _turnOffLtchRls();
    void _turnOnLtchRls();
    void _turnOffPrdCycl();
    void _turnOnPrdCycl();
    unsigned long int _updCurTimeMs();
    void _updFdaState();
+   void _updPrdSttstcsCyclEnd();
+   void _updPrdSttstcsCyclStrt();
+   void _updGrpdLsSwtch(const uint64_t &gpioInptsLvl, const bool &inptsDbncd);
+   void _updLsSwtch();
+   void _updNtfySbscrbr(const uint8_t &sbscrbrIdx);
+   void _updOtptPins();
+   void _updPhsTmrStt();
+   void _updPollTmrStt();
+   void _updUndrlSwtchsDbnc();
+   void _updUndrlSwtchsMdl();
+   void _wrtOtptPins(const uint64_t &stPinsMsk, const uint64_t &clrPinsMsk);
 
 public:
   /**
@@ -390,6 +1056,8 @@ public:
    * The class models a Limbs Safety switch, a switch that gives an  activation signal to a machine or device when some independent switches, activated in a designated pattern, ensures no risk for the operator limbs is completed.
    * The constructor instantiates the DbncdMPBttn subclasses objects that compose the Limbs Safety switch, i.e. the left hand TmVdblMPBttn, the right hand TmVdblMPBttn and the foot SnglSrvcVdblMPBttn
    * 
+   * @note When the library is built with the _lsSwtchStcAlloc flag set to 1 the DbncdMPBttn subclasses objects are constructed in place inside the object, and the begin(unsigned long int) method creates the FreeRTOS timers and the callback dispatch task on buffers also held by the object, so no heap memory is used by the LimbsSftyLnFSwtch code. The lsSwtchRamFtprnt constant reports the resulting object size.
+   * 
    * @param lftHndInpCfg A swtchInptHwCfg_t structure containing the hardware implemented characteristics for the left hand controlled TmVdblMPBttn
    * @param lftHndBhvrCfg A swtchBhvrCfg_t structure containing the behavior characteristics for the left hand controlled TmVdblMPBttn
    * @param rghtHndInpCfg A swtchInptHwCfg_t structure containing the hardware implemented characteristics for the right hand controlled TmVdblMPBttn
@@ -409,8 +1077,42 @@ public:
    /**
     * @brief Default virtual destructor
     * 
+    * The object's timers and callback dispatch task are deleted and the DbncdMPBttn subclasses objects destroyed, releasing their memory when they were heap allocated.
     */
    ~LimbsSftyLnFSwtch();
+   /**
+    * @brief Subscribes a task to the batched edges notification
+    * 
+    * Each FDA transition notifies its own task, set by the setTskToNtfy* methods, so an update producing several edges -i.e. the production cycle start turns on both the latch release and the production cycle- issues several notifications, and a task interested in several edges is unblocked once for each of them. The batched edges notification coalesces all the edges produced by an update in a single notification to each subscribed task, using the notification value bits: bthHndsOnMssdEdgBit, ltchRlsTrnOnEdgBit, prdCyclTrnOnEdgBit, ltchRlsTrnOffEdgBit and prdCyclTrnOffEdgBit.
+    * 
+    * The notification is issued with the eSetBits action, so the edges not yet taken by the subscriber are kept, the subscriber might take them and clear them with a single xTaskNotifyWait(0x00, 0xFFFFFFFF, &edgsBits, timeout) execution. Each subscriber selects the edges it's notified for with its edges mask, i.e. a logger, a HMI and a PLC bridge might get the same edges, or each one only those it needs, without chaining tasks.
+    * 
+    * The subscribers, the tasks set by the setTskToNtfy* methods and the filtered status change subscribers are entries of a single fixed capacity table, all of them notified by a single loop after each update: the setTskToNtfy* tasks are notified with their event edge bit, the setTskToNtfyLsSwtchOtptsChng(const TaskHandle_t&) task and the status subscribers with the packed status value.
+    * 
+    * @param sbscrbrTsk TaskHandle_t of the task to subscribe
+    * @param edgsMsk Edges the task is notified for, any combination of bthHndsOnMssdEdgBit, ltchRlsTrnOnEdgBit, prdCyclTrnOnEdgBit, ltchRlsTrnOffEdgBit, prdCyclTrnOffEdgBit and lsSwtchOtptsChngEdgBit. The default value, lsSwtchTrnstnsEdgsMsk, selects all the FDA transitions edges
+    * @retval true The task was subscribed
+    * @retval false The sbscrbrTsk is NULL, the edgsMsk selects no edge, the task was already subscribed or the subscribers quantity limit (_maxEdgsSbscrbrsQty) was reached
+    * 
+    * @note A task set by the setTskToNtfy* methods might be subscribed too, the notification carries the bits of both. A task subscribed by addSttsSbscrbr(const TaskHandle_t&, const uint32_t&, const uint32_t&) gets the packed status value when its status edges match, as the value is overwritten.
+    */
+   bool addEdgsSbscrbr(const TaskHandle_t &sbscrbrTsk, const uint32_t &edgsMsk = lsSwtchTrnstnsEdgsMsk);
+   /**
+    * @brief Subscribes a task to the filtered status change notification
+    * 
+    * The task set by setTskToNtfyLsSwtchOtptsChng(const TaskHandle_t&) is notified on any change of the packed status, including the underlying switches enabled and voided flags changes the FDA produces as side effects of every production cycle. A subscribed task is notified only when one of the packed status bits selected by its masks changes in the selected direction, i.e. a task driving a production cycle lamp subscribed with (1UL << LsSwtchPrdCyclIsOnBP) as both masks is never unblocked by the hands switches flags changes.
+    * 
+    * The edges are computed between consecutive packed status publications, so a flag turned on and off inside a single object update produces no edge. The notification is issued with the eSetValueWithOverwrite action, the notification value being the packed status -encoded as documented in lssOtptsSttsUnpkg(uint32_t)- published by the object update that selected the subscribers, captured with them under the object lock, not a later read that might hold a value whose edges didn't match the masks.
+    * 
+    * @param sbscrbrTsk TaskHandle_t of the task to subscribe
+    * @param rsngEdgsMsk Packed status bits whose false to true change notifies the task
+    * @param fllngEdgsMsk Packed status bits whose true to false change notifies the task
+    * @retval true The task was subscribed
+    * @retval false The sbscrbrTsk is NULL, both masks are 0, it was already subscribed or the subscribers quantity limit (_maxSttsSbscrbrsQty) was reached
+    * 
+    * @note The notification value is overwritten, a task subscribed by addEdgsSbscrbr(const TaskHandle_t&, const uint32_t&) or set by the setTskToNtfy* methods too loses the edges bits of the same update.
+    */
+   bool addSttsSbscrbr(const TaskHandle_t &sbscrbrTsk, const uint32_t &rsngEdgsMsk, const uint32_t &fllngEdgsMsk);
    /**
 	 * @brief Attaches the instantiated object to a timer that monitors the input pins and updates the object status.
     * 
@@ -420,6 +1122,9 @@ public:
     * @return The success in starting the updating timer with the provided update time
     * @retval true Timer starting operation success for the object and for the underlying DbncdMPBttn subclasses objects
     * @return false Timer starting operation failure for at least one of the four timers being started
+    * 
+    * @note If the event driven mode was set -see setEvntDrvn(const bool &)- the underlying DbncdMPBttn subclasses objects timers are not started, the GPIO edge interrupts are attached instead and the object's timer is kept running only while a debounce, start delay, voiding or production cycle phase time is pending.
+    * @note If the phase deadline timers mode was set -see setPhsTmrDrvn(const bool &)- a one-shot timer is created to end the latch release and production cycle phases.
     */
    bool begin(unsigned long int pollDelayMs = _minPollDelay);
    /**
@@ -463,6 +1168,20 @@ public:
     * @warning The swtchBhvrCfg_t type structure has designated default field values, as a consequence any field not expressly filled with a valid value will be set to be filled with the default value. If not all the fields are to be changed, be sure to fill the non changing fields with the current value to ensure only the intended fields are to be changed!  For that purpose keep the current configuration values always updated in variables.
     */
    bool cnfgRghtHndSwtch(const swtchBhvrCfg_t &newCfg);
+   /**
+    * @brief Returns the callback dispatch task statistics
+    * 
+    * @param stts Reference to the lsSwtchCbDsptchStts_t variable where the statistics are copied to
+    * 
+    * @note The statistics are kept only while the callback dispatch mode is set, see setCbDsptchd(const bool &, const limbSftyFwConf_t &)
+    */
+   void getCbDsptchStts(lsSwtchCbDsptchStts_t &stts) const;
+   /**
+    * @brief Returns the emergency stop statistics
+    * 
+    * @param stts Reference to the lsSwtchEmrgncyStts_t variable where the statistics are copied to
+    */
+   void getEmrgncyStts(lsSwtchEmrgncyStts_t &stts) const;
 	/**
 	 * @brief Returns the function that is set to execute every time the object's Latch Release is set to **Off State**.
 	 *
@@ -538,6 +1257,16 @@ public:
     * @retval false: no object's output related behavior attribute flags have changed value since last time **outputsChange** flag was reset.
 	 */
    const bool getLsSwtchOtptsChng() const;
+   /**
+    * @brief Returns the extended status published by the object's last update, encoded as a 64-bit value
+    * 
+    * The extended status carries the 32-bit packed status flags, the FDA state, the current phase elapsed and remaining times and the publication sequence number, all taken from the same publication. The value is read from the status snapshot (see getLsSwtchSttsSnpsht(lsSwtchSttsSnpsht_t &)) with the same lock free retries.
+    * 
+    * @param otptsSttsExtd Reference to the variable to be filled with the extended status, encoded as documented in lssOtptsSttsExtdUnpkg(uint64_t)
+    * @retval true A consistent extended status was copied to the otptsSttsExtd parameter
+    * @retval false The retries limit was reached overlapping publications, the otptsSttsExtd parameter was not modified
+    */
+   bool getLsSwtchOtptsSttsExtd(uint64_t &otptsSttsExtd) const;
    /**
     * @brief Returns the relevant attribute flags values for the object state encoded as a 32 bits value, required to pass current state of the object to another thread/task managing the outputs changes.
     *
@@ -547,8 +1276,21 @@ public:
     * 
     * @note For ease of use and resources optimization the encoded 32 bits value includes state information referenced to the underlying DbncdMPBttn subclasses objects isEnabled and isOn for each one of them. 
     @note For a complete description of the 32-bit value encoded logic see lssOtptsSttsUnpkg(uint32_t) 
+    * @note The value returned is the one published by the object's last update, read wait-free from any task or core. The underlying DbncdMPBttn subclasses objects are not accessed and the interrupts are not disabled.
     */
    uint32_t getLsSwtchOtptsSttsPkgd();
+   /**
+    * @brief Returns a consistent copy of the status published by the object's last update
+    * 
+    * Each object update publishes the packed status, the update time and a sequence number as a versioned snapshot (seqlock). Any quantity of reader tasks -HMI, telemetry- might get the snapshot without locks, without disabling interrupts and without accessing the underlying DbncdMPBttn subclasses objects. A reader that overlaps a publication retries the read, the quantity of retries is limited.
+    * 
+    * @param snpsht Reference to the lsSwtchSttsSnpsht_t variable to be filled with the snapshot
+    * @retval true A consistent snapshot was copied to the snpsht parameter
+    * @retval false The retries limit was reached overlapping publications, the snpsht parameter was not modified
+    * 
+    * @warning The snapshot is published by the object's updates, all executed by the FreeRTOS timer service task. It must not be published by any other task.
+    */
+   bool getLsSwtchSttsSnpsht(lsSwtchSttsSnpsht_t &snpsht) const;
    /**
     * @brief Returns the ltchRlsIsOn attribute flag value
     * 
@@ -581,6 +1323,62 @@ public:
     * @return The time in milliseconds the control will consider being in the production cycle state. After completing the time the cycle will be considered concluded and the limbs safety switches will be re-enabled to start a new cycle.
     */
    unsigned long int getPrdCyclTtlTm();  
+   /**
+    * @brief Returns the production statistics
+    * 
+    * The object keeps running production counters and constant memory summaries of the cycle periods, idle times between cycles and operator reaction times, updated by the FDA at each production cycle start and end. The times are measured with the object's time base, so the statistics of a LsSwtchRplyr object are computed in virtual time.
+    * 
+    * @param sttstcs Reference to the lsSwtchPrdSttstcs_t variable where the statistics are copied to
+    */
+   void getPrdSttstcs(lsSwtchPrdSttstcs_t &sttstcs) const;
+   /**
+    * @brief Returns the timing histogram of one of the update stages
+    * 
+    * When the library is built with the _lsSwtchPrfInstr flag set to 1 every object update -periodic poll, input event or phase deadline- times its stages with the performance counter and adds each stage duration to the stage histogram. The lckHldPrfStgId histogram is the time the object lock is held by the update, that is the time the interrupts stay masked in the executing core.
+    * 
+    * @param prfStgId Update stage identification, one of the update stages timing identification constants: undrlSwtchsPrfStgId, curTmPrfStgId, fdaPrfStgId, sttsPblshPrfStgId, ntfctnPrfStgId, lckHldPrfStgId or updTtlPrfStgId
+    * @param hstgrm Reference to the lsSwtchPrfHstgrm_t variable where the histogram is copied to
+    * 
+    * @retval true The prfStgId is valid and the histogram was copied
+    * @retval false The prfStgId is not valid or the library was built without the _lsSwtchPrfInstr flag set, the hstgrm was not modified
+    * 
+    * @note Without the _lsSwtchPrfInstr flag set the instrumentation is compiled out, the updates execute no timing code.
+    */
+   bool getPrfHstgrm(const uint8_t &prfStgId, lsSwtchPrfHstgrm_t &hstgrm) const;
+   /**
+    * @brief Returns the performance counter ticks per microsecond
+    * 
+    * @return The CPU clock frequency in MHz on target, 1000 on host builds, where the performance counter is the nanoseconds monotonic clock
+    */
+   static uint32_t getPrfTcksPerUs();
+   /**
+    * @brief Returns the cbDsptchd attribute flag value
+    * 
+    * @retval true The functions set to be executed when the object's outputs change are executed by the object's callback dispatch task
+    * @retval false The functions set to be executed when the object's outputs change are executed by the FreeRTOS timer service task
+    */
+   const bool getIsCbDsptchd() const;
+   /**
+    * @brief Returns the evntDrvn attribute flag value
+    * 
+    * @retval true The object's inputs are processed when the GPIO edge interrupts are received
+    * @retval false The object's inputs are processed by fixed period polling
+    */
+   const bool getIsEvntDrvn() const;
+   /**
+    * @brief Returns the phsTmrDrvn attribute flag value
+    * 
+    * @retval true The latch release and production cycle phases are ended by one-shot deadline timers
+    * @retval false The latch release and production cycle phases are ended by the periodic timer updates
+    */
+   const bool getIsPhsTmrDrvn() const;
+   /**
+    * @brief Returns the trnstnRcrdd attribute flag value
+    * 
+    * @retval true Every status change is registered in the object's transitions ring
+    * @retval false The transitions ring is not used
+    */
+   const bool getIsTrnstnRcrdd() const;
    /**
     * @brief Returns the rghtHndSwcthPtr attribute value
     * 
@@ -641,12 +1439,124 @@ public:
     * @note When the value returned is NULL, the task notification mechanism is disabled. The mechanism can be enabled by setting a valid TaskHandle value by using the setTskToNtfyTrnOnPrdCycl(const TaskHandle_t) method.
 	 */
    const TaskHandle_t getTskToNtfyTrnOnPrdCycl() const;
+   /**
+    * @brief Takes the oldest records from the transitions ring
+    * 
+    * Copies up to maxRcrdsQty records, oldest first, and frees their ring entries. The ring is lock-free single producer - single consumer: the object's update code is the producer and a single task must be the consumer, draining the ring in batches often enough for it not to overflow. The task set by setTskToNtfyLsSwtchOtptsChng(const TaskHandle_t &) is a convenient consumer, as it's notified after each update producing a status change.
+    * 
+    * @param rcrds Pointer to the lsSwtchTrnstnRcrd_t array where the records are copied to
+    * @param maxRcrdsQty Quantity of records the rcrds array can hold
+    * 
+    * @return The quantity of records copied, 0 if the ring is empty
+    */
+   size_t getTrnstnRcrds(lsSwtchTrnstnRcrd_t* rcrds, const size_t &maxRcrdsQty);
+   /**
+    * @brief Returns the transitions ring overrun counter
+    * 
+    * @return The quantity of status changes that could not be registered as the transitions ring was full. Compared with a previously read value it tells if records were lost between two consecutive getTrnstnRcrds(lsSwtchTrnstnRcrd_t*, const size_t &) executions
+    */
+   uint32_t getTrnstnRngOvrrnQty() const;
+   /**
+    * @brief Returns the worst case execution time record of the updates executed from a FDA state
+    * 
+    * When the library is built with the _lsSwtchPrfInstr flag set to 1 every object update -periodic poll, input event, phase deadline or deferred emergency stop- is also registered in the record of the FDA state the update started from, keeping the longest durations observed. Driving the object through every state with the tasks notifications and functions set gives the figures for a documented input to output path worst case time.
+    * 
+    * @param fdaStt FDA state, 0 to lsSwtchFdaSttsQty - 1
+    * @param rcrd Reference to the lsSwtchWcetRcrd_t variable where the record is copied to
+    * 
+    * @retval true The fdaStt is valid and the record was copied
+    * @retval false The fdaStt is not valid or the library was built without the _lsSwtchPrfInstr flag set, the rcrd was not modified
+    * 
+    * @note The records are observed maximums, not a static analysis bound: states and transitions never driven keep a 0 smplsQty record.
+    */
+   bool getWcetSttRcrd(const uint8_t &fdaStt, lsSwtchWcetRcrd_t &rcrd) const;
+   /**
+    * @brief Returns the worst case execution time record of the FDA steps producing a FDA transition
+    * 
+    * When the library is built with the _lsSwtchPrfInstr flag set to 1 each FDA step changing the FDA state is registered in the record of its transition. In the event driven mode an update might run several FDA steps, each one is registered in its own transition record, with the lock hold and whole update durations of the update executing it.
+    * 
+    * @param frmStt FDA state before the transition, 0 to lsSwtchFdaSttsQty - 1
+    * @param toStt FDA state after the transition, 0 to lsSwtchFdaSttsQty - 1
+    * @param rcrd Reference to the lsSwtchWcetRcrd_t variable where the record is copied to
+    * 
+    * @retval true The states are valid and the record was copied
+    * @retval false A state is not valid or the library was built without the _lsSwtchPrfInstr flag set, the rcrd was not modified
+    * 
+    * @note The recovery from the emergency stop state is executed by rcvrEmrgncyStp(), not by an update, so it's registered as the entry step of the stOffNotBHP state update and not as a transition.
+    */
+   bool getWcetTrnstnRcrd(const uint8_t &frmStt, const uint8_t &toStt, lsSwtchWcetRcrd_t &rcrd) const;
+   /**
+    * @brief Injects an input edge through the same deferred handler the GPIO edge interrupts use
+    * 
+    * Simulates the GPIO edge Interrupt Service Routine of one of the inputs, so the event driven input path and its latency might be exercised and benchmarked without operating the physical switches. The edge is time stamped and processed by the FreeRTOS timer service task, exactly as the ISR generated edges are.
+    * 
+    * @param inptId Input identification: lftHndInptId, rghtHndInptId or ftInptId
+    * @param isPrssd Input state after the edge: true for pressed, false for released
+    * @retval true The object is in event driven mode and the edge was queued for processing
+    * @retval false The object is not in event driven mode, the inptId is not valid or the timer service queue was full
+    * 
+    * @note The injected level stays in effect until the next edge, real or injected, of the same input.
+    */
+   bool injctInptEvnt(const uint8_t &inptId, const bool &isPrssd);
+   /**
+    * @brief Recovers the object from an emergency stop
+    * 
+    * The stEmrgncyExcpHndl state is left only by this explicit recovery, the FDA is moved to the stOffNotBHP state, whose entry code restores the underlying switches to their configured state, so a new production cycle needs a new both hands on and foot switch press sequence. The recovery is refused -and counted in the rcvrRfsdQty statistic- while the emergency stop input is active, while an emergency stop request is pending or while any of the hands switches is pressed. As the hands switches might be disabled while stopped the check uses their input levels: the behavior model levels in the event driven mode and for the LsSwtchRplyr objects, the input pins levels otherwise.
+    * 
+    * @retval true The FDA left the stEmrgncyExcpHndl state
+    * @retval false The FDA was not in the stEmrgncyExcpHndl state, or the recovery was refused
+    * 
+    * @note The time spent in the stEmrgncyExcpHndl state is registered in the lstHltTmUs statistic, see getEmrgncyStts(lsSwtchEmrgncyStts_t &) const
+    */
+   bool rcvrEmrgncyStp();
 	/**
 	 * @brief Resets the LsSwitch behavior automaton to it's **Initial** or **Start State**
 	 *
 	 * This method is provided for security and for error handling purposes, so that in case of unexpected situations detected, the driving **Deterministic Finite Automaton** used to compute the objects' states might be reset to it's initial state to safely restart it, maybe as part of an **Error Handling** procedure.
+    * 
+    * @note The FDA is not reset while in the stEmrgncyExcpHndl state or with an emergency stop request pending, the rcvrEmrgncyStp() method must be used instead.
 	 */
    void resetFda();
+   /**
+    * @brief Unsubscribes a task from the batched edges notification
+    * 
+    * @param sbscrbrTsk TaskHandle_t of the task to unsubscribe
+    * @retval true The task was unsubscribed
+    * @retval false The task was not subscribed
+    * 
+    * @note The task is not suspended nor notified, edges already notified are kept in its notification value.
+    */
+   bool rmvEdgsSbscrbr(const TaskHandle_t &sbscrbrTsk);
+   /**
+    * @brief Unsubscribes a task from the filtered status change notification
+    * 
+    * @param sbscrbrTsk TaskHandle_t of the task to unsubscribe
+    * @retval true The task was unsubscribed
+    * @retval false The task was not subscribed
+    * 
+    * @note The task is not suspended, a notification for edges produced before the unsubscription and not yet issued is discarded.
+    */
+   bool rmvSttsSbscrbr(const TaskHandle_t &sbscrbrTsk);
+   /**
+    * @brief Resets the callback dispatch task statistics to 0
+    */
+   void rstCbDsptchStts();
+   /**
+    * @brief Resets the emergency stop statistics to 0
+    */
+   void rstEmrgncyStts();
+   /**
+    * @brief Resets the production statistics, i.e. at a shift start
+    * 
+    * The production cycle in progress -if any- is not counted, the statistics restart with the next production cycle start.
+    */
+   void rstPrdSttstcs();
+   /**
+    * @brief Resets the update stages timing histograms and the worst case execution time records
+    * 
+    * The lock hold time bound set by setWcetLckHldBndUs(const uint32_t&) is kept.
+    */
+   void rstPrfHstgrms();
 	/**
 	 * @brief Sets the function to be executed when the object's state changes from the "foot switch enabled" to the "foot switch disabled" instead of the "Production cycle activated" state.
     * 
@@ -704,6 +1614,47 @@ public:
     * @param newLsSwtchOtptsChng The new value to set the **lsSwtchOtptsChng** flag to.
     */
 	void setLsSwtchOtptsChng(bool newLsSwtchOtptsChng);
+   /**
+    * @brief Sets the execution context of the functions set to be executed when the object's outputs change
+    * 
+    * By default the functions set by the setFnWhn* methods are executed by the object's update code, in the FreeRTOS timer service task, so a time demanding function delays every other software timer in the system. When the callback dispatch mode is set the begin(unsigned long int) method creates a dispatch task, the update code queues the execution requests in a bounded lock-free queue and the dispatch task executes them, in the same order they were queued. The tasks notifications are not affected, they keep being issued by the update code.
+    * 
+    * @param newVal true to set the callback dispatch mode, false to execute the functions in the timer service task
+    * @param dsptchTskCnfg (Optional) Core and priority level for the dispatch task, by default the core executing this method and the timer service task priority level
+    * @retval true The mode was set
+    * @retval false The begin(unsigned long int) method was already executed, the mode was not changed
+    * 
+    * @warning The mode must be set **before** the begin(unsigned long int) method is executed.
+    * @warning The update code must never block the timer service task waiting for the dispatch task to free an entry, so a full queue is handled fail safe instead: the last _cbDsptchRsrvdEntrs entries are reserved to the latch release and production cycle turn off requests, a request finding the queue full forces an emergency stop -see trgrEmrgncyStp()-, and is dropped unless it's a turn off request. A turn off request finding even the reserved entries in use is executed by the update code, out of the queue order, so a turn off function is never lost. The getCbDsptchStts(lsSwtchCbDsptchStts_t &) const method ovrflwQty statistic registers the requests that found the queue full. A non zero value means the callback functions execution time exceeds the rate of the outputs changes: shorten the functions or raise the dispatch task priority level, then recover the object with rcvrEmrgncyStp().
+    */
+   bool setCbDsptchd(const bool &newVal, const limbSftyFwConf_t &dsptchTskCnfg = limbSftyFwConf_t());
+   /**
+    * @brief Sets the object's inputs processing mode: event driven or fixed period polling
+    * 
+    * In the fixed period polling mode -the default mode- the underlying DbncdMPBttn subclasses objects and the object itself are updated by periodic timers, adding up to two poll periods of latency between an input edge and the FDA reaction. In the event driven mode GPIO edge interrupts on the swtchInptHwCfg_t::inptPin pins wake the FDA through a deferred handler executed by the FreeRTOS timer service task, the underlying switches outputs are computed by a behavior model of the DbncdMPBttn subclasses objects, and the periodic timer only runs while a debounce, start delay, voiding or production cycle phase time is pending.
+    * 
+    * @param newVal true to set the event driven mode, false to set the fixed period polling mode
+    * @retval true The mode was set
+    * @retval false The begin(unsigned long int) method was already executed, the mode was not changed
+    * 
+    * @warning The mode must be set **before** the begin(unsigned long int) method is executed. 
+    * @warning In the event driven mode the underlying DbncdMPBttn subclasses objects are not updated, their getters will not reflect the input switches states.
+    */
+   bool setEvntDrvn(const bool &newVal);
+   /**
+    * @brief Sets the emergency stop input pin
+    * 
+    * The emergency stop input is served by its own GPIO edge Interrupt Service Routine, attached by the begin(unsigned long int) method, for both the polled and the event driven modes. When the input reaches its active level the ISR sets the output stage pins -see setOtptPins(const gpioPinOtptHwCfg_t&, const gpioPinOtptHwCfg_t&)- to their inactive levels, and defers to the timer service task the FDA move to the stEmrgncyExcpHndl state, turning off the latch release and the production cycle, and the tasks notifications and functions executions. Neither step waits for the object's poll period: the output pins reaction is bounded by the interrupt latency plus the longest object lock hold time, the FDA state change by the timer service task scheduling latency.
+    * 
+    * The active level is the pressed level computed from the typeNO and pulledUp attributes as for the underlying switches, so a normally closed emergency stop contact must be set with typeNO = false. The pin mode is set from the pulledUp attribute alone: a normally closed contact with pulledUp = true reads active when pressed and when its wire is broken. The input is not debounced, the first active level edge stops the object. If the input is active when the begin(unsigned long int) method is executed the object starts stopped.
+    * 
+    * @param emrgncyStpInptCfg Emergency stop input hardware attributes, only the inptPin, typeNO and pulledUp fields are used
+    * @retval true The pin was set
+    * @retval false The pin number is not valid, a writer function is set by setOtptPinsWrtr(fncOtptPinsWrtPtrType, void*), or the begin(unsigned long int) method was already executed
+    * 
+    * @note The ISR writes the output stage GPIO registers directly, as a writer function set by setOtptPinsWrtr(fncOtptPinsWrtPtrType, void*) might not be placed in IRAM, and deferring the write to the FDA state change would lose the bounded reaction time. So the emergency stop input and a writer function are mutually exclusive: this method fails while a writer function is set, and setOtptPinsWrtr(fncOtptPinsWrtPtrType, void*) fails once the emergency stop input is set.
+    */
+   bool setEmrgncyStpPin(const swtchInptHwCfg_t &emrgncyStpInptCfg);
    /**
     * @brief Set the Latch Release Total Time (ltchRlsTtlTm) attribute value
     * 
@@ -714,6 +1665,48 @@ public:
     * @return false The parameter value was not in the valid range, attribute value was not updated.
     */
    bool setLtchRlsTtlTm(const unsigned long int &newVal);
+   /**
+    * @brief Sets the output stage pins, driven directly by the object's update code
+    * 
+    * Without an output stage the latch release and production cycle states must be copied to their output pins by a user task, adding the task activation latency to the safety related latch path. With the output stage set, each update writes the pins right after the FDA step -in the same object lock- when any of them changes, all the pins set and all the pins cleared by two GPIO write 1 to set/write 1 to clear registers stores, no read-modify-write involved. The pins are configured as outputs and set to their inactive levels by this method.
+    * 
+    * @param ltchRlsIsOnPin Latch release output pin hardware attributes, the pin is activated while the ltchRlsIsOn attribute flag is set. A gpioOtptPin value of _InvalidPinNum leaves the output unused
+    * @param prdCyclIsOnPin Production cycle output pin hardware attributes, the pin is activated while the prdCyclIsOn attribute flag is set. A gpioOtptPin value of _InvalidPinNum leaves the output unused
+    * @retval true The output stage was set
+    * @retval false A pin number is out of range, both outputs use the same pin or the begin(unsigned long int) method was already executed, the output stage was not changed
+    * 
+    * @warning The output stage must be set **before** the begin(unsigned long int) method is executed.
+    * @note If a writer function was set by setOtptPinsWrtr(fncOtptPinsWrtPtrType, void*) the pins are not configured and the writes are passed to the function, see that method.
+    */
+   bool setOtptPins(const gpioPinOtptHwCfg_t &ltchRlsIsOnPin, const gpioPinOtptHwCfg_t &prdCyclIsOnPin = gpioPinOtptHwCfg_t());
+   /**
+    * @brief Sets a function to replace the output stage GPIO registers writes
+    * 
+    * The function receives the masks of the pins to set to high level and to clear to low level, instead of them being written to the GPIO registers. It's executed by the update code inside the object's lock, so it must be short and must not block. Intended to attach a GPIO mock -i.e. a host or replay test harness time stamping the output writes- or to drive the outputs through an external port expander.
+    * 
+    * @param newOtptPinsWrtr Function pointer to the writer function, or nullptr to restore the GPIO registers writes
+    * @param newOtptPinsWrtrArg (Optional) void* argument passed to the writer function each time it is invoked, nullptr by default
+    * @retval true The writer function was set
+    * @retval false The emergency stop input is set by setEmrgncyStpPin(const swtchInptHwCfg_t&), whose ISR writes the GPIO registers directly. The writer function was not changed. Restoring the GPIO registers writes with nullptr never fails
+    * 
+    * @warning The writer function must be set **before** the setOtptPins(const gpioPinOtptHwCfg_t &, const gpioPinOtptHwCfg_t &) method is executed, as that method configures the GPIO pins when no writer function is set.
+    */
+   bool setOtptPinsWrtr(fncOtptPinsWrtPtrType newOtptPinsWrtr, void* newOtptPinsWrtrArg = nullptr);
+   /**
+    * @brief Sets the latch release and production cycle phases ending mode: deadline one-shot timers or periodic timer updates
+    * 
+    * In the default mode the FDA checks the phases elapsed time on every periodic timer update, so each phase end has up to one poll period of jitter, and the periodic timer keeps running during the whole production cycle. In the phase deadline timers mode a one-shot timer is armed at the production cycle start for the latch release deadline (start + ltchRlsTtlTm), then for the production cycle deadline (start + prdCyclTtlTm), and its expirations drive the FDA transitions. The periodic timer is stopped while the FDA waits for those deadlines.
+    * 
+    * The one-shot timer is an esp_timer armed with microseconds resolution, its expiration requests the FDA update to the FreeRTOS timer service task, so the phases end with no tick quantization. With the _lsSwtchStcAlloc build flag set the one-shot timer is a statically allocated FreeRTOS timer, and the phases end on the first tick following the deadline.
+    * 
+    * @param newVal true to set the phase deadline timers mode, false to set the periodic updates mode
+    * @retval true The mode was set
+    * @retval false The begin(unsigned long int) method was already executed, the mode was not changed
+    * 
+    * @warning The mode must be set **before** the begin(unsigned long int) method is executed. 
+    * @note The timer is armed for the time left to the deadline measured by the object's time base, so the mode is not compatible with a time source set by setTmSrc() or setTmSrcUs() that doesn't advance at the real time rate.
+    */
+   bool setPhsTmrDrvn(const bool &newVal);
    /**
     * @brief Set the Production Cycle Total Time (prdCyclTtlTm) attribute value
     * 
@@ -724,6 +1717,42 @@ public:
     * @return false The parameter value was not in the valid range, attribute value was not updated.
     */
    bool setPrdCyclTtlTm(const unsigned long int &newVal);
+   /**
+    * @brief Sets the time base source used for the object's Flags, Triggers and Timers calculations
+    * 
+    * By default the object takes its time base from the esp_timer microseconds counter, a source that makes impossible to reproduce a FDA execution. Providing a time source function makes the object time base injectable, i.e. a virtual clock for deterministic replays of recorded input traces, or a simulated clock for testing purposes.
+    * 
+    * @param newTmSrc Function pointer to the function returning the current time in milliseconds, or nullptr to restore the default esp_timer based time source
+    * @param newTmSrcArg (Optional) void* argument passed to the time source function each time it is invoked, nullptr by default
+    * 
+    * @note The returned value is taken as a 32 bits milliseconds counter, i.e. millis(), its wrap around is tracked and the time base extended to 64 bits, so the FDA timing is not disrupted each 49.7 days.
+    * @warning The time source function is executed inside the object's timer callback critical section, so it must be short, must not block and must be monotonic.
+    */
+   void setTmSrc(fncTmSrcPtrType newTmSrc, void* newTmSrcArg = nullptr);
+   /**
+    * @brief Sets a microseconds resolution time base source used for the object's Flags, Triggers and Timers calculations
+    * 
+    * The FDA phases are timed with 64 bits microseconds timestamps, so the latch release and production cycle boundaries are not quantized to milliseconds and the time base doesn't wrap around in the device lifetime. This method replaces the default esp_timer source -or a source set by setTmSrc()- by a function returning the monotonic time in microseconds, i.e. a wrapper of clock_gettime(CLOCK_MONOTONIC) when the FDA is hosted outside the ESP32.
+    * 
+    * @param newTmSrcUs Function pointer to the function returning the current time in microseconds, or nullptr to restore the default esp_timer based time source
+    * @param newTmSrcArg (Optional) void* argument passed to the time source function each time it is invoked, nullptr by default
+    * 
+    * @warning The time source function is executed inside the object's timer callback critical section, so it must be short, must not block and must be monotonic.
+    */
+   void setTmSrcUs(fncTmSrcUsPtrType newTmSrcUs, void* newTmSrcArg = nullptr);
+   /**
+    * @brief Sets the transitions ring registration mode
+    * 
+    * The tasks notification for the output changes overwrites the notification value, so the intermediate status values are lost if the receiving task is slow. When the transitions ring mode is set every update publishing a status different from the previous one -packed status or FDA state- pushes a lsSwtchTrnstnRcrd_t record to a fixed capacity (_trnstnRngSz records) lock-free ring, drained by the getTrnstnRcrds(lsSwtchTrnstnRcrd_t*, const size_t &) method, for a lossless audit of every latch release and production cycle edge. The LsSwtchRplyr objects register the replayed status changes as well.
+    * 
+    * @param newVal true to register the status changes in the transitions ring, false to not use the ring
+    * @retval true The mode was set
+    * @retval false The begin(unsigned long int) method was already executed, the mode was not changed
+    * 
+    * @warning The mode must be set **before** the begin(unsigned long int) method is executed.
+    * @warning If the ring is full when a status change is produced the record is dropped, the update code is never delayed by the consumer. The getTrnstnRngOvrrnQty() method returns the quantity of records dropped.
+    */
+   bool setTrnstnRcrdd(const bool &newVal);
    /**
     * @brief Sets the pointer to the arguments for the function to be executed when the object's ltchRlsIsOn attribute flag is set to false
     * 
@@ -862,6 +1891,287 @@ public:
     * @warning After the begin(unsigned long int) method is executed no other method is implemented to change the periodic update time, so this method must be used -if there's intention of using a non default value- **before** the begin(unsigned long int). Changing the value of the update period after executing the begin method will have no effect on the object's behavior.  
     */
    bool setUndrlSwtchsPollDelay(const unsigned long int &newVal);
+   /**
+    * @brief Sets the object lock hold time bound checked by the worst case execution time records
+    * 
+    * Each update holding the object lock -so masking the interrupts in the executing core- longer than the bound is counted in the lckHldOvrBndQty member of its state and transitions records, see getWcetSttRcrd(const uint8_t&, lsSwtchWcetRcrd_t&) const.
+    * 
+    * @param bndUs Lock hold time bound, in microseconds. A 0 value removes the bound
+    * 
+    * @retval true The bound was set
+    * @retval false The library was built without the _lsSwtchPrfInstr flag set
+    */
+   bool setWcetLckHldBndUs(const uint32_t &bndUs);
+   /**
+    * @brief Stops the object by an emergency stop request issued by software
+    * 
+    * Executes the same emergency stop sequence the emergency stop input Interrupt Service Routine executes -see setEmrgncyStpPin(const swtchInptHwCfg_t&)-: the output stage pins are set to their inactive levels before this method returns, and the FDA move to the stEmrgncyExcpHndl state is deferred to the timer service task. For an object not started -or a LsSwtchRplyr object- the FDA state change is executed by the next object update.
+    * 
+    * @retval true The emergency stop was requested
+    * @retval false The FDA state change couldn't be deferred to the timer service task, it will be executed by the next object update. The output stage pins were set to their inactive levels anyway
+    */
+   bool trgrEmrgncyStp();
+   /**
+    * @brief Blocks the calling task until the packed status changes, or until a timeout
+    * 
+    * Consumer tasks -HMI, outputs drivers, loggers- might replace a fixed period loop polling the object getters by a loop blocked in this method: no CPU time is used between status changes, and the task is unblocked by the same update that publishes the change, not by its own loop period. Each packed status change published by the object increments a change sequence number, the caller passes the last sequence number it processed and gets the newer status and its sequence number. If more than one change happened since then the caller gets the latest one, the difference between the sequence numbers tells the quantity of changes.
+    * 
+    * Up to _maxSttsWtrsQty tasks might be blocked simultaneously. The tasks notification values are not used, so a waiting task might also be notified by the rest of the object mechanisms.
+    * 
+    * @param otptsSttsPkgd Reference to the variable receiving the packed status, encoded as documented in lssOtptsSttsUnpkg(uint32_t)
+    * @param chngSeqNum Reference to the variable holding the change sequence number of the last status processed by the caller -0 for the first call, so the status published by the object is returned at once, being the initial status sequence number 1-, receiving the sequence number of the status returned
+    * @param tmOut (Optional) Maximum time -in ticks- to block waiting for a change, the default value waits with no time limit. A 0 value returns at once
+    * 
+    * @retval true A status newer than the chngSeqNum one was copied to the parameters
+    * @retval false The timeout elapsed with no status change, the begin(unsigned long int) method was not executed, or _maxSttsWtrsQty tasks are already blocked. The parameters are not modified
+    */
+   bool wtLsSwtchOtptsChng(uint32_t &otptsSttsPkgd, uint32_t &chngSeqNum, const TickType_t &tmOut = portMAX_DELAY);
+};
+
+/**
+ * @brief RAM used by each LimbsSftyLnFSwtch object, in bytes
+ *
+ * With the _lsSwtchStcAlloc flag set to 1 the value is the complete footprint, as every resource is held by the object. Otherwise the heap allocated DbncdMPBttn subclasses objects are added, the FreeRTOS timers and task control blocks and stacks, and the heap management overhead, are not included.
+ *
+ * Defining _lsSwtchRamBdgt as a build flag makes the compilation fail if the value exceeds it.
+ */
+const size_t lsSwtchRamFtprnt{sizeof(LimbsSftyLnFSwtch)
+#if !_lsSwtchStcAlloc
+   + 2 * sizeof(TmVdblMPBttn) + sizeof(SnglSrvcVdblMPBttn)
+#endif
+};
+#ifdef _lsSwtchRamBdgt
+static_assert(lsSwtchRamFtprnt <= _lsSwtchRamBdgt, "LimbsSftyLnFSwtch RAM footprint exceeds the _lsSwtchRamBdgt budget");
+#endif
+
+/**
+ * @class LsSwtchRplyr
+ * 
+ * @brief Models a LimbsSftyLnFSwtch driven by a virtual clock and fed by a recorded input trace, for deterministic replays of production line operator inputs.
+ * 
+ * The replayer object executes the same Deterministic Finite Automaton the LimbsSftyLnFSwtch uses, but no timers are started: the underlying switches outputs are computed from the input trace edges by a behavior model of the DbncdMPBttn subclasses objects, and the time base is a virtual clock advanced in steps of the configured poll period. As the virtual clock doesn't depend on the real time elapsed, idle periods and production cycle phases with no possible output changes are skipped, letting a whole shift of logged operator inputs be replayed in seconds.
+ * 
+ * The result of the replay is the exact sequence of packed status values -as returned by getLsSwtchOtptsSttsPkgd()- with the virtual time of each change, delivered to a user provided function.
+ * 
+ * @note The behavior model considers the trace edges as already debounced signals. The start delay, voiding time, isEnabled and isOnDisabled attributes of each underlying switch are honored.
+ */
+class LsSwtchRplyr: public LimbsSftyLnFSwtch{
+protected:
+   unsigned long int _vrtlClkMs{0};
+   unsigned long int _rplyStpTm{_minPollDelay};
+   fncRplyOtptPtrType _fnWhnRplyOtptsChng{nullptr};
+   void* _fnWhnRplyOtptsChngArg{nullptr};
+   uint32_t _lstOtptsSttsPkgd{0};
+
+   void _rplyStp();
+   void _sdRplySttsSnpsht();
+   static unsigned long int _vrtlClkRd(void* rplyrArg);
+
+public:
+   /**
+    * @brief Class constructor
+    * 
+    * Same parameters as the LimbsSftyLnFSwtch class constructor. The underlying DbncdMPBttn subclasses objects are instantiated but never started, as their inputs are provided by the replayed input trace.
+    */
+   LsSwtchRplyr(swtchInptHwCfg_t lftHndInpCfg,
+                  swtchBhvrCfg_t lftHndBhvrCfg,
+                  swtchInptHwCfg_t rghtHndInpCfg,
+                  swtchBhvrCfg_t rghtHndBhvrCfg,
+                  swtchInptHwCfg_t ftInpCfg,
+                  swtchBhvrCfg_t ftBhvrCfg,
+                  lsSwtchSwCfg_t lsSwtchWrkngCnfg
+                  );
+   /**
+    * @brief Returns the current virtual clock value
+    * 
+    * @return The virtual time -in milliseconds- of the last replay step executed
+    */
+   unsigned long int getVrtlClkMs();
+   /**
+    * @brief Replays an input trace through the object's FDA
+    * 
+    * The input trace edges are applied to the underlying switches behavior model at their recorded times, and the FDA is updated at every virtual poll instant. Each time the packed status value changes, the function set by setFnWhnRplyOtptsChng() is invoked with the virtual time of the poll that produced it. Consecutive calls continue the replay from the virtual time reached by the previous call, so a long trace might be replayed in consecutive chunks, being the evntTm of each chunk relative to the start of the first one.
+    * 
+    * @param trcEvnts Pointer to the first element of an array of input trace events, ordered by ascending evntTm
+    * @param trcEvntsQty Quantity of events in the array
+    * @param rplyEndTm (Optional) Virtual time up to which the replay must continue after the last event is applied, letting the last production cycle to be completed. Default value 0 ends the replay with the last event.
+    * @return The quantity of packed status changes produced by the replay
+    */
+   uint32_t rplyTrc(const lsSwtchTrcEvnt_t* trcEvnts, const size_t &trcEvntsQty, const unsigned long int &rplyEndTm = 0);
+   /**
+    * @brief Restarts the virtual clock, the FDA and the underlying switches behavior model to their initial states
+    */
+   void rstRply();
+   /**
+    * @brief Sets the function to be executed for each packed status change produced by a replay
+    * 
+    * @param newFnWhnRplyOtptsChng Function pointer to the function receiving the virtual time of the change, the new packed status value and the provided argument
+    * @param newFnWhnRplyOtptsChngArg (Optional) void* argument passed to the function each time it is invoked
+    */
+   void setFnWhnRplyOtptsChng(fncRplyOtptPtrType newFnWhnRplyOtptsChng, void* newFnWhnRplyOtptsChngArg = nullptr);
+   /**
+    * @brief Sets the virtual poll period used to step the FDA during the replays
+    * 
+    * @param newVal Virtual poll period in milliseconds. To reproduce the behavior of a running LimbsSftyLnFSwtch it must be set to the same value passed to its begin(unsigned long int) method
+    * @retval true The value was in the accepted range and successfully changed
+    * @retval false The value was not in the accepted range and was not changed
+    */
+   bool setRplyStpTm(const unsigned long int &newVal);
+};
+
+/**
+ * @class LsSwtchGrp
+ * 
+ * @brief Models a group of LimbsSftyLnFSwtch objects -one for each press station of a production cell- updated by a single periodic timer.
+ * 
+ * A started LimbsSftyLnFSwtch object uses four software timers: its own and one for each of its underlying DbncdMPBttn subclasses objects, so N stations wake the timer service task 4N times per poll period. The group object uses a single timer instead: at each expiration the GPIO input registers are read once, the input levels of every station are extracted from that single sample, and the FDAs of all the stations are stepped in the same callback. The underlying switches outputs of the grouped objects are computed by the same behavior model used by the event driven mode, their DbncdMPBttn subclasses objects are never started.
+ * 
+ * @note The grouped objects keep their full functionality -tasks notifications, functions executions, status snapshots, callback dispatch task- except for the inputs processing mode, that is always the fixed period polling, and the phases ending mode, that is always the periodic updates.
+ * @warning The grouped objects must exist for the whole group object life, they are not owned nor destroyed by the group.
+ */
+class LsSwtchGrp{
+protected:
+   uint64_t _dbncCntr[_vrtclDbncCntrBits]{};
+   uint64_t _dbncThrshld[_vrtclDbncCntrBits]{};
+   uint64_t _dbncdInptsLvl{0};
+   uint64_t _inptsMsk{0};
+   LimbsSftyLnFSwtch* _lsSwtchsPtrs[_maxLsSwtchGrpSz]{};
+   uint8_t _lsSwtchsQty{0};
+   TimerHandle_t _lsSwtchGrpPollTmrHndl{NULL};
+   const char* _lsSwtchGrpPollTmrName{"lsSwtchGrpPollTmr"};
+#if _lsSwtchStcAlloc
+   StaticTimer_t _lsSwtchGrpPollTmrBuf{};
+#endif
+   bool _vrtclDbnc{false};
+
+   static void lsSwtchGrpPollCb(TimerHandle_t lssGrpTmrCbArg);
+   bool _cnfgVrtclDbnc(const unsigned long int &pollDelayMs);
+   uint64_t _rdGpioInptsLvl();
+   void _updLsSwtchGrp();
+   uint64_t _updVrtclDbnc(const uint64_t &gpioInptsLvl);
+
+public:
+   /**
+    * @brief Default constructor
+    */
+   LsSwtchGrp();
+   /**
+    * @brief Default destructor
+    * 
+    * The group's timer is stopped and deleted, the grouped objects are released, no longer updated. A released object might be added to another group, or started by its own begin(unsigned long int) method if it wasn't started by a group.
+    */
+   ~LsSwtchGrp();
+   /**
+    * @brief Adds a LimbsSftyLnFSwtch object to the group
+    * 
+    * @param lsSwtchPtr Pointer to the object to add
+    * @retval true The object was added to the group
+    * @retval false The object was not added: the group is full or already started, the object was already started or grouped, it was set to the event driven or phase deadline timers modes, or one of its inputs pins is not valid
+    * 
+    * @note Once added to a group the object's begin(unsigned long int), setEvntDrvn(const bool &) and setPhsTmrDrvn(const bool &) methods always return false.
+    */
+   bool addLsSwtch(LimbsSftyLnFSwtch* lsSwtchPtr);
+   /**
+    * @brief Returns a pointer to a grouped LimbsSftyLnFSwtch object
+    * 
+    * @param lsSwtchIdx Index of the object in the group, in the order they were added
+    * @return The pointer to the grouped object, nullptr if the index is out of range
+    */
+   LimbsSftyLnFSwtch* getLsSwtchPtr(const uint8_t &lsSwtchIdx);
+   /**
+    * @brief Returns the quantity of LimbsSftyLnFSwtch objects in the group
+    */
+   uint8_t getLsSwtchsQty() const;
+   /**
+    * @brief Returns the vrtclDbnc attribute flag value
+    * 
+    * @retval true The grouped objects inputs are debounced by the group's vertical counters
+    * @retval false The grouped objects inputs are debounced by each object's behavior model
+    */
+   const bool getIsVrtclDbnc() const;
+   /**
+    * @brief Starts the group's periodic timer, updating all the grouped objects
+    * 
+    * The callback dispatch tasks of the grouped objects set to the callback dispatch mode are created as well.
+    * 
+    * @param pollDelayMs (Optional) unsigned long integer (ulong), the time between updates in milliseconds, must not be less than the minimum poll delay
+    * @retval true The group was started
+    * @retval false The group was already started, it's empty, the pollDelayMs value was out of range, a debounce time was out of the vertical counters range or a timer or task creation failed
+    */
+   bool begin(unsigned long int pollDelayMs = _minPollDelay);
+   /**
+    * @brief Sets the grouped objects inputs debouncing mode: bit-parallel vertical counters or per input behavior model
+    * 
+    * In the default mode each input level is debounced by its object's behavior model, one input at a time. In the vertical counters mode the group debounces all the configured input pins at once, on the GPIO input registers sample: each pin has a _vrtclDbncCntrBits bits counter, stored as bit planes -bit k of every pin counter in the same 64 bits word-, so counting, resetting and comparing the counters against each pin threshold are a handful of bitwise operations, whose cost doesn't depend on the quantity of inputs. The objects receive the already debounced levels.
+    * 
+    * Each pin threshold is computed from its swtchInptHwCfg_t::dbncTime value as the quantity of consecutive samples -poll periods- needed to cover it, the swtchInptHwCfg_t::typeNO and swtchInptHwCfg_t::pulledUp values are applied by each object to the debounced level.
+    * 
+    * @param newVal true to set the vertical counters mode, false to set the per input behavior model mode
+    * @retval true The mode was set
+    * @retval false The begin(unsigned long int) method was already executed, the mode was not changed
+    * 
+    * @note The debounce times must not exceed (2^_vrtclDbncCntrBits - 2) poll periods. If a pin is shared by more than one input the greatest debounce time is used.
+    */
+   bool setVrtclDbnc(const bool &newVal);
+};
+
+/**
+ * @class LsSwtchLgEncdr
+ * 
+ * @brief Models an encoder of the packed status changes sequence into a compact binary event log.
+ * 
+ * Each status change is encoded as two LEB128 variable length unsigned integers -7 bits per byte, least significant group first, most significant bit set in every byte but the last-: the time elapsed since the previous change, in units of the encoder's time resolution, and the XOR between the previous and the new packed status values. The operator interactions change one or two flags at a time separated by less than 16 seconds, so a regular change takes 2 to 4 bytes.
+ * 
+ * The log starts with a header written by encdHdr(): the bytes 'L', 'S', 'L', the format version 0x01 and the time resolution in microseconds as a variable length integer. The first change encoded after the encoder construction or a rst() execution is preceded by a key frame: two 0x00 bytes followed by the absolute time -in units of the time resolution- and the absolute packed status value, both as variable length integers. A log file appended by several encoders -i.e. across device restarts- keeps a single header and gets a key frame at the start of each encoder's records. A log captured from a stream -i.e. an UART- across device restarts might instead get a header written by each boot, the decoder takes a repeated header followed by a key frame as the start of a new encoder's records.
+ * 
+ * The extras/LsSwtchLgDcdr host tool expands a log back into CSV or JSON lines.
+ * 
+ * @note The encoder keeps no buffer, the encoded bytes are written to the buffer provided by each call, ready to be appended to a flash file or written to a UART.
+ */
+class LsSwtchLgEncdr{
+protected:
+   bool _kyFrmPndng{true};
+   uint32_t _lstOtptsSttsPkgd{0};
+   uint64_t _lstTm{0};
+   uint32_t _rcrdsQty{0};
+   uint32_t _tmRsltnUs{1000};
+
+   static size_t _encdVrnt(uint64_t val, uint8_t* bfr);
+public:
+   /**
+    * @brief Class constructor
+    * 
+    * @param tmRsltnUs (Optional) Time resolution of the encoded records, in microseconds. The default value logs the changes times in milliseconds, a 0 value is replaced by 1
+    */
+   LsSwtchLgEncdr(const uint32_t &tmRsltnUs = 1000);
+   /**
+    * @brief Writes the log header
+    * 
+    * @param bfr Pointer to the buffer where the header is written
+    * @param bfrSz Size of the buffer, in bytes
+    * @return The quantity of bytes written, 0 if the buffer size is less than _lgHdrMaxSz
+    */
+   size_t encdHdr(uint8_t* bfr, const size_t &bfrSz) const;
+   /**
+    * @brief Encodes a packed status change
+    * 
+    * @param tmUs Time -in microseconds- of the change, i.e. the tmUs member of a lsSwtchTrnstnRcrd_t returned by getTrnstnRcrds(), or the time of a getLsSwtchOtptsSttsPkgd() read
+    * @param otptsSttsPkgd Packed status value after the change
+    * @param bfr Pointer to the buffer where the record is written
+    * @param bfrSz Size of the buffer, in bytes
+    * @return The quantity of bytes written. 0 if the packed status value is the same as the previous one encoded, or if the buffer size is less than _lgEncdMaxSz, in both cases the encoder state is not modified
+    * 
+    * @note A time earlier than the previous one encoded -i.e. a time base restarted- is logged with a key frame.
+    */
+   size_t encdTrnstn(const uint64_t &tmUs, const uint32_t &otptsSttsPkgd, uint8_t* bfr, const size_t &bfrSz);
+   /**
+    * @brief Returns the quantity of status changes encoded since the encoder construction or the last rst() execution
+    */
+   uint32_t getRcrdsQty() const;
+   /**
+    * @brief Restarts the encoder, the next status change is encoded with a key frame
+    */
+   void rst();
 };
 
 //===================================================>> END Classes declarations